@@ -0,0 +1,7 @@
+#include "grid_dimension_mismatch_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(GridDimensionMismatchError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef CORE__EXCEPTIONS__GRID_DIMENSION_MISMATCH_ERROR_HPP
+#define CORE__EXCEPTIONS__GRID_DIMENSION_MISMATCH_ERROR_HPP
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(GridDimensionMismatchError)
+}
+
+#endif//CORE__EXCEPTIONS__GRID_DIMENSION_MISMATCH_ERROR_HPP
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "invalid_grid_delta_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(InvalidGridDeltaError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef CORE__EXCEPTIONS__INVALID_GRID_DELTA_ERROR_HPP
+#define CORE__EXCEPTIONS__INVALID_GRID_DELTA_ERROR_HPP
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(InvalidGridDeltaError)
+}
+
+#endif//CORE__EXCEPTIONS__INVALID_GRID_DELTA_ERROR_HPP
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "fixed_grid.hpp"
+
+#include <string>
+#include <vector>
+
+#include "cell_t.hpp"
+#include "grid.hpp"
+#include "exceptions/invalid_cell_value_error.hpp"
+#include "exceptions/invalid_grid_hints_error.hpp"
+#include "exceptions/grid_dimension_mismatch_error.hpp"
+#include "../tools/exceptions/index_out_of_bounds_error.hpp"
+#include "../tools/string_tools.hpp"
+
+namespace Picross
+{
+    void throwFixedGridInvalidCell(int row, int col, int width, int height)
+    {
+        std::string s = "Invalid cell (" + std::to_string(row) + ", " + std::to_string(col) + ") for fixed grid with dimensions (" + std::to_string(height) + ", " + std::to_string(width) + ").";
+        throw IndexOutOfBoundsError(s);
+    }
+
+    void throwFixedGridInvalidCellValue(cell_t val)
+    {
+        // Same error as the one Grid raises for invalid values.
+        std::string s = "Invalid cell value " + cellValueToString(val) + ".";
+        throw InvalidCellValueError(s);
+    }
+
+    void throwFixedGridInvalidLine(bool isRow, int index, int length)
+    {
+        std::string s = "Invalid " + std::string(isRow ? "row " : "column ") + std::to_string(index) + " for fixed grid with " + (isRow ? "height " : "width ") + std::to_string(length) + ".";
+        throw IndexOutOfBoundsError(s);
+    }
+
+    void throwFixedGridInvalidHints(const std::vector<int>& hints, int length)
+    {
+        std::string s = "Hints " + StringTools::iterableToString(hints, ", ", "(", ")") + " do not fit in a fixed grid line of length " + std::to_string(length) + ", and thus are invalid.";
+        throw InvalidGridHintsError(s);
+    }
+
+    void throwFixedGridDimensionMismatch(int width, int height, int expectedWidth, int expectedHeight)
+    {
+        std::string s = "Grid with dimensions (" + std::to_string(height) + ", " + std::to_string(width) + ") cannot be converted to a fixed grid with dimensions (" + std::to_string(expectedHeight) + ", " + std::to_string(expectedWidth) + ").";
+        throw GridDimensionMismatchError(s);
+    }
+
+    // Explicit instantiations for the sizes of the mobile puzzle set.
+    template struct FixedHintSequence<5>;
+    template struct FixedHintSequence<10>;
+    template struct FixedHintSequence<15>;
+    template class FixedGrid<5, 5>;
+    template class FixedGrid<10, 10>;
+    template class FixedGrid<15, 15>;
+}
\ No newline at end of file
@@ -0,0 +1,445 @@
+#ifndef CORE__FIXED_GRID_HPP
+#define CORE__FIXED_GRID_HPP
+
+#include <array>
+#include <vector>
+
+#include "cell_t.hpp"
+#include "grid.hpp"
+
+namespace Picross
+{
+    // Throwing helpers shared by all FixedGrid instantiations. They live in the translation
+    // unit so that the constexpr methods below do not have to build any std::string.
+    [[noreturn]] void throwFixedGridInvalidCell(int row, int col, int width, int height);
+    [[noreturn]] void throwFixedGridInvalidCellValue(cell_t val);
+    [[noreturn]] void throwFixedGridInvalidLine(bool isRow, int index, int length);
+    [[noreturn]] void throwFixedGridInvalidHints(const std::vector<int>& hints, int length);
+    [[noreturn]] void throwFixedGridDimensionMismatch(int width, int height, int expectedWidth, int expectedHeight);
+
+    // Fixed-capacity hint sequence, able to hold all the hints of a line of length N.
+    template<int N>
+    struct FixedHintSequence
+    {
+        // A line of length N holds at most (N + 1) / 2 hints (alternating checked and crossed cells).
+        static constexpr int Capacity = (N + 1) / 2;
+
+        std::array<int, Capacity> values = {};
+        int count = 0;
+
+        // Returns the sum of all hints in the sequence.
+        constexpr int sum() const;
+        // Returns the minimum cell length needed for the sequence to be satisfied.
+        constexpr int minimumSpace() const;
+        // Tells whether the sequence fits in a line of length N.
+        constexpr bool fits() const;
+
+        // Conversion from and to the dynamic hint representation used by Grid.
+        static FixedHintSequence fromVector(const std::vector<int>& hints);
+        std::vector<int> toVector() const;
+
+        friend constexpr bool operator==(const FixedHintSequence& lhs, const FixedHintSequence& rhs)
+        {
+            if (lhs.count != rhs.count) return false;
+            for (int i = 0; i < lhs.count; i++)
+            {
+                if (lhs.values[i] != rhs.values[i]) return false;
+            }
+            return true;
+        }
+
+        friend constexpr bool operator!=(const FixedHintSequence& lhs, const FixedHintSequence& rhs)
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    // Grid whose dimensions are known at compile time. All storage is held in std::arrays,
+    // so instances live entirely on the stack and never allocate. Loops are bounded by
+    // template parameters, which lets the compiler fully unroll checks on small grids.
+    template<int W, int H>
+    class FixedGrid
+    {
+        static_assert(W > 0 && H > 0, "FixedGrid dimensions must be strictly positive.");
+
+        public:     // Types
+            using RowHints = FixedHintSequence<W>;
+            using ColHints = FixedHintSequence<H>;
+
+        private:    // Attributes
+            std::array<cell_t, W * H> _content;     // 1D-array containing the "unfolded" grid, row-major indexed.
+            std::array<RowHints, H> _rowHints;
+            std::array<ColHints, W> _colHints;
+
+        public:     // Public methods
+            constexpr FixedGrid();
+            // Throws if the dimensions of the provided grid are not W and H.
+            explicit FixedGrid(const Grid& grid);
+
+            // Convert back to a dynamic grid.
+            Grid toGrid() const;
+
+            static constexpr int getWidth();
+            static constexpr int getHeight();
+
+        // Cell access methods.
+            constexpr cell_t getCell(int row, int col) const;
+            constexpr void setCell(int row, int col, cell_t val);
+
+        // Hint access methods.
+            constexpr const RowHints& getRowHints(int row) const;
+            constexpr const ColHints& getColHints(int col) const;
+            constexpr void setRowHints(int row, const RowHints& hints);
+            constexpr void setColHints(int col, const ColHints& hints);
+
+        // Hint generation from grid state.
+            constexpr RowHints rowHintsFromState(int row) const;
+            constexpr ColHints colHintsFromState(int col) const;
+            constexpr void setHintsFromState();
+
+        // Useful checks.
+            constexpr bool hintsAreConsistent() const;
+            constexpr bool isSolved() const;
+
+            friend constexpr bool operator==(const FixedGrid& lhs, const FixedGrid& rhs)
+            {
+                for (int i = 0; i < W * H; i++)
+                {
+                    if (lhs._content[i] != rhs._content[i]) return false;
+                }
+                for (int i = 0; i < H; i++)
+                {
+                    if (lhs._rowHints[i] != rhs._rowHints[i]) return false;
+                }
+                for (int j = 0; j < W; j++)
+                {
+                    if (lhs._colHints[j] != rhs._colHints[j]) return false;
+                }
+                return true;
+            }
+
+            friend constexpr bool operator!=(const FixedGrid& lhs, const FixedGrid& rhs)
+            {
+                return !(lhs == rhs);
+            }
+
+        private:    // Private methods
+            // Count sequences of checked cells along a line, `stride` cells apart.
+            template<typename Hints, int Length>
+            constexpr Hints hintsFromCells(int start, int stride) const;
+    };
+
+    template<int N>
+    constexpr int FixedHintSequence<N>::sum() const
+    {
+        int result = 0;
+        for (int i = 0; i < count; i++)
+        {
+            result += values[i];
+        }
+        return result;
+    }
+
+    template<int N>
+    constexpr int FixedHintSequence<N>::minimumSpace() const
+    {
+        // Same as minimumSpaceFromHints: all hints plus a blank cell inbetween each of them.
+        return count ? sum() + count - 1 : -1;
+    }
+
+    template<int N>
+    constexpr bool FixedHintSequence<N>::fits() const
+    {
+        return minimumSpace() <= N;
+    }
+
+    template<int N>
+    FixedHintSequence<N> FixedHintSequence<N>::fromVector(const std::vector<int>& hints)
+    {
+        // Any sequence longer than the capacity cannot fit in a line of length N anyway.
+        if (hints.size() > Capacity)
+        {
+            throwFixedGridInvalidHints(hints, N);
+        }
+
+        FixedHintSequence<N> sequence;
+        for (auto it = hints.begin(); it != hints.end(); it++)
+        {
+            sequence.values[sequence.count++] = *it;
+        }
+
+        if (!sequence.fits())
+        {
+            throwFixedGridInvalidHints(hints, N);
+        }
+        return sequence;
+    }
+
+    template<int N>
+    std::vector<int> FixedHintSequence<N>::toVector() const
+    {
+        return std::vector<int>(values.begin(), values.begin() + count);
+    }
+
+    template<int W, int H>
+    constexpr FixedGrid<W, H>::FixedGrid() :
+        _content(),
+        _rowHints(),
+        _colHints()
+    {
+        for (int i = 0; i < W * H; i++)
+        {
+            _content[i] = CELL_CLEARED;
+        }
+    }
+
+    template<int W, int H>
+    FixedGrid<W, H>::FixedGrid(const Grid& grid) :
+        FixedGrid()
+    {
+        if (grid.getWidth() != W || grid.getHeight() != H)
+        {
+            throwFixedGridDimensionMismatch(grid.getWidth(), grid.getHeight(), W, H);
+        }
+
+        for (int i = 0; i < H; i++)
+        {
+            std::vector<cell_t> row = grid.getRow(i);
+            for (int j = 0; j < W; j++)
+            {
+                _content[(i * W) + j] = row[j];
+            }
+            _rowHints[i] = RowHints::fromVector(grid.getRowHints(i));
+        }
+
+        for (int j = 0; j < W; j++)
+        {
+            _colHints[j] = ColHints::fromVector(grid.getColHints(j));
+        }
+    }
+
+    template<int W, int H>
+    Grid FixedGrid<W, H>::toGrid() const
+    {
+        Grid grid = Grid(W, H);
+
+        for (int i = 0; i < H; i++)
+        {
+            for (int j = 0; j < W; j++)
+            {
+                grid.setCell(i, j, _content[(i * W) + j]);
+            }
+            grid.setRowHints(i, _rowHints[i].toVector());
+        }
+
+        for (int j = 0; j < W; j++)
+        {
+            grid.setColHints(j, _colHints[j].toVector());
+        }
+
+        return grid;
+    }
+
+    template<int W, int H>
+    constexpr int FixedGrid<W, H>::getWidth()
+    {
+        return W;
+    }
+
+    template<int W, int H>
+    constexpr int FixedGrid<W, H>::getHeight()
+    {
+        return H;
+    }
+
+    template<int W, int H>
+    constexpr cell_t FixedGrid<W, H>::getCell(int row, int col) const
+    {
+        if (row < 0 || row >= H || col < 0 || col >= W)
+        {
+            throwFixedGridInvalidCell(row, col, W, H);
+        }
+        return _content[(row * W) + col];
+    }
+
+    template<int W, int H>
+    constexpr void FixedGrid<W, H>::setCell(int row, int col, cell_t val)
+    {
+        if (row < 0 || row >= H || col < 0 || col >= W)
+        {
+            throwFixedGridInvalidCell(row, col, W, H);
+        }
+        if (val != CELL_CROSSED && val != CELL_CLEARED && val != CELL_CHECKED)
+        {
+            throwFixedGridInvalidCellValue(val);
+        }
+        _content[(row * W) + col] = val;
+    }
+
+    template<int W, int H>
+    constexpr const typename FixedGrid<W, H>::RowHints& FixedGrid<W, H>::getRowHints(int row) const
+    {
+        if (row < 0 || row >= H)
+        {
+            throwFixedGridInvalidLine(true, row, H);
+        }
+        return _rowHints[row];
+    }
+
+    template<int W, int H>
+    constexpr const typename FixedGrid<W, H>::ColHints& FixedGrid<W, H>::getColHints(int col) const
+    {
+        if (col < 0 || col >= W)
+        {
+            throwFixedGridInvalidLine(false, col, W);
+        }
+        return _colHints[col];
+    }
+
+    template<int W, int H>
+    constexpr void FixedGrid<W, H>::setRowHints(int row, const RowHints& hints)
+    {
+        if (row < 0 || row >= H)
+        {
+            throwFixedGridInvalidLine(true, row, H);
+        }
+        if (!hints.fits())
+        {
+            throwFixedGridInvalidHints(hints.toVector(), W);
+        }
+        _rowHints[row] = hints;
+    }
+
+    template<int W, int H>
+    constexpr void FixedGrid<W, H>::setColHints(int col, const ColHints& hints)
+    {
+        if (col < 0 || col >= W)
+        {
+            throwFixedGridInvalidLine(false, col, W);
+        }
+        if (!hints.fits())
+        {
+            throwFixedGridInvalidHints(hints.toVector(), H);
+        }
+        _colHints[col] = hints;
+    }
+
+    template<int W, int H>
+    template<typename Hints, int Length>
+    constexpr Hints FixedGrid<W, H>::hintsFromCells(int start, int stride) const
+    {
+        // Same algorithm as the free function hintsFromCells, without the intermediate vectors.
+        Hints hints;
+        int count = 0;
+
+        for (int i = 0; i < Length; i++)
+        {
+            if (_content[start + (i * stride)] == CELL_CHECKED)
+            {
+                count++;
+            }
+            else if (count)
+            {
+                hints.values[hints.count++] = count;
+                count = 0;
+            }
+        }
+
+        if (count)
+        {
+            hints.values[hints.count++] = count;
+        }
+
+        return hints;
+    }
+
+    template<int W, int H>
+    constexpr typename FixedGrid<W, H>::RowHints FixedGrid<W, H>::rowHintsFromState(int row) const
+    {
+        if (row < 0 || row >= H)
+        {
+            throwFixedGridInvalidLine(true, row, H);
+        }
+        return hintsFromCells<RowHints, W>(row * W, 1);
+    }
+
+    template<int W, int H>
+    constexpr typename FixedGrid<W, H>::ColHints FixedGrid<W, H>::colHintsFromState(int col) const
+    {
+        if (col < 0 || col >= W)
+        {
+            throwFixedGridInvalidLine(false, col, W);
+        }
+        return hintsFromCells<ColHints, H>(col, W);
+    }
+
+    template<int W, int H>
+    constexpr void FixedGrid<W, H>::setHintsFromState()
+    {
+        for (int i = 0; i < H; i++)
+        {
+            _rowHints[i] = hintsFromCells<RowHints, W>(i * W, 1);
+        }
+
+        for (int j = 0; j < W; j++)
+        {
+            _colHints[j] = hintsFromCells<ColHints, H>(j, W);
+        }
+    }
+
+    template<int W, int H>
+    constexpr bool FixedGrid<W, H>::hintsAreConsistent() const
+    {
+        // Hints are consistent if the sum of horizontal hints equals the sum of vertical hints.
+        int rowSum = 0;
+        for (int i = 0; i < H; i++)
+        {
+            rowSum += _rowHints[i].sum();
+        }
+
+        int colSum = 0;
+        for (int j = 0; j < W; j++)
+        {
+            colSum += _colHints[j].sum();
+        }
+
+        return rowSum == colSum;
+    }
+
+    template<int W, int H>
+    constexpr bool FixedGrid<W, H>::isSolved() const
+    {
+        // Simply return false if any row/column doesn't satisfy its corresponding hints.
+        for (int i = 0; i < H; i++)
+        {
+            if (hintsFromCells<RowHints, W>(i * W, 1) != _rowHints[i])
+            {
+                return false;
+            }
+        }
+
+        for (int j = 0; j < W; j++)
+        {
+            if (hintsFromCells<ColHints, H>(j, W) != _colHints[j])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Sizes of the mobile puzzle set, explicitly instantiated in fixed_grid.cpp.
+    using FixedGrid5x5 = FixedGrid<5, 5>;
+    using FixedGrid10x10 = FixedGrid<10, 10>;
+    using FixedGrid15x15 = FixedGrid<15, 15>;
+
+    extern template struct FixedHintSequence<5>;
+    extern template struct FixedHintSequence<10>;
+    extern template struct FixedHintSequence<15>;
+    extern template class FixedGrid<5, 5>;
+    extern template class FixedGrid<10, 10>;
+    extern template class FixedGrid<15, 15>;
+}
+
+#endif//CORE__FIXED_GRID_HPP
\ No newline at end of file
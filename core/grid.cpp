@@ -1,9 +1,12 @@
 #include "grid.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 #include <string>
 #include <iostream>
+#include <utility>
 
 #include "cell_t.hpp"
 #include "utility.hpp"
@@ -18,24 +21,30 @@ namespace Picross
 		_height(height),
 		_content(width * height, CELL_CLEARED),
 		_rowHints(height, std::vector<int>()),
-		_colHints(width, std::vector<int>())
+		_colHints(width, std::vector<int>()),
+		_cellCounts(),
+		_rowHintSum(0),
+		_colHintSum(0),
+		_hintVersion(newHintVersion())
 	{
-
+		_cellCounts[CELL_CLEARED] = width * height;
 	}
 
 	Grid::Grid(int width, int height, std::vector<std::vector<int>> horizontalHints, std::vector<std::vector<int>> verticalHints) :
 		_width(width),
 		_height(height),
 		_content(width * height, CELL_CLEARED),
-		_rowHints(horizontalHints),
-		_colHints(verticalHints)
+		_rowHints(std::move(horizontalHints)),
+		_colHints(std::move(verticalHints)),
+		_cellCounts(),
+		_rowHintSum(0),
+		_colHintSum(0),
+		_hintVersion(newHintVersion())
 	{
-		// Throw and cancel object creation if any hints are invalid.
-		// Catch all exceptions and throw a big one with the text of all of them.
-		bool exceptionCaught = false;
-		std::string exceptionText;
+		_cellCounts[CELL_CLEARED] = width * height;
 
-		// Throw if provided hints are a different size from the grid dimensions.
+		// Throw and cancel object creation if any hints are invalid.
+		// First, throw if provided hints are a different size from the grid dimensions.
 		if (_rowHints.size() != _height)
 		{
 			std::string str = "Number of provided horizontal hint entries (" + std::to_string(_rowHints.size()) + ") is different from grid height (" + std::to_string(_height) + ").";
@@ -48,39 +57,15 @@ namespace Picross
 			throw InvalidGridHintsError(str);
 		}
 
-		// Check whether all hints are valid. Catch any exception along the way and aggregate all text.
-		for (auto it = _rowHints.begin(); it != _rowHints.end(); it++)
+		// Check whether all hints are valid, and throw one exception describing all faulty lines.
+		// Messages are only built in case of failure.
+		std::vector<HintError> errors = findInvalidHints(_width, _height, _rowHints, _colHints);
+		if (!errors.empty())
 		{
-			try
-			{
-				areValidRowHints((*it), true);
-			}
-			catch(const InvalidGridHintsError& e)
-			{
-				exceptionCaught = true;
-				exceptionText += e.what();
-				exceptionText += '\n';
-			}
-		}
-
-		for (auto it = _colHints.begin(); it != _colHints.end(); it++)
-		{
-			try
-			{
-				areValidColHints((*it), true);
-			}
-			catch(const InvalidGridHintsError& e)
-			{
-				exceptionCaught = true;
-				exceptionText += e.what();
-				exceptionText += '\n';
-			}
+			throw InvalidGridHintsError(describeHintErrors(errors, _width, _height, _rowHints, _colHints));
 		}
 
-		if (exceptionCaught)
-		{
-			throw InvalidGridHintsError(exceptionText);
-		}
+		updateHintSums();
 	}
 
 	int Grid::getWidth() const
@@ -102,6 +87,14 @@ namespace Picross
 		return std::vector<cell_t>(begin, begin + _width);
 	}
 
+	const cell_t* Grid::getRowData(int row) const
+	{
+		// This will throw if the check fails (last parameter).
+		isValidRow(row, true);
+
+		return _content.data() + (_width * row);
+	}
+
 	std::vector<cell_t> Grid::getCol(int col) const
 	{
 		// This will throw if the check fails (last parameter).
@@ -144,6 +137,11 @@ namespace Picross
 		return _colHints[col];
 	}
 
+	std::uint64_t Grid::hintVersion() const
+	{
+		return _hintVersion;
+	}
+
 	cell_t Grid::getCell(int row, int col) const
 	{
 		// This will throw if the check fails (last parameter).
@@ -158,7 +156,7 @@ namespace Picross
 		isValidCell(row, col, true);
 		isValidCellValue(val, true);
 
-		_content[(row * _width) + col] = val;
+		setCellUnchecked((row * _width) + col, val);
 	}
 
 	void Grid::setCellRange(int i0, int in, int j0, int jn, cell_t val)
@@ -188,17 +186,40 @@ namespace Picross
 		{
 			for (int j = j0; j <= jn; j++)
 			{
-				_content[(i * _width) + j] = val;
+				setCellUnchecked((i * _width) + j, val);
 			}
 		}
 	}
 
+	void Grid::setRow(int row, const std::vector<cell_t>& values)
+	{
+		// This will throw if the check fails (last parameter).
+		isValidRow(row, true);
+
+		if ((int) values.size() != _width)
+		{
+			std::string s = "Cannot set row of " + std::to_string(values.size()) + " cells in grid of width " + std::to_string(_width) + ".";
+			throw IndexOutOfBoundsError(s.c_str());
+		}
+
+		for (cell_t val : values)
+		{
+			isValidCellValue(val, true);
+		}
+
+		int offset = row * _width;
+		for (int j = 0; j < _width; j++)
+		{
+			setCellUnchecked(offset + j, values[j]);
+		}
+	}
+
 	void Grid::checkCell(int row, int col)
 	{
 		// This will throw if the checks fail (last parameter).
 		isValidCell(row, col, true);
 
-		_content[(row * _width) + col] = CELL_CHECKED;
+		setCellUnchecked((row * _width) + col, CELL_CHECKED);
 	}
 
 	void Grid::crossCell(int row, int col)
@@ -206,7 +227,7 @@ namespace Picross
 		// This will throw if the checks fail (last parameter).
 		isValidCell(row, col, true);
 
-		_content[(row * _width) + col] = CELL_CROSSED;
+		setCellUnchecked((row * _width) + col, CELL_CROSSED);
 	}
 
 	void Grid::clearCell(int row, int col)
@@ -214,7 +235,7 @@ namespace Picross
 		// This will throw if the checks fail (last parameter).
 		isValidCell(row, col, true);
 
-		_content[(row * _width) + col] = CELL_CLEARED;
+		setCellUnchecked((row * _width) + col, CELL_CLEARED);
 	}
 
 	void Grid::setRowHints(int row, std::vector<int> hints)
@@ -223,7 +244,9 @@ namespace Picross
 		isValidRow(row, true);
 		areValidRowHints(hints, true);
 
-		_rowHints[row] = hints;
+		_rowHintSum += sumHints(hints) - sumHints(_rowHints[row]);
+		_rowHints[row] = std::move(hints);
+		_hintVersion = newHintVersion();
 	}
 
 	void Grid::setColHints(int col, std::vector<int> hints)
@@ -232,7 +255,9 @@ namespace Picross
 		isValidCol(col, true);
 		areValidColHints(hints, true);
 
-		_colHints[col] = hints;
+		_colHintSum += sumHints(hints) - sumHints(_colHints[col]);
+		_colHints[col] = std::move(hints);
+		_hintVersion = newHintVersion();
 	}
 
 	void Grid::setAllRowHints(std::vector<std::vector<int>> hints)
@@ -282,8 +307,10 @@ namespace Picross
 		}
 
 		// Assign those.
-		_rowHints = newRowHints;
-		_colHints = newColHints;
+		_rowHints = std::move(newRowHints);
+		_colHints = std::move(newColHints);
+		updateHintSums();
+		_hintVersion = newHintVersion();
 	}
 
 	void Grid::clearRowHints()
@@ -293,6 +320,8 @@ namespace Picross
 		{
 			_rowHints[i] = {};
 		}
+		_rowHintSum = 0;
+		_hintVersion = newHintVersion();
 	}
 
 	void Grid::clearColHints()
@@ -302,6 +331,8 @@ namespace Picross
 		{
 			_colHints[i] = {};
 		}
+		_colHintSum = 0;
+		_hintVersion = newHintVersion();
 	}
 
 	void Grid::clearAllHints()
@@ -347,11 +378,18 @@ namespace Picross
 	bool Grid::hintsAreConsistent() const
 	{
 		// Hints are consistent if the sum of horinzontal hints equals the sum of vertical hints. 
-		return IterTools::sum2NestedIterables<int>(_rowHints) == IterTools::sum2NestedIterables<int>(_colHints);
+		return _rowHintSum == _colHintSum;
 	}
 
 	bool Grid::isSolved() const
 	{
+		// A solved grid has exactly as many checked cells as the sum of its row hints.
+		// This constant-time count rejects most unsolved grids before any line is looked at.
+		if (_rowHintSum != _cellCounts[CELL_CHECKED])
+		{
+			return false;
+		}
+
 		// Simply return false if any row/column doesn't satisfty its corresponding hints.
 		for (int i = 0; i < _height; i++)
 		{
@@ -374,32 +412,31 @@ namespace Picross
 
     cell_t Grid::mostPresentState() const
     {
-        // Array to count occurrences of each cell value.
-        int counts[CELL_T_VALUE_COUNT] = {0};
-
-        // Traverse provided grid and increase counts accordingly.
-        for (int row = 0; row < getHeight(); row++)
-        {
-            for (int col = 0; col < getWidth(); col++)
-            {
-                counts[getCell(row, col)]++;
-
-                // This works because the underlying values of cell values
-                // start from 0 and go up in 1-increments, which corresponds
-                // to the indexing of the `counts` array.
-                //
-                // As a side effect, the layout of that array exactly matches
-                // that of CELL_T_ORDERED_VALUES, which allows to map counts
-                // and values on the same index (used in the return statement below).
-            }
-        }
-
-        // Find max index and return appropriate value.
-		// Arguments here are iterators (pointers really) the begining of the array and its element count.
-        int maxIndex = IterTools::indexOfMaxElement(counts, CELL_T_VALUE_COUNT);
+        // Cell counts are indexed by cell value: this works because the underlying
+        // values of cell values start from 0 and go up in 1-increments.
+        //
+        // As a side effect, the layout of that array exactly matches
+        // that of CELL_T_ORDERED_VALUES, which allows to map counts
+        // and values on the same index (used in the return statement below).
+        int maxIndex = IterTools::indexOfMaxElement(_cellCounts);
         return CELL_T_ORDERED_VALUES[maxIndex];
     }
 
+	int Grid::getCellCount(cell_t val) const
+	{
+		// This will throw if the check fails (last parameter).
+		isValidCellValue(val, true);
+
+		return _cellCounts[val];
+	}
+
+	double Grid::fillRatio() const
+	{
+		if (_content.empty()) return 0.;
+
+		return static_cast<double>(_cellCounts[CELL_CHECKED]) / _content.size();
+	}
+
 	bool Grid::areValidRowHints(const std::vector<int>& hints, bool throwOnFail) const
 	{
 		// Check whether provided hints fit in a row of the grid.
@@ -407,8 +444,7 @@ namespace Picross
 		bool valid = space <= _width;
 		if (throwOnFail && !valid)
 		{
-			std::string s = "Hints " + StringTools::iterableToString(hints, ", ", "(", ")") + " require minimum space " + std::to_string(space) + " which exceeds grid width (" + std::to_string(_width) + "), and thus are invalid.";
-			throw InvalidGridHintsError(s);
+			throw InvalidGridHintsError(invalidHintsMessage(hints, space, true, _width));
 		}
 		return valid;
 	}
@@ -420,12 +456,50 @@ namespace Picross
 		bool valid = space <= _height;
 		if (throwOnFail && !valid)
 		{
-			std::string s = "Hints " + StringTools::iterableToString(hints, ", ", "(", ")") + " require minimum space " + std::to_string(space) + " which exceeds grid height (" + std::to_string(_height) + "), and thus are invalid.";
-			throw InvalidGridHintsError(s);
+			throw InvalidGridHintsError(invalidHintsMessage(hints, space, false, _height));
 		}
 		return valid;
 	}
 
+	std::vector<Grid::HintError> Grid::findInvalidHints(int width, int height, const std::vector<std::vector<int>>& rowHints, const std::vector<std::vector<int>>& colHints)
+	{
+		// The returned vector only allocates once an error is pushed into it.
+		std::vector<HintError> errors;
+
+		for (int i = 0; i < (int) rowHints.size(); i++)
+		{
+			int space = minimumSpaceFromHints(rowHints[i]);
+			if (space > width)
+			{
+				errors.push_back({true, i, space});
+			}
+		}
+
+		for (int j = 0; j < (int) colHints.size(); j++)
+		{
+			int space = minimumSpaceFromHints(colHints[j]);
+			if (space > height)
+			{
+				errors.push_back({false, j, space});
+			}
+		}
+
+		return errors;
+	}
+
+	std::string Grid::describeHintErrors(const std::vector<HintError>& errors, int width, int height, const std::vector<std::vector<int>>& rowHints, const std::vector<std::vector<int>>& colHints)
+	{
+		// One line per error, in the same form as the exceptions thrown by areValidRowHints/areValidColHints.
+		std::string s;
+		for (auto it = errors.begin(); it != errors.end(); it++)
+		{
+			const std::vector<int>& hints = it->isRow ? rowHints[it->index] : colHints[it->index];
+			s += invalidHintsMessage(hints, it->requiredSpace, it->isRow, it->isRow ? width : height);
+			s += '\n';
+		}
+		return s;
+	}
+
 	bool operator==(const Grid& lhs, const Grid& rhs)
 	{
 		// Return false if any member is not equal in both grids.
@@ -442,4 +516,31 @@ namespace Picross
 	{
 		return !(lhs == rhs);
 	}
+
+	void Grid::updateHintSums()
+	{
+		_rowHintSum = IterTools::sum2NestedIterables<int>(_rowHints);
+		_colHintSum = IterTools::sum2NestedIterables<int>(_colHints);
+	}
+
+	std::uint64_t Grid::newHintVersion()
+	{
+		// Shared by all grids, so that a stamp identifies a single set of hints even across grids.
+		static std::atomic<std::uint64_t> nextVersion(1);
+		return nextVersion++;
+	}
+
+	std::string Grid::invalidHintsMessage(const std::vector<int>& hints, int space, bool isRow, int length)
+	{
+		std::string dimension = isRow ? "width" : "height";
+		return "Hints " + StringTools::iterableToString(hints, ", ", "(", ")") + " require minimum space " + std::to_string(space) + " which exceeds grid " + dimension + " (" + std::to_string(length) + "), and thus are invalid.";
+	}
+
+	void Grid::setCellUnchecked(int index, cell_t val)
+	{
+		// Move the cell from its previous state count to its new one.
+		_cellCounts[_content[index]]--;
+		_cellCounts[val]++;
+		_content[index] = val;
+	}
 }
\ No newline at end of file
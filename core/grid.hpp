@@ -1,6 +1,8 @@
 #ifndef CORE__GRID_HPP
 #define CORE__GRID_HPP
 
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -12,12 +14,25 @@ namespace Picross
 	
 	class Grid
 	{
+		public:		// Types
+			// Compact description of a hint sequence which does not fit in its line.
+			struct HintError
+			{
+				bool isRow;			// Whether the faulty hints are row hints or column hints.
+				int index;			// Index of the row or column holding the faulty hints.
+				int requiredSpace;	// Minimum space required by the hints.
+			};
+
 		private:	// Attributes
 			int _width;
 			int _height;
 			std::vector<cell_t> _content;			// 1D-array containing the "unfolded" grid, row-major indexed.
 			std::vector<std::vector<int>> _rowHints;
 			std::vector<std::vector<int>> _colHints;
+			std::array<int, CELL_T_VALUE_COUNT> _cellCounts;	// Number of cells in each state, indexed by cell value, kept up to date on mutation.
+			int _rowHintSum;										// Sum of all row hints, kept up to date on mutation.
+			int _colHintSum;										// Sum of all column hints, kept up to date on mutation.
+			std::uint64_t _hintVersion;								// Stamp of the current hints, see hintVersion().
 
 		public:		// Public methods
 			Grid(int width, int height);
@@ -29,16 +44,23 @@ namespace Picross
 		// These return COPIES only. Modifications to the grid content and hints to be made through the appropriate methods.
 			std::vector<cell_t> getRow(int row) const;
 			std::vector<cell_t> getCol(int col) const;
+			// Read-only view of the cells of a row, valid until the grid is resized or destroyed.
+			const cell_t* getRowData(int row) const;
 
 			std::vector<std::vector<int>> getAllRowHints() const;
 			std::vector<int> getRowHints(int row) const;
 			std::vector<std::vector<int>> getAllColHints() const;
 			std::vector<int> getColHints(int col) const;
+			// Stamp taking a new, never used value whenever hints are modified, and carried over by copies.
+			// Grids with the same stamp have the same hints, which allows caching anything derived from them.
+			std::uint64_t hintVersion() const;
 
 		// Cell modification methods.
 			cell_t getCell(int row, int col) const;
 			void setCell(int row, int col, cell_t val);
 			void setCellRange(int i0, int in, int j0, int jn, cell_t val);
+			// Overwrite a whole row at once, validating every value before any cell is modified.
+			void setRow(int row, const std::vector<cell_t>& values);
 			void checkCell(int row, int col);
 			void crossCell(int row, int col);
 			void clearCell(int row, int col);
@@ -60,15 +82,35 @@ namespace Picross
 			bool hintsAreConsistent() const;
 			bool isSolved() const;
 		
-		// Return the cell value which is most present within a grid.
+		// Cell statistics, all constant-time.
+			// Return the cell value which is most present within a grid.
 			cell_t mostPresentState() const;
+			// Return how many cells of the grid are in the provided state.
+			int getCellCount(cell_t val) const;
+			// Return the ratio of checked cells over the total cell count (0 for an empty grid).
+			double fillRatio() const;
 
 		// Useful hint-related checks and functions.
 			bool areValidRowHints(const std::vector<int>& hints, bool throwOnFail = false) const;
 			bool areValidColHints(const std::vector<int>& hints, bool throwOnFail = false) const;
+			// Non-throwing validation of hints against grid dimensions, which only allocates when errors are found.
+			// Hint entry counts are assumed to match the dimensions.
+			static std::vector<HintError> findInvalidHints(int width, int height, const std::vector<std::vector<int>>& rowHints, const std::vector<std::vector<int>>& colHints);
+			// Build a readable message out of hint errors found by the above method.
+			static std::string describeHintErrors(const std::vector<HintError>& errors, int width, int height, const std::vector<std::vector<int>>& rowHints, const std::vector<std::vector<int>>& colHints);
 
 			friend bool operator==(const Grid& lhs, const Grid& rhs);
 			friend bool operator!=(const Grid& lhs, const Grid& rhs);
+
+		private:	// Private methods
+			// Set a cell without any check, keeping cell counts up to date.
+			void setCellUnchecked(int index, cell_t val);
+			// Recompute cached hint sums from scratch.
+			void updateHintSums();
+			// Get a hint version stamp which was never used before, in any grid.
+			static std::uint64_t newHintVersion();
+			// Build the message describing invalid hints for a line of the given length.
+			static std::string invalidHintsMessage(const std::vector<int>& hints, int space, bool isRow, int length);
 	};
 }
 
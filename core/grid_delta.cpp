@@ -0,0 +1,398 @@
+#include "grid_delta.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "cell_t.hpp"
+#include "grid.hpp"
+#include "exceptions/grid_dimension_mismatch_error.hpp"
+#include "exceptions/invalid_grid_delta_error.hpp"
+#include "../tools/exceptions/index_out_of_bounds_error.hpp"
+#include "../tools/varint_tools.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        // Version tag written as the first byte of a serialized delta.
+        const unsigned char DELTA_FORMAT_VERSION = 1;
+
+        // Map signed index gaps to unsigned values so that small gaps of either sign stay small.
+        std::uint64_t zigzagEncode(std::int64_t value)
+        {
+            return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+        }
+
+        std::int64_t zigzagDecode(std::uint64_t value)
+        {
+            return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+        }
+
+        void appendHints(std::string& out, const std::vector<int>& hints)
+        {
+            VarintTools::appendVarint(out, hints.size());
+            for (auto it = hints.begin(); it != hints.end(); it++)
+            {
+                VarintTools::appendVarint(out, static_cast<std::uint64_t>(*it));
+            }
+        }
+
+        // Read a varint and throw if the data is truncated or the value exceeds the given maximum.
+        std::uint64_t readValueOrThrow(const unsigned char*& cursor, const unsigned char* end, std::uint64_t max = std::numeric_limits<int>::max())
+        {
+            std::uint64_t value;
+            if (!VarintTools::readVarint(cursor, end, value))
+            {
+                throw InvalidGridDeltaError("Serialized grid delta is truncated or corrupted.");
+            }
+            if (value > max)
+            {
+                throw InvalidGridDeltaError("Serialized grid delta contains an out of range value (" + std::to_string(value) + ").");
+            }
+            return value;
+        }
+
+        std::vector<int> readHints(const unsigned char*& cursor, const unsigned char* end)
+        {
+            // A hint sequence cannot hold more values than there are bytes left.
+            std::uint64_t count = readValueOrThrow(cursor, end, end - cursor);
+
+            std::vector<int> hints;
+            hints.reserve(count);
+            for (std::uint64_t i = 0; i < count; i++)
+            {
+                hints.push_back(static_cast<int>(readValueOrThrow(cursor, end)));
+            }
+            return hints;
+        }
+    }
+
+    GridDelta::GridDelta(int width, int height) :
+        _width(width),
+        _height(height),
+        _cellChanges(),
+        _hintChanges()
+    {
+
+    }
+
+    int GridDelta::getWidth() const
+    {
+        return _width;
+    }
+
+    int GridDelta::getHeight() const
+    {
+        return _height;
+    }
+
+    const std::vector<GridDelta::CellChange>& GridDelta::getCellChanges() const
+    {
+        return _cellChanges;
+    }
+
+    const std::vector<GridDelta::HintChange>& GridDelta::getHintChanges() const
+    {
+        return _hintChanges;
+    }
+
+    void GridDelta::addCellChange(int row, int col, cell_t oldValue, cell_t newValue)
+    {
+        if (row < 0 || row >= _height || col < 0 || col >= _width)
+        {
+            std::string s = "Invalid cell (" + std::to_string(row) + ", " + std::to_string(col) + ") for grid delta with dimensions (" + std::to_string(_height) + ", " + std::to_string(_width) + ").";
+            throw IndexOutOfBoundsError(s);
+        }
+
+        _cellChanges.push_back({(row * _width) + col, oldValue, newValue});
+    }
+
+    void GridDelta::addRowHintChange(int row, std::vector<int> oldHints, std::vector<int> newHints)
+    {
+        if (row < 0 || row >= _height)
+        {
+            std::string s = "Invalid row " + std::to_string(row) + " for grid delta with height " + std::to_string(_height) + ".";
+            throw IndexOutOfBoundsError(s);
+        }
+
+        _hintChanges.push_back({true, row, oldHints, newHints});
+    }
+
+    void GridDelta::addColHintChange(int col, std::vector<int> oldHints, std::vector<int> newHints)
+    {
+        if (col < 0 || col >= _width)
+        {
+            std::string s = "Invalid column " + std::to_string(col) + " for grid delta with width " + std::to_string(_width) + ".";
+            throw IndexOutOfBoundsError(s);
+        }
+
+        _hintChanges.push_back({false, col, oldHints, newHints});
+    }
+
+    bool GridDelta::empty() const
+    {
+        return _cellChanges.empty() && _hintChanges.empty();
+    }
+
+    int GridDelta::size() const
+    {
+        return _cellChanges.size() + _hintChanges.size();
+    }
+
+    GridDelta GridDelta::inverted() const
+    {
+        // Swap old and new values everywhere, and replay changes in reverse order
+        // so that repeated changes to the same cell or line unwind properly.
+        GridDelta inverse = GridDelta(_width, _height);
+        inverse._cellChanges.reserve(_cellChanges.size());
+        inverse._hintChanges.reserve(_hintChanges.size());
+
+        for (auto it = _cellChanges.rbegin(); it != _cellChanges.rend(); it++)
+        {
+            inverse._cellChanges.push_back({it->index, it->newValue, it->oldValue});
+        }
+
+        for (auto it = _hintChanges.rbegin(); it != _hintChanges.rend(); it++)
+        {
+            inverse._hintChanges.push_back({it->isRow, it->index, it->newHints, it->oldHints});
+        }
+
+        return inverse;
+    }
+
+    std::string GridDelta::serialize() const
+    {
+        // Layout:
+        // - version byte
+        // - width, height
+        // - cell change count, then one varint per change: (zigzag(index gap) << 4) | (old << 2) | new
+        // - hint change count, then per change: (index << 1) | isRow, old hint sequence, new hint sequence
+        //   (each sequence being its length followed by its values)
+        std::string out;
+        out.reserve(8 + (_cellChanges.size() * 2));
+        out += static_cast<char>(DELTA_FORMAT_VERSION);
+
+        VarintTools::appendVarint(out, _width);
+        VarintTools::appendVarint(out, _height);
+
+        VarintTools::appendVarint(out, _cellChanges.size());
+        std::int64_t previousIndex = -1;
+        for (auto it = _cellChanges.begin(); it != _cellChanges.end(); it++)
+        {
+            std::uint64_t gap = zigzagEncode(it->index - previousIndex);
+            VarintTools::appendVarint(out, (gap << 4) | ((it->oldValue & 0x3) << 2) | (it->newValue & 0x3));
+            previousIndex = it->index;
+        }
+
+        VarintTools::appendVarint(out, _hintChanges.size());
+        for (auto it = _hintChanges.begin(); it != _hintChanges.end(); it++)
+        {
+            VarintTools::appendVarint(out, (static_cast<std::uint64_t>(it->index) << 1) | (it->isRow ? 1 : 0));
+            appendHints(out, it->oldHints);
+            appendHints(out, it->newHints);
+        }
+
+        return out;
+    }
+
+    GridDelta GridDelta::deserialize(const std::string& data)
+    {
+        const unsigned char* cursor = reinterpret_cast<const unsigned char*>(data.data());
+        const unsigned char* end = cursor + data.size();
+
+        if (cursor == end || *cursor != DELTA_FORMAT_VERSION)
+        {
+            throw InvalidGridDeltaError("Serialized grid delta has an unknown format version.");
+        }
+        cursor++;
+
+        int width = readValueOrThrow(cursor, end);
+        int height = readValueOrThrow(cursor, end);
+        GridDelta delta = GridDelta(width, height);
+
+        // Every change takes up at least one byte, which bounds the counts read below.
+        std::uint64_t cellCount = readValueOrThrow(cursor, end, end - cursor);
+        delta._cellChanges.reserve(cellCount);
+        std::int64_t index = -1;
+        for (std::uint64_t i = 0; i < cellCount; i++)
+        {
+            std::uint64_t packed = readValueOrThrow(cursor, end, std::numeric_limits<std::uint64_t>::max());
+            index += zigzagDecode(packed >> 4);
+            if (index < 0 || index >= static_cast<std::int64_t>(width) * height)
+            {
+                throw InvalidGridDeltaError("Serialized grid delta contains a cell index out of grid bounds.");
+            }
+
+            cell_t oldValue = (packed >> 2) & 0x3;
+            cell_t newValue = packed & 0x3;
+            if (!isValidCellValue(oldValue) || !isValidCellValue(newValue))
+            {
+                throw InvalidGridDeltaError("Serialized grid delta contains an invalid cell value.");
+            }
+            delta._cellChanges.push_back({static_cast<int>(index), oldValue, newValue});
+        }
+
+        std::uint64_t hintCount = readValueOrThrow(cursor, end, end - cursor);
+        delta._hintChanges.reserve(hintCount);
+        for (std::uint64_t i = 0; i < hintCount; i++)
+        {
+            std::uint64_t packed = readValueOrThrow(cursor, end);
+            bool isRow = packed & 1;
+            int lineIndex = packed >> 1;
+            if (lineIndex >= (isRow ? height : width))
+            {
+                throw InvalidGridDeltaError("Serialized grid delta contains a hint line index out of grid bounds.");
+            }
+
+            std::vector<int> oldHints = readHints(cursor, end);
+            std::vector<int> newHints = readHints(cursor, end);
+            delta._hintChanges.push_back({isRow, lineIndex, oldHints, newHints});
+        }
+
+        if (cursor != end)
+        {
+            throw InvalidGridDeltaError("Serialized grid delta has trailing data.");
+        }
+
+        return delta;
+    }
+
+    bool operator==(const GridDelta& lhs, const GridDelta& rhs)
+    {
+        if (lhs._width != rhs._width) return false;
+        if (lhs._height != rhs._height) return false;
+        if (lhs._cellChanges.size() != rhs._cellChanges.size()) return false;
+        if (lhs._hintChanges.size() != rhs._hintChanges.size()) return false;
+
+        for (std::size_t i = 0; i < lhs._cellChanges.size(); i++)
+        {
+            const GridDelta::CellChange& l = lhs._cellChanges[i];
+            const GridDelta::CellChange& r = rhs._cellChanges[i];
+            if (l.index != r.index || l.oldValue != r.oldValue || l.newValue != r.newValue) return false;
+        }
+
+        for (std::size_t i = 0; i < lhs._hintChanges.size(); i++)
+        {
+            const GridDelta::HintChange& l = lhs._hintChanges[i];
+            const GridDelta::HintChange& r = rhs._hintChanges[i];
+            if (l.isRow != r.isRow || l.index != r.index || l.oldHints != r.oldHints || l.newHints != r.newHints) return false;
+        }
+
+        return true;
+    }
+
+    bool operator!=(const GridDelta& lhs, const GridDelta& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    GridDelta diff(const Grid& from, const Grid& to, bool includeHints)
+    {
+        int width = from.getWidth();
+        int height = from.getHeight();
+
+        if (to.getWidth() != width || to.getHeight() != height)
+        {
+            std::string s = "Cannot compute the delta between grids with dimensions (" + std::to_string(height) + ", " + std::to_string(width) + ") and (" + std::to_string(to.getHeight()) + ", " + std::to_string(to.getWidth()) + ").";
+            throw GridDimensionMismatchError(s);
+        }
+
+        GridDelta delta = GridDelta(width, height);
+
+        // Compare grids row by row, registering every differing cell.
+        for (int i = 0; i < height; i++)
+        {
+            std::vector<cell_t> fromRow = from.getRow(i);
+            std::vector<cell_t> toRow = to.getRow(i);
+            if (fromRow == toRow) continue;
+
+            for (int j = 0; j < width; j++)
+            {
+                if (fromRow[j] != toRow[j])
+                {
+                    delta.addCellChange(i, j, fromRow[j], toRow[j]);
+                }
+            }
+        }
+
+        if (includeHints)
+        {
+            for (int i = 0; i < height; i++)
+            {
+                std::vector<int> fromHints = from.getRowHints(i);
+                std::vector<int> toHints = to.getRowHints(i);
+                if (fromHints != toHints)
+                {
+                    delta.addRowHintChange(i, fromHints, toHints);
+                }
+            }
+
+            for (int j = 0; j < width; j++)
+            {
+                std::vector<int> fromHints = from.getColHints(j);
+                std::vector<int> toHints = to.getColHints(j);
+                if (fromHints != toHints)
+                {
+                    delta.addColHintChange(j, fromHints, toHints);
+                }
+            }
+        }
+
+        return delta;
+    }
+
+    void apply(Grid& grid, const GridDelta& delta)
+    {
+        int width = grid.getWidth();
+
+        if (delta.getWidth() != width || delta.getHeight() != grid.getHeight())
+        {
+            std::string s = "Cannot apply a delta with dimensions (" + std::to_string(delta.getHeight()) + ", " + std::to_string(delta.getWidth()) + ") onto a grid with dimensions (" + std::to_string(grid.getHeight()) + ", " + std::to_string(width) + ").";
+            throw GridDimensionMismatchError(s);
+        }
+
+        // Validate every change before modifying anything, so that a faulty delta is not half-applied.
+        // These checks will throw on fails (last parameter).
+        const std::vector<GridDelta::CellChange>& cellChanges = delta.getCellChanges();
+        for (auto it = cellChanges.begin(); it != cellChanges.end(); it++)
+        {
+            grid.isValidCell(it->index / width, it->index % width, true);
+            isValidCellValue(it->newValue, true);
+        }
+
+        const std::vector<GridDelta::HintChange>& hintChanges = delta.getHintChanges();
+        for (auto it = hintChanges.begin(); it != hintChanges.end(); it++)
+        {
+            if (it->isRow)
+            {
+                grid.isValidRow(it->index, true);
+                grid.areValidRowHints(it->newHints, true);
+            }
+            else
+            {
+                grid.isValidCol(it->index, true);
+                grid.areValidColHints(it->newHints, true);
+            }
+        }
+
+        // Only touch the cells and lines recorded in the delta.
+        for (auto it = cellChanges.begin(); it != cellChanges.end(); it++)
+        {
+            grid.setCell(it->index / width, it->index % width, it->newValue);
+        }
+
+        for (auto it = hintChanges.begin(); it != hintChanges.end(); it++)
+        {
+            if (it->isRow)
+            {
+                grid.setRowHints(it->index, it->newHints);
+            }
+            else
+            {
+                grid.setColHints(it->index, it->newHints);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef CORE__GRID_DELTA_HPP
+#define CORE__GRID_DELTA_HPP
+
+#include <string>
+#include <vector>
+
+#include "cell_t.hpp"
+#include "grid.hpp"
+
+namespace Picross
+{
+    // Describes the cells (and optionally hints) which differ between two grids of the same dimensions.
+    // Both the previous and the new values are recorded, so that a delta can also be undone.
+    class GridDelta
+    {
+        public:     // Types
+            struct CellChange
+            {
+                int index;                      // Row-major index of the cell.
+                cell_t oldValue;
+                cell_t newValue;
+            };
+
+            struct HintChange
+            {
+                bool isRow;                     // Whether the change targets row hints or column hints.
+                int index;                      // Index of the row or column.
+                std::vector<int> oldHints;
+                std::vector<int> newHints;
+            };
+
+        private:    // Attributes
+            int _width;
+            int _height;
+            std::vector<CellChange> _cellChanges;   // Sorted by cell index when produced by diff().
+            std::vector<HintChange> _hintChanges;
+
+        public:     // Public methods
+            GridDelta(int width, int height);
+
+            int getWidth() const;
+            int getHeight() const;
+
+            const std::vector<CellChange>& getCellChanges() const;
+            const std::vector<HintChange>& getHintChanges() const;
+
+        // Record changes. Cell coordinates are checked against the delta dimensions.
+            void addCellChange(int row, int col, cell_t oldValue, cell_t newValue);
+            void addRowHintChange(int row, std::vector<int> oldHints, std::vector<int> newHints);
+            void addColHintChange(int col, std::vector<int> oldHints, std::vector<int> newHints);
+
+            // Whether the delta holds no change at all.
+            bool empty() const;
+            // Number of recorded changes (cells and hint lines).
+            int size() const;
+
+            // Returns the delta which reverts this one.
+            GridDelta inverted() const;
+
+        // Compact binary form: varint-packed fields, cell indices stored as gaps from the previous one.
+            std::string serialize() const;
+            static GridDelta deserialize(const std::string& data);
+
+            friend bool operator==(const GridDelta& lhs, const GridDelta& rhs);
+            friend bool operator!=(const GridDelta& lhs, const GridDelta& rhs);
+    };
+
+    // Compute the delta turning grid `from` into grid `to`. Throws if their dimensions differ.
+    GridDelta diff(const Grid& from, const Grid& to, bool includeHints = true);
+
+    // Apply a delta onto a grid, in time proportional to the size of the delta. Throws if dimensions differ.
+    // All changes are validated first: if any new value or hint is invalid, the grid is left untouched.
+    // Old values are not checked against the grid, they only serve inverted(): applying a delta onto a grid
+    // which already holds its new values changes nothing, which keeps journal replays idempotent.
+    void apply(Grid& grid, const GridDelta& delta);
+}
+
+#endif//CORE__GRID_DELTA_HPP
\ No newline at end of file
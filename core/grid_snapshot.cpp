@@ -0,0 +1,196 @@
+#include "grid_snapshot.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cell_t.hpp"
+#include "grid.hpp"
+#include "../tools/exceptions/index_out_of_bounds_error.hpp"
+
+namespace Picross
+{
+    GridSnapshot::GridSnapshot(const Grid& grid) :
+        _width(grid.getWidth()),
+        _height(grid.getHeight()),
+        _version(0),
+        _rows(),
+        _rowHints(std::make_shared<const std::vector<std::vector<int>>>(grid.getAllRowHints())),
+        _colHints(std::make_shared<const std::vector<std::vector<int>>>(grid.getAllColHints()))
+    {
+        _rows.reserve(_height);
+        for (int i = 0; i < _height; i++)
+        {
+            _rows.push_back(std::make_shared<const Row>(grid.getRow(i)));
+        }
+    }
+
+    GridSnapshot::GridSnapshot(const GridSnapshot& other, unsigned long version) :
+        _width(other._width),
+        _height(other._height),
+        _version(version),
+        _rows(other._rows),
+        _rowHints(other._rowHints),
+        _colHints(other._colHints)
+    {
+
+    }
+
+    GridSnapshot GridSnapshot::update(const Grid& grid) const
+    {
+        // Dimension changes leave nothing to share.
+        if (grid.getWidth() != _width || grid.getHeight() != _height)
+        {
+            GridSnapshot fresh = GridSnapshot(grid);
+            fresh._version = _version + 1;
+            return fresh;
+        }
+
+        GridSnapshot next = GridSnapshot(*this, _version + 1);
+
+        // Only allocate new storage for the rows which changed.
+        for (int i = 0; i < _height; i++)
+        {
+            Row row = grid.getRow(i);
+            if (row != *_rows[i])
+            {
+                next._rows[i] = std::make_shared<const Row>(std::move(row));
+            }
+        }
+
+        std::vector<std::vector<int>> rowHints = grid.getAllRowHints();
+        if (rowHints != *_rowHints)
+        {
+            next._rowHints = std::make_shared<const std::vector<std::vector<int>>>(std::move(rowHints));
+        }
+
+        std::vector<std::vector<int>> colHints = grid.getAllColHints();
+        if (colHints != *_colHints)
+        {
+            next._colHints = std::make_shared<const std::vector<std::vector<int>>>(std::move(colHints));
+        }
+
+        return next;
+    }
+
+    GridSnapshot GridSnapshot::withCell(int row, int col, cell_t val) const
+    {
+        // This will throw if the check fails (last parameter).
+        isValidCellValue(val, true);
+        getCell(row, col);
+
+        GridSnapshot next = GridSnapshot(*this, _version + 1);
+
+        // Copy the one row being modified.
+        Row newRow = *_rows[row];
+        newRow[col] = val;
+        next._rows[row] = std::make_shared<const Row>(std::move(newRow));
+
+        return next;
+    }
+
+    int GridSnapshot::getWidth() const
+    {
+        return _width;
+    }
+
+    int GridSnapshot::getHeight() const
+    {
+        return _height;
+    }
+
+    unsigned long GridSnapshot::getVersion() const
+    {
+        return _version;
+    }
+
+    cell_t GridSnapshot::getCell(int row, int col) const
+    {
+        if (row < 0 || row >= _height || col < 0 || col >= _width)
+        {
+            std::string s = "Invalid cell (" + std::to_string(row) + ", " + std::to_string(col) + ") for grid snapshot with dimensions (" + std::to_string(_height) + ", " + std::to_string(_width) + ").";
+            throw IndexOutOfBoundsError(s);
+        }
+
+        return (*_rows[row])[col];
+    }
+
+    const GridSnapshot::Row& GridSnapshot::getRow(int row) const
+    {
+        if (row < 0 || row >= _height)
+        {
+            std::string s = "Invalid row " + std::to_string(row) + " for grid snapshot with height " + std::to_string(_height) + ".";
+            throw IndexOutOfBoundsError(s);
+        }
+
+        return *_rows[row];
+    }
+
+    const std::vector<std::vector<int>>& GridSnapshot::getAllRowHints() const
+    {
+        return *_rowHints;
+    }
+
+    const std::vector<std::vector<int>>& GridSnapshot::getAllColHints() const
+    {
+        return *_colHints;
+    }
+
+    bool GridSnapshot::sharesRowWith(const GridSnapshot& other, int row) const
+    {
+        if (row < 0 || row >= _height || row >= other._height) return false;
+
+        return _rows[row] == other._rows[row];
+    }
+
+    Grid GridSnapshot::toGrid() const
+    {
+        Grid grid = Grid(_width, _height, *_rowHints, *_colHints);
+
+        for (int i = 0; i < _height; i++)
+        {
+            const Row& row = *_rows[i];
+            for (int j = 0; j < _width; j++)
+            {
+                grid.setCell(i, j, row[j]);
+            }
+        }
+
+        return grid;
+    }
+
+    GridSnapshotPublisher::GridSnapshotPublisher() :
+        _current(nullptr)
+    {
+
+    }
+
+    GridSnapshotPublisher::GridSnapshotPublisher(const Grid& grid) :
+        _current(std::make_shared<const GridSnapshot>(grid))
+    {
+
+    }
+
+    GridSnapshotPtr GridSnapshotPublisher::current() const
+    {
+        return std::atomic_load(&_current);
+    }
+
+    void GridSnapshotPublisher::publish(GridSnapshotPtr snapshot)
+    {
+        std::atomic_store(&_current, std::move(snapshot));
+    }
+
+    GridSnapshotPtr GridSnapshotPublisher::publish(const Grid& grid)
+    {
+        // Build the next version off the current one so that unchanged rows are shared.
+        GridSnapshotPtr previous = current();
+        GridSnapshotPtr next = previous
+            ? std::make_shared<const GridSnapshot>(previous->update(grid))
+            : std::make_shared<const GridSnapshot>(grid);
+
+        publish(next);
+        return next;
+    }
+}
\ No newline at end of file
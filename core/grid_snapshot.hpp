@@ -0,0 +1,89 @@
+#ifndef CORE__GRID_SNAPSHOT_HPP
+#define CORE__GRID_SNAPSHOT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "cell_t.hpp"
+#include "grid.hpp"
+
+namespace Picross
+{
+    // Immutable view of a grid at a given point in time, safe to read from any number of threads.
+    // Rows and hints are held through shared pointers, so that successive versions share whatever
+    // did not change between them instead of copying it.
+    class GridSnapshot
+    {
+        public:     // Types
+            using Row = std::vector<cell_t>;
+            using RowPtr = std::shared_ptr<const Row>;
+            using HintsPtr = std::shared_ptr<const std::vector<std::vector<int>>>;
+
+        private:    // Attributes
+            int _width;
+            int _height;
+            unsigned long _version;
+            std::vector<RowPtr> _rows;
+            HintsPtr _rowHints;
+            HintsPtr _colHints;
+
+        public:     // Public methods
+            explicit GridSnapshot(const Grid& grid);
+
+        // Writers produce new versions. Unchanged rows and hints are shared with this snapshot.
+            // Produce the snapshot of a grid which is assumed to be a later state of this one.
+            GridSnapshot update(const Grid& grid) const;
+            // Produce a snapshot where only one cell differs from this one.
+            GridSnapshot withCell(int row, int col, cell_t val) const;
+
+            int getWidth() const;
+            int getHeight() const;
+            // Number of updates this snapshot went through since it was first created from a grid.
+            unsigned long getVersion() const;
+
+        // Readers. References stay valid for as long as the snapshot is alive.
+            cell_t getCell(int row, int col) const;
+            const Row& getRow(int row) const;
+            const std::vector<std::vector<int>>& getAllRowHints() const;
+            const std::vector<std::vector<int>>& getAllColHints() const;
+
+            // Whether a row is physically shared between this snapshot and another one.
+            bool sharesRowWith(const GridSnapshot& other, int row) const;
+
+            // Build a regular, mutable grid out of the snapshot.
+            Grid toGrid() const;
+
+        private:    // Private methods
+            GridSnapshot(const GridSnapshot& other, unsigned long version);
+    };
+
+    using GridSnapshotPtr = std::shared_ptr<const GridSnapshot>;
+
+    // Holds the latest published snapshot of a grid. Any number of threads may read the current
+    // snapshot while a writer publishes new ones; a reader keeps its snapshot alive for as long as
+    // it holds the returned pointer, regardless of later publications.
+    class GridSnapshotPublisher
+    {
+        private:    // Attributes
+            // Only ever accessed through std::atomic_load / std::atomic_store.
+            GridSnapshotPtr _current;
+
+        public:     // Public methods
+            GridSnapshotPublisher();
+            explicit GridSnapshotPublisher(const Grid& grid);
+
+            // Non-copyable: sharing a publisher is done by sharing a pointer to it.
+            GridSnapshotPublisher(const GridSnapshotPublisher& other) = delete;
+            GridSnapshotPublisher& operator=(const GridSnapshotPublisher& other) = delete;
+
+            // Get the latest published snapshot (nullptr if nothing was ever published).
+            GridSnapshotPtr current() const;
+            // Atomically replace the current snapshot.
+            void publish(GridSnapshotPtr snapshot);
+            // Publish a new version of the grid, sharing unchanged rows with the current snapshot.
+            // Only one thread should call this at a time.
+            GridSnapshotPtr publish(const Grid& grid);
+    };
+}
+
+#endif//CORE__GRID_SNAPSHOT_HPP
\ No newline at end of file
@@ -27,6 +27,16 @@ namespace Picross
 		return space - 1;
 	}
 
+    int sumHints(const std::vector<int>& hints)
+    {
+        int sum = 0;
+        for (auto it = hints.begin(); it != hints.end(); it++)
+        {
+            sum += *it;
+        }
+        return sum;
+    }
+
     bool cellsSatisfyHints(const std::vector<cell_t>& cells, const std::vector<int>& hints)
     {
         // Cells satisfy hints if the hints generated from them are the same as those provided.
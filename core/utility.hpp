@@ -15,6 +15,9 @@ namespace Picross
     // Returns the minimum cell length needed for a hint sequence to be satisfied.
     int minimumSpaceFromHints(const std::vector<int>& hints);
 
+    // Returns the sum of all hints in a hint sequence.
+    int sumHints(const std::vector<int>& hints);
+
     // Tells whether the layout of the provided vector of cells satisfies the provided hints.
     bool cellsSatisfyHints(const std::vector<cell_t>& cells, const std::vector<int>& hints);
 
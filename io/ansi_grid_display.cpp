@@ -0,0 +1,146 @@
+#include "ansi_grid_display.hpp"
+
+#include <array>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "text_grid_formatter.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        // Control sequences, see ECMA-48 and the VT100 user guide.
+        const std::string saveCursor = "\x1b" "7";
+        const std::string restoreCursor = "\x1b" "8";
+        const std::string clearScreen = "\x1b[H\x1b[2J";
+        const std::string resetScrollRegion = "\x1b[r";
+        const std::string verticalChar = VERTICAL_CHAR;
+    }
+
+    AnsiGridDisplay::AnsiGridDisplay(bool withHints) :
+        _formatter(),
+        _withHints(withHints),
+        _hasFrame(false),
+        _frame(0, 0),
+        _geometry{1, 0, 0}
+    {
+
+    }
+
+    void AnsiGridDisplay::draw(std::ostream& os, const Grid& grid)
+    {
+        if (!_hasFrame || !sameLayout(grid))
+        {
+            redraw(os, grid);
+            return;
+        }
+
+        std::array<std::string, CELL_T_VALUE_COUNT> cellSegments;
+        for (cell_t value : CELL_T_ORDERED_VALUES)
+        {
+            for (int k = 0; k < _geometry.cellWidth; k++)
+            {
+                cellSegments[value] += _formatter.getCharacter(value);
+            }
+        }
+
+        // Rewrite changed cells only. The cursor is left right after the last cell written, so the next
+        // cell on the same row is reached by writing the bar in between rather than moving the cursor.
+        std::string s;
+        int lastRow = -1;
+        int lastCol = -1;
+        for (int i = 0; i < grid.getHeight(); i++)
+        {
+            std::vector<cell_t> row = grid.getRow(i);
+            std::vector<cell_t> previous = _frame.getRow(i);
+            for (int j = 0; j < grid.getWidth(); j++)
+            {
+                if (row[j] == previous[j]) continue;
+
+                if (i == lastRow && j == lastCol + 1)
+                {
+                    s += verticalChar;
+                }
+                else
+                {
+                    // Cells are preceded by the column hints and the top border, then alternate with interlines.
+                    int line = _geometry.colHintHeight + 2 * i + 2;
+                    int column = _geometry.gutterWidth + j * (_geometry.cellWidth + 1) + 2;
+                    appendCursorMove(s, line, column);
+                }
+                s += cellSegments[row[j]];
+                lastRow = i;
+                lastCol = j;
+            }
+        }
+
+        if (s.empty()) return;
+
+        // Leave the cursor where the shell expects it.
+        os << saveCursor << s << restoreCursor << std::flush;
+        _frame = grid;
+    }
+
+    void AnsiGridDisplay::redraw(std::ostream& os, const Grid& grid)
+    {
+        _frame = grid;
+        _geometry = TextGridFormatter::renderGeometry(grid, _withHints);
+        _hasFrame = true;
+
+        os << resetScrollRegion << clearScreen;
+        if (_withHints) _formatter.renderGridWithHints(os, grid);
+        else _formatter.renderGrid(os, grid);
+
+        // Restrict scrolling to the lines below the frame, which moves the cursor home, then go back below the frame.
+        std::string s = "\x1b[" + std::to_string(frameHeight() + 1) + "r";
+        appendCursorMove(s, frameHeight() + 1, 1);
+        os << s << std::flush;
+    }
+
+    void AnsiGridDisplay::release(std::ostream& os)
+    {
+        if (!_hasFrame) return;
+
+        // Resetting the scroll region moves the cursor home, keep it where it is instead.
+        os << saveCursor << resetScrollRegion << restoreCursor << std::flush;
+        _hasFrame = false;
+        _frame = Grid(0, 0);
+    }
+
+    bool AnsiGridDisplay::hasFrame() const
+    {
+        return _hasFrame;
+    }
+
+    bool AnsiGridDisplay::withHints() const
+    {
+        return _withHints;
+    }
+
+    bool AnsiGridDisplay::sameLayout(const Grid& grid) const
+    {
+        if (grid.getWidth() != _frame.getWidth() || grid.getHeight() != _frame.getHeight()) return false;
+        if (!_withHints) return true;
+
+        return grid.hintVersion() == _frame.hintVersion();
+    }
+
+    int AnsiGridDisplay::frameHeight() const
+    {
+        // Column hints, then a row and a border line below it for each row, plus the top border.
+        return _geometry.colHintHeight + 2 * _frame.getHeight() + 1;
+    }
+
+    void AnsiGridDisplay::appendCursorMove(std::string& s, int line, int column)
+    {
+        s += "\x1b[";
+        s += std::to_string(line);
+        s += ';';
+        s += std::to_string(column);
+        s += 'H';
+    }
+}
\ No newline at end of file
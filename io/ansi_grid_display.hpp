@@ -0,0 +1,50 @@
+#ifndef IO__ANSI_GRID_DISPLAY_HPP
+#define IO__ANSI_GRID_DISPLAY_HPP
+
+#include <ostream>
+#include <string>
+
+#include "text_grid_formatter.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Keeps a grid displayed on an ANSI terminal and updates it in place. The first frame clears the
+    // screen and is pinned to the top of the terminal, with the lines below it left to scroll on their
+    // own. Following frames only move the cursor to the cells which changed and rewrite their
+    // characters. The whole grid is drawn again when its layout changes (dimensions, or hints when
+    // they are displayed), or when asked to.
+    class AnsiGridDisplay
+    {
+        private:    // Attributes
+            TextGridFormatter _formatter;
+            bool _withHints;
+            // Whether a frame is on screen, in which case _frame holds the grid it shows.
+            bool _hasFrame;
+            Grid _frame;
+            TextGridFormatter::RenderGeometry _geometry;
+
+        public:     // Public methods
+            AnsiGridDisplay(bool withHints = true);
+
+            // Bring the frame on screen up to date with the grid, redrawing it entirely only if needed.
+            void draw(std::ostream& os, const Grid& grid);
+            // Clear the screen and draw the whole grid.
+            void redraw(std::ostream& os, const Grid& grid);
+            // Unpin the frame and give the terminal back, the next draw will be a full redraw.
+            void release(std::ostream& os);
+
+            bool hasFrame() const;
+            bool withHints() const;
+
+        private:    // Private methods
+            // Whether the grid renders with the same layout as the frame on screen (hints are compared through their version).
+            bool sameLayout(const Grid& grid) const;
+            // Number of lines of the frame on screen.
+            int frameHeight() const;
+            // Append the escape sequence moving the cursor to the given line and column (both 1-based).
+            static void appendCursorMove(std::string& s, int line, int column);
+    };
+}
+
+#endif//IO__ANSI_GRID_DISPLAY_HPP
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "async_grid_saver.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "binary_grid_serializer.hpp"
+#include "non_grid_serializer.hpp"
+#include "xml_grid_serializer.hpp"
+#include "../core/grid.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    AsyncGridSaver::AsyncGridSaver() :
+        _results(),
+        _pendingSaves(0),
+        _mutex(),
+        _ioThread(1)
+    {
+
+    }
+
+    AsyncGridSaver::~AsyncGridSaver()
+    {
+        waitIdle();
+    }
+
+    void AsyncGridSaver::save(const Grid& grid, const std::string& path)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pendingSaves++;
+        }
+
+        // The copy taken here is all the calling thread pays for, serializing and writing happen in the background.
+        _ioThread.submit([this, grid, path]()
+        {
+            SaveResult result = { path, true, "" };
+            try
+            {
+                saveGridToFile(grid, path);
+            }
+            catch(const std::exception& e)
+            {
+                result.success = false;
+                result.error = e.what();
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _results.push_back(std::move(result));
+            _pendingSaves--;
+        });
+    }
+
+    std::size_t AsyncGridSaver::pendingSaves()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pendingSaves;
+    }
+
+    std::vector<AsyncGridSaver::SaveResult> AsyncGridSaver::takeResults()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<SaveResult> results = std::move(_results);
+        _results.clear();
+        return results;
+    }
+
+    void AsyncGridSaver::waitIdle()
+    {
+        _ioThread.waitIdle();
+    }
+
+    void AsyncGridSaver::saveGridToFile(const Grid& grid, const std::string& path)
+    {
+        // Write next to the destination, so that the rename stays within one file system.
+        std::string temporaryPath = path + ".tmp";
+        std::string extension = fs::path(path).extension().string();
+
+        try
+        {
+            if (extension == ".non")
+            {
+                NonGridSerializer non = NonGridSerializer();
+                non.saveGridToFile(grid, temporaryPath);
+            }
+            else if (extension == ".pxgb")
+            {
+                BinaryGridSerializer binary = BinaryGridSerializer();
+                binary.saveGridToFile(grid, temporaryPath);
+            }
+            else
+            {
+                XMLGridSerialzer xml = XMLGridSerialzer();
+                xml.saveGridToFile(grid, temporaryPath);
+            }
+
+            fs::rename(temporaryPath, path);
+        }
+        catch(...)
+        {
+            // Do not leave a partially written file behind.
+            std::error_code ignored;
+            fs::remove(temporaryPath, ignored);
+            throw;
+        }
+    }
+
+    std::string AsyncGridSaver::describeResult(const SaveResult& result)
+    {
+        if (result.success)
+        {
+            return "Grid successfully saved to " + result.path + ".";
+        }
+
+        return "Grid could not be saved to " + result.path + ": " + result.error;
+    }
+
+    std::shared_ptr<AsyncGridSaver> AsyncGridSaver::getOrCreate(std::shared_ptr<AsyncGridSaver>& saver)
+    {
+        // The I/O thread is only started once something needs to be saved.
+        if (!saver) saver = std::make_shared<AsyncGridSaver>();
+        return saver;
+    }
+
+    void AsyncGridSaver::reportResults(const std::shared_ptr<AsyncGridSaver>& saver, std::ostream& out, std::ostream& err)
+    {
+        if (!saver) return;
+
+        for (const SaveResult& result : saver->takeResults())
+        {
+            (result.success ? out : err) << describeResult(result) << std::endl;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef IO__ASYNC_GRID_SAVER_HPP
+#define IO__ASYNC_GRID_SAVER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../core/grid.hpp"
+#include "../tools/thread_pool.hpp"
+
+namespace Picross
+{
+    // Saves grids on a background I/O thread, so that interactive sessions never wait on the disk.
+    // Grids are copied when the save is requested and written in request order. Each file is first
+    // written next to its destination, then renamed over it, so that a reader never sees a partially
+    // written file. Outcomes are kept until collected with takeResults().
+    class AsyncGridSaver
+    {
+        public:     // Types
+            struct SaveResult
+            {
+                std::string path;
+                bool success;
+                std::string error;      // Reason of the failure, if any.
+            };
+
+        private:    // Attributes
+            std::vector<SaveResult> _results;
+            std::size_t _pendingSaves;
+            std::mutex _mutex;
+            ThreadPool _ioThread;       // Declared last, so that pending saves complete before the rest is destroyed.
+
+        public:     // Public methods
+            AsyncGridSaver();
+            // Waits for pending saves to complete.
+            ~AsyncGridSaver();
+
+            AsyncGridSaver(const AsyncGridSaver& other) = delete;
+            AsyncGridSaver& operator=(const AsyncGridSaver& other) = delete;
+
+            // Queue a copy of the grid to be saved to the given path, in the format its extension tells.
+            void save(const Grid& grid, const std::string& path);
+            // Number of saves requested and not completed yet.
+            std::size_t pendingSaves();
+            // Retrieve the outcomes of saves completed since the last call, in completion order.
+            std::vector<SaveResult> takeResults();
+            // Block until every requested save has completed.
+            void waitIdle();
+
+            // Save a grid synchronously: .non for clues only, .pxgb for binary, XML otherwise.
+            // The file is written to a temporary path, then renamed to its destination.
+            static void saveGridToFile(const Grid& grid, const std::string& path);
+            // One-line description of a save outcome, to be shown to the user.
+            static std::string describeResult(const SaveResult& result);
+
+        // Helpers for sessions which only start a saver once something needs to be saved.
+            // Return the saver held by `saver`, creating it if there is none yet.
+            static std::shared_ptr<AsyncGridSaver> getOrCreate(std::shared_ptr<AsyncGridSaver>& saver);
+            // Print the outcomes collected from `saver`, successes to `out` and failures to `err`. Does nothing without a saver.
+            static void reportResults(const std::shared_ptr<AsyncGridSaver>& saver, std::ostream& out, std::ostream& err);
+    };
+}
+
+#endif//IO__ASYNC_GRID_SAVER_HPP
\ No newline at end of file
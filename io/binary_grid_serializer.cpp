@@ -0,0 +1,182 @@
+#include "binary_grid_serializer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "exceptions/invalid_binary_grid_error.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+#include "../tools/mapped_file.hpp"
+#include "../tools/varint_tools.hpp"
+
+namespace Picross
+{
+    BinaryGridSerializer::BinaryGridSerializer()
+    {
+
+    }
+
+    void BinaryGridSerializer::saveGridToFile(const Grid& grid, std::string path)
+    {
+        std::string data = encode(grid);
+
+        std::ofstream f = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        if (!f.is_open())
+        {
+            throw InvalidBinaryGridError("Could not open " + path + " for writing.");
+        }
+
+        f.write(data.data(), data.size());
+        f.close();
+        if (f.fail())
+        {
+            throw InvalidBinaryGridError("Could not write to " + path + ".");
+        }
+    }
+
+    Grid BinaryGridSerializer::loadGridFromFile(std::string path)
+    {
+        MappedFile file = MappedFile(path);
+        return decode(file.data(), file.size());
+    }
+
+    std::string BinaryGridSerializer::encode(const Grid& grid)
+    {
+        int width = grid.getWidth();
+        int height = grid.getHeight();
+
+        std::string out;
+        out.reserve(16 + (width * height + 3) / 4 + 2 * (width + height));
+
+        // Header.
+        out.append(MAGIC, 4);
+        out.push_back((char) FORMAT_VERSION);
+        VarintTools::appendVarint(out, width);
+        VarintTools::appendVarint(out, height);
+
+        // Hints.
+        encodeHints(out, grid.getAllRowHints());
+        encodeHints(out, grid.getAllColHints());
+
+        // Cells, packed 4 per byte.
+        std::size_t cellStart = out.size();
+        out.append((width * height + 3) / 4, '\0');
+        int index = 0;
+        for (int i = 0; i < height; i++)
+        {
+            for (int j = 0; j < width; j++)
+            {
+                out[cellStart + index / 4] |= (char) (grid.getCell(i, j) << (2 * (index % 4)));
+                index++;
+            }
+        }
+
+        return out;
+    }
+
+    Grid BinaryGridSerializer::decode(const unsigned char* data, std::size_t size)
+    {
+        const unsigned char* cursor = data;
+        const unsigned char* end = data + size;
+
+        // Header.
+        if (size < 5 || std::memcmp(data, MAGIC, 4) != 0)
+        {
+            throw InvalidBinaryGridError("Provided data is not a binary grid.");
+        }
+        if (data[4] != FORMAT_VERSION)
+        {
+            throw InvalidBinaryGridError("Unsupported binary grid format version " + std::to_string((int) data[4]) + ".");
+        }
+        cursor += 5;
+
+        int width = readBoundedVarint(cursor, end, MAX_DIMENSION, "grid width");
+        int height = readBoundedVarint(cursor, end, MAX_DIMENSION, "grid height");
+
+        // Every line takes at least one byte for its hint count: reject dimensions the data cannot hold before allocating anything.
+        if ((std::size_t) (end - cursor) < (std::size_t) width + height)
+        {
+            throw InvalidBinaryGridError("Truncated hint data in binary grid.");
+        }
+
+        // Hints. The grid constructor validates them against the dimensions.
+        std::vector<std::vector<int>> rowHints = decodeHints(cursor, end, height, width);
+        std::vector<std::vector<int>> colHints = decodeHints(cursor, end, width, height);
+        Grid grid = Grid(width, height, std::move(rowHints), std::move(colHints));
+
+        // Cells.
+        std::size_t cellBytes = ((std::size_t) width * height + 3) / 4;
+        if ((std::size_t) (end - cursor) < cellBytes)
+        {
+            throw InvalidBinaryGridError("Truncated cell data in binary grid.");
+        }
+
+        std::vector<cell_t> row = std::vector<cell_t>(width);
+        std::size_t index = 0;
+        for (int i = 0; i < height; i++)
+        {
+            for (int j = 0; j < width; j++)
+            {
+                cell_t val = (cursor[index / 4] >> (2 * (index % 4))) & 0x03;
+                if (val >= CELL_T_VALUE_COUNT)
+                {
+                    throw InvalidBinaryGridError("Invalid cell value " + std::to_string((int) val) + " in binary grid.");
+                }
+                row[j] = val;
+                index++;
+            }
+            grid.setRow(i, row);
+        }
+
+        return grid;
+    }
+
+    void BinaryGridSerializer::encodeHints(std::string& out, const std::vector<std::vector<int>>& hints)
+    {
+        for (const auto& line : hints)
+        {
+            VarintTools::appendVarint(out, line.size());
+            for (int hint : line)
+            {
+                VarintTools::appendVarint(out, hint);
+            }
+        }
+    }
+
+    std::vector<std::vector<int>> BinaryGridSerializer::decodeHints(const unsigned char*& cursor, const unsigned char* end, int count, int length)
+    {
+        std::vector<std::vector<int>> hints = std::vector<std::vector<int>>(count);
+        for (auto& line : hints)
+        {
+            // A line of length n holds at most (n + 1) / 2 hints, each no larger than n.
+            int hintCount = readBoundedVarint(cursor, end, (length + 1) / 2, "hint count");
+            line.reserve(hintCount);
+            for (int k = 0; k < hintCount; k++)
+            {
+                line.push_back(readBoundedVarint(cursor, end, length, "hint value"));
+            }
+        }
+
+        return hints;
+    }
+
+    int BinaryGridSerializer::readBoundedVarint(const unsigned char*& cursor, const unsigned char* end, int max, const std::string& what)
+    {
+        std::uint64_t value;
+        if (!VarintTools::readVarint(cursor, end, value))
+        {
+            throw InvalidBinaryGridError("Truncated or malformed " + what + " in binary grid.");
+        }
+        if (value > (std::uint64_t) max)
+        {
+            throw InvalidBinaryGridError("Out of range " + what + " " + std::to_string(value) + " in binary grid.");
+        }
+
+        return (int) value;
+    }
+}
\ No newline at end of file
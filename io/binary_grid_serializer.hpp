@@ -0,0 +1,47 @@
+#ifndef IO__BINARY_GRID_SERIALIZER_HPP
+#define IO__BINARY_GRID_SERIALIZER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "exceptions/invalid_binary_grid_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Compact binary grid format, laid out as follows:
+    //  - magic bytes "PXGB", followed by a format version byte;
+    //  - width and height, as varints;
+    //  - for every row, then every column: hint count, then each hint, all as varints;
+    //  - cell contents, row-major, 2 bits per cell, 4 cells per byte starting from the low bits.
+    class BinaryGridSerializer
+    {
+        public:     // Public methods
+            inline static const char MAGIC[] = "PXGB";
+            inline static const unsigned char FORMAT_VERSION = 1;
+            // Largest width or height accepted when decoding.
+            inline static const int MAX_DIMENSION = 0xFFFF;
+
+            BinaryGridSerializer();
+
+            void saveGridToFile(const Grid& grid, std::string path);
+            // Memory-maps the file and decodes the grid straight from the mapping.
+            Grid loadGridFromFile(std::string path);
+
+        // In-memory encoding, usable to embed grids in other containers.
+            std::string encode(const Grid& grid);
+            // Decode a grid from a byte range. Throws InvalidBinaryGridError on malformed or truncated input.
+            Grid decode(const unsigned char* data, std::size_t size);
+
+        private:    // Private methods
+            // Append a full hint collection (one entry per line).
+            void encodeHints(std::string& out, const std::vector<std::vector<int>>& hints);
+            // Read `count` hint entries, advancing the cursor.
+            std::vector<std::vector<int>> decodeHints(const unsigned char*& cursor, const unsigned char* end, int count, int length);
+            // Read a varint and check it fits in the given bound, auto-throw otherwise.
+            int readBoundedVarint(const unsigned char*& cursor, const unsigned char* end, int max, const std::string& what);
+    };
+}
+
+#endif//IO__BINARY_GRID_SERIALIZER_HPP
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "clue_text.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Picross
+{
+    namespace
+    {
+        bool isBlank(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+    }
+
+    std::string_view nextTextLine(const char*& cursor, const char* end)
+    {
+        const char* start = cursor;
+        while (cursor != end && *cursor != '\n')
+        {
+            cursor++;
+        }
+
+        std::string_view line = std::string_view(start, cursor - start);
+        if (cursor != end) cursor++;
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        return line;
+    }
+
+    std::string_view trimText(std::string_view text)
+    {
+        while (!text.empty() && isBlank(text.front())) text.remove_prefix(1);
+        while (!text.empty() && isBlank(text.back())) text.remove_suffix(1);
+
+        return text;
+    }
+
+    int parseClueValue(std::string_view text)
+    {
+        if (text.empty()) return -1;
+
+        int value = 0;
+        for (char c : text)
+        {
+            if (c < '0' || c > '9') return -1;
+            value = value * 10 + (c - '0');
+            if (value > CLUE_TEXT_MAX_VALUE) return -1;
+        }
+
+        return value;
+    }
+
+    bool parseClueLine(std::string_view line, std::vector<int>& hints)
+    {
+        hints.clear();
+
+        std::size_t i = 0;
+        while (i < line.size())
+        {
+            char c = line[i];
+            if (c == ',' || isBlank(c))
+            {
+                i++;
+                continue;
+            }
+
+            // Accumulate the digits of one clue in place.
+            if (c < '0' || c > '9') return false;
+            int value = 0;
+            while (i < line.size() && line[i] >= '0' && line[i] <= '9')
+            {
+                value = value * 10 + (line[i++] - '0');
+                if (value > CLUE_TEXT_MAX_VALUE) return false;
+            }
+
+            // Clues must be followed by a separator.
+            if (i < line.size() && line[i] != ',' && !isBlank(line[i])) return false;
+            if (value > 0) hints.push_back(value);
+        }
+
+        return true;
+    }
+
+    std::string formatClueLine(const std::vector<int>& hints, char separator)
+    {
+        if (hints.empty()) return "0";
+
+        std::string out;
+        for (std::size_t i = 0; i < hints.size(); i++)
+        {
+            if (i > 0) out.push_back(separator);
+            out += std::to_string(hints[i]);
+        }
+
+        return out;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef IO__CLUE_TEXT_HPP
+#define IO__CLUE_TEXT_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Picross
+{
+    // Largest width, height or clue value accepted by the text puzzle importers.
+    inline static const int CLUE_TEXT_MAX_VALUE = 0xFFFF;
+
+    // Returns the line starting at the cursor, without its line terminator ("\n" or "\r\n"),
+    // and moves the cursor to the start of the next line.
+    std::string_view nextTextLine(const char*& cursor, const char* end);
+
+    // Returns the text without leading and trailing blanks.
+    std::string_view trimText(std::string_view text);
+
+    // Parses a non-negative integer spanning the whole text. Returns -1 if the text is malformed
+    // or the value exceeds CLUE_TEXT_MAX_VALUE.
+    int parseClueValue(std::string_view text);
+
+    // Parses a line of clues, separated by commas and/or blanks, into `hints` (which is cleared first).
+    // Zeros are dropped, so "0" and an empty line both describe a line with no clue.
+    // Returns false if the line holds anything else than clues and separators.
+    bool parseClueLine(std::string_view line, std::vector<int>& hints);
+
+    // Formats clues with the given separator, "0" standing for a line with no clue.
+    std::string formatClueLine(const std::vector<int>& hints, char separator);
+}
+
+#endif//IO__CLUE_TEXT_HPP
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "image_export_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(ImageExportError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef IO__IMAGE_EXPORT_ERROR
+#define IO__IMAGE_EXPORT_ERROR
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(ImageExportError)
+}
+
+#endif//IO__IMAGE_EXPORT_ERROR
\ No newline at end of file
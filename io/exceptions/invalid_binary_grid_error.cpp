@@ -0,0 +1,7 @@
+#include "invalid_binary_grid_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(InvalidBinaryGridError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef IO__INVALID_BINARY_GRID_ERROR
+#define IO__INVALID_BINARY_GRID_ERROR
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(InvalidBinaryGridError)
+}
+
+#endif//IO__INVALID_BINARY_GRID_ERROR
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "invalid_grid_archive_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(InvalidGridArchiveError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef IO__INVALID_GRID_JOURNAL_ERROR
+#define IO__INVALID_GRID_JOURNAL_ERROR
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(InvalidGridJournalError)
+}
+
+#endif//IO__INVALID_GRID_JOURNAL_ERROR
\ No newline at end of file
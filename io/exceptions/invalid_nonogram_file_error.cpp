@@ -0,0 +1,7 @@
+#include "invalid_nonogram_file_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(InvalidNonogramFileError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef IO__INVALID_NONOGRAM_FILE_ERROR
+#define IO__INVALID_NONOGRAM_FILE_ERROR
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(InvalidNonogramFileError)
+}
+
+#endif//IO__INVALID_NONOGRAM_FILE_ERROR
\ No newline at end of file
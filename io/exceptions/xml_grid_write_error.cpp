@@ -0,0 +1,7 @@
+#include "xml_grid_write_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(XMLGridWriteError)
+}
\ No newline at end of file
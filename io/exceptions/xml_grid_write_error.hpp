@@ -0,0 +1,11 @@
+#ifndef IO__XML_GRID_WRITE_ERROR
+#define IO__XML_GRID_WRITE_ERROR
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(XMLGridWriteError)
+}
+
+#endif//IO__XML_GRID_WRITE_ERROR
\ No newline at end of file
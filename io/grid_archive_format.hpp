@@ -0,0 +1,26 @@
+#ifndef IO__GRID_ARCHIVE_FORMAT_HPP
+#define IO__GRID_ARCHIVE_FORMAT_HPP
+
+#include <cstddef>
+
+namespace Picross
+{
+    // Grid archives hold many grids in a single file, laid out as follows:
+    //  - header: magic bytes "PXGA", format version byte, record format byte;
+    //  - records, back to back, each one being a single grid encoded in the record format;
+    //  - index: the offset of every record from the start of the file, as little-endian 64-bit integers;
+    //  - footer: record count and index offset, as little-endian 64-bit integers, then magic bytes "PXGI".
+    // The fixed-size footer and index allow fetching any record in constant time.
+    inline static const char GRID_ARCHIVE_MAGIC[] = "PXGA";
+    inline static const char GRID_ARCHIVE_INDEX_MAGIC[] = "PXGI";
+    inline static const unsigned char GRID_ARCHIVE_VERSION = 1;
+
+    // Record formats.
+    inline static const unsigned char GRID_ARCHIVE_RECORD_BINARY = 0;  // See BinaryGridSerializer.
+    inline static const unsigned char GRID_ARCHIVE_RECORD_XML = 1;     // See XMLGridSerialzer.
+
+    inline static const std::size_t GRID_ARCHIVE_HEADER_SIZE = 6;
+    inline static const std::size_t GRID_ARCHIVE_FOOTER_SIZE = 20;
+}
+
+#endif//IO__GRID_ARCHIVE_FORMAT_HPP
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "grid_archive_reader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "grid_archive_format.hpp"
+#include "binary_grid_serializer.hpp"
+#include "xml_grid_stream_reader.hpp"
+#include "exceptions/invalid_grid_archive_error.hpp"
+#include "../core/grid.hpp"
+#include "../tools/mapped_file.hpp"
+
+namespace Picross
+{
+    GridArchiveReader::GridArchiveReader(const std::string& path) :
+        _file(path),
+        _recordFormat(GRID_ARCHIVE_RECORD_BINARY),
+        _count(0),
+        _indexOffset(0)
+    {
+        const unsigned char* data = _file.data();
+        std::size_t size = _file.size();
+
+        // Header and footer.
+        if (size < GRID_ARCHIVE_HEADER_SIZE + GRID_ARCHIVE_FOOTER_SIZE
+            || std::memcmp(data, GRID_ARCHIVE_MAGIC, 4) != 0
+            || std::memcmp(data + size - 4, GRID_ARCHIVE_INDEX_MAGIC, 4) != 0)
+        {
+            throw InvalidGridArchiveError(path + " is not a grid archive.");
+        }
+        if (data[4] != GRID_ARCHIVE_VERSION)
+        {
+            throw InvalidGridArchiveError("Unsupported grid archive version " + std::to_string((int) data[4]) + " in " + path + ".");
+        }
+
+        _recordFormat = data[5];
+        if (_recordFormat != GRID_ARCHIVE_RECORD_BINARY && _recordFormat != GRID_ARCHIVE_RECORD_XML)
+        {
+            throw InvalidGridArchiveError("Unknown record format " + std::to_string((int) _recordFormat) + " in " + path + ".");
+        }
+
+        std::uint64_t count = readUInt64(size - GRID_ARCHIVE_FOOTER_SIZE);
+        _indexOffset = readUInt64(size - GRID_ARCHIVE_FOOTER_SIZE + 8);
+
+        // The index must sit right before the footer.
+        std::uint64_t indexEnd = size - GRID_ARCHIVE_FOOTER_SIZE;
+        if (_indexOffset < GRID_ARCHIVE_HEADER_SIZE || _indexOffset > indexEnd || (indexEnd - _indexOffset) / 8 != count || (indexEnd - _indexOffset) % 8 != 0)
+        {
+            throw InvalidGridArchiveError("Corrupted index in grid archive " + path + ".");
+        }
+        _count = (std::size_t) count;
+    }
+
+    std::size_t GridArchiveReader::size() const
+    {
+        return _count;
+    }
+
+    unsigned char GridArchiveReader::getRecordFormat() const
+    {
+        return _recordFormat;
+    }
+
+    Grid GridArchiveReader::gridAt(std::size_t index) const
+    {
+        std::pair<const unsigned char*, std::size_t> record = recordAt(index);
+
+        if (_recordFormat == GRID_ARCHIVE_RECORD_BINARY)
+        {
+            BinaryGridSerializer binary = BinaryGridSerializer();
+            return binary.decode(record.first, record.second);
+        }
+
+        XMLGridStreamReader xml = XMLGridStreamReader();
+        return xml.loadGridFromBuffer(reinterpret_cast<const char*>(record.first), record.second);
+    }
+
+    std::pair<const unsigned char*, std::size_t> GridArchiveReader::recordAt(std::size_t index) const
+    {
+        if (index >= _count)
+        {
+            throw InvalidGridArchiveError("Record " + std::to_string(index) + " out of range for archive of " + std::to_string(_count) + " grids.");
+        }
+
+        // A record spans from its offset up to the next one, or up to the index for the last record.
+        std::uint64_t start = readUInt64(_indexOffset + 8 * index);
+        std::uint64_t end = (index + 1 < _count) ? readUInt64(_indexOffset + 8 * (index + 1)) : _indexOffset;
+        if (start < GRID_ARCHIVE_HEADER_SIZE || start > end || end > _indexOffset)
+        {
+            throw InvalidGridArchiveError("Corrupted offset for record " + std::to_string(index) + " in grid archive.");
+        }
+
+        return { _file.data() + start, (std::size_t) (end - start) };
+    }
+
+    GridArchiveReader::Iterator GridArchiveReader::begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    GridArchiveReader::Iterator GridArchiveReader::end() const
+    {
+        return Iterator(this, _count);
+    }
+
+    std::uint64_t GridArchiveReader::readUInt64(std::uint64_t offset) const
+    {
+        const unsigned char* bytes = _file.data() + offset;
+        std::uint64_t value = 0;
+        for (int i = 7; i >= 0; i--)
+        {
+            value = (value << 8) | bytes[i];
+        }
+        return value;
+    }
+
+    GridArchiveReader::Iterator::Iterator(const GridArchiveReader* reader, std::size_t index) :
+        _reader(reader),
+        _index(index)
+    {
+
+    }
+
+    Grid GridArchiveReader::Iterator::operator*() const
+    {
+        return _reader->gridAt(_index);
+    }
+
+    GridArchiveReader::Iterator& GridArchiveReader::Iterator::operator++()
+    {
+        _index++;
+        return *this;
+    }
+
+    bool GridArchiveReader::Iterator::operator==(const Iterator& other) const
+    {
+        return _reader == other._reader && _index == other._index;
+    }
+
+    bool GridArchiveReader::Iterator::operator!=(const Iterator& other) const
+    {
+        return !(*this == other);
+    }
+}
\ No newline at end of file
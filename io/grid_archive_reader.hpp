@@ -0,0 +1,73 @@
+#ifndef IO__GRID_ARCHIVE_READER_HPP
+#define IO__GRID_ARCHIVE_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include "grid_archive_format.hpp"
+#include "binary_grid_serializer.hpp"
+#include "xml_grid_stream_reader.hpp"
+#include "exceptions/invalid_grid_archive_error.hpp"
+#include "../core/grid.hpp"
+#include "../tools/mapped_file.hpp"
+
+namespace Picross
+{
+    // Random access and sequential reading of grid archives. The archive is memory-mapped when opened:
+    // only the footer is checked at that point, and records are decoded on demand.
+    // Const methods may be called concurrently from several threads.
+    class GridArchiveReader
+    {
+        public:     // Types
+            // Input iterator decoding grids in archive order.
+            class Iterator
+            {
+                private:
+                    const GridArchiveReader* _reader;
+                    std::size_t _index;
+
+                public:
+                    using iterator_category = std::input_iterator_tag;
+                    using value_type = Grid;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = Grid;
+
+                    Iterator(const GridArchiveReader* reader, std::size_t index);
+
+                    Grid operator*() const;
+                    Iterator& operator++();
+                    bool operator==(const Iterator& other) const;
+                    bool operator!=(const Iterator& other) const;
+            };
+
+        private:    // Attributes
+            MappedFile _file;
+            unsigned char _recordFormat;
+            std::size_t _count;
+            std::uint64_t _indexOffset;
+
+        public:     // Public methods
+            explicit GridArchiveReader(const std::string& path);
+
+            // Number of grids in the archive.
+            std::size_t size() const;
+            unsigned char getRecordFormat() const;
+
+            // Decode the grid at the given position in constant time.
+            Grid gridAt(std::size_t index) const;
+            // Raw encoded bytes of a record, valid as long as the reader lives.
+            std::pair<const unsigned char*, std::size_t> recordAt(std::size_t index) const;
+
+            Iterator begin() const;
+            Iterator end() const;
+
+        private:    // Private methods
+            std::uint64_t readUInt64(std::uint64_t offset) const;
+    };
+}
+
+#endif//IO__GRID_ARCHIVE_READER_HPP
\ No newline at end of file
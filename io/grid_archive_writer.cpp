@@ -0,0 +1,119 @@
+#include "grid_archive_writer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "grid_archive_format.hpp"
+#include "binary_grid_serializer.hpp"
+#include "xml_grid_serializer.hpp"
+#include "exceptions/invalid_grid_archive_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    GridArchiveWriter::GridArchiveWriter(std::string path, unsigned char recordFormat) :
+        _file(path, std::ios::binary | std::ios::trunc),
+        _path(path),
+        _recordFormat(recordFormat),
+        _offsets(),
+        _position(0),
+        _closed(false),
+        _binary(),
+        _xml()
+    {
+        if (recordFormat != GRID_ARCHIVE_RECORD_BINARY && recordFormat != GRID_ARCHIVE_RECORD_XML)
+        {
+            throw InvalidGridArchiveError("Unknown archive record format " + std::to_string((int) recordFormat) + ".");
+        }
+        if (!_file.is_open())
+        {
+            throw InvalidGridArchiveError("Could not open " + path + " for writing.");
+        }
+
+        // Header.
+        std::string header = std::string(GRID_ARCHIVE_MAGIC, 4);
+        header.push_back((char) GRID_ARCHIVE_VERSION);
+        header.push_back((char) recordFormat);
+        write(header);
+    }
+
+    GridArchiveWriter::~GridArchiveWriter()
+    {
+        try
+        {
+            close();
+        }
+        catch(...)
+        {
+            // Nothing sensible to do in a destructor.
+        }
+    }
+
+    void GridArchiveWriter::addGrid(const Grid& grid)
+    {
+        if (_closed)
+        {
+            throw InvalidGridArchiveError("Cannot add a grid to closed archive " + _path + ".");
+        }
+
+        _offsets.push_back(_position);
+        if (_recordFormat == GRID_ARCHIVE_RECORD_BINARY)
+        {
+            write(_binary.encode(grid));
+        }
+        else
+        {
+            write(_xml.saveGridToString(grid));
+        }
+    }
+
+    std::size_t GridArchiveWriter::size() const
+    {
+        return _offsets.size();
+    }
+
+    void GridArchiveWriter::close()
+    {
+        if (_closed) return;
+        _closed = true;
+
+        // Index, then footer.
+        std::uint64_t indexOffset = _position;
+        for (std::uint64_t offset : _offsets)
+        {
+            writeUInt64(offset);
+        }
+        writeUInt64(_offsets.size());
+        writeUInt64(indexOffset);
+        write(std::string(GRID_ARCHIVE_INDEX_MAGIC, 4));
+
+        _file.close();
+        if (_file.fail())
+        {
+            throw InvalidGridArchiveError("Could not write archive " + _path + ".");
+        }
+    }
+
+    void GridArchiveWriter::write(const std::string& data)
+    {
+        _file.write(data.data(), data.size());
+        if (!_file)
+        {
+            throw InvalidGridArchiveError("Could not write archive " + _path + ".");
+        }
+        _position += data.size();
+    }
+
+    void GridArchiveWriter::writeUInt64(std::uint64_t value)
+    {
+        std::string bytes = std::string(8, '\0');
+        for (int i = 0; i < 8; i++)
+        {
+            bytes[i] = (char) ((value >> (8 * i)) & 0xFF);
+        }
+        write(bytes);
+    }
+}
\ No newline at end of file
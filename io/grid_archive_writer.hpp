@@ -0,0 +1,54 @@
+#ifndef IO__GRID_ARCHIVE_WRITER_HPP
+#define IO__GRID_ARCHIVE_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "grid_archive_format.hpp"
+#include "binary_grid_serializer.hpp"
+#include "xml_grid_serializer.hpp"
+#include "exceptions/invalid_grid_archive_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Writes grids one after the other into an archive file. Records are streamed to disk as they are
+    // added; only their offsets are kept in memory until the index is written by close().
+    class GridArchiveWriter
+    {
+        private:    // Attributes
+            std::ofstream _file;
+            std::string _path;
+            unsigned char _recordFormat;
+            std::vector<std::uint64_t> _offsets;
+            std::uint64_t _position;
+            bool _closed;
+            BinaryGridSerializer _binary;
+            XMLGridSerialzer _xml;
+
+        public:     // Public methods
+            GridArchiveWriter(std::string path, unsigned char recordFormat = GRID_ARCHIVE_RECORD_BINARY);
+            // Closes the archive if close() was not called. Errors are swallowed at that point.
+            ~GridArchiveWriter();
+
+            GridArchiveWriter(const GridArchiveWriter& other) = delete;
+            GridArchiveWriter& operator=(const GridArchiveWriter& other) = delete;
+
+            // Append a grid to the archive.
+            void addGrid(const Grid& grid);
+            // Number of grids added so far.
+            std::size_t size() const;
+
+            // Write the index and footer, then close the file. No grid can be added afterwards.
+            void close();
+
+        private:    // Private methods
+            void write(const std::string& data);
+            void writeUInt64(std::uint64_t value);
+    };
+}
+
+#endif//IO__GRID_ARCHIVE_WRITER_HPP
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "grid_corpus_loader.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "binary_grid_serializer.hpp"
+#include "non_grid_serializer.hpp"
+#include "olsak_grid_reader.hpp"
+#include "webpbn_grid_reader.hpp"
+#include "xml_grid_stream_reader.hpp"
+#include "../core/grid.hpp"
+#include "../tools/parallel_tools.hpp"
+#include "../tools/thread_pool.hpp"
+#include "../tools/mapped_file.hpp"
+#include "../tools/string_tools.hpp"
+#include "../tools/exceptions/file_not_found_error.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    GridCorpusLoader::GridCorpusLoader(std::size_t threadCount, std::size_t queueCapacity) :
+        _threadCount(threadCount > 0 ? threadCount : ThreadPool::defaultThreadCount()),
+        _queueCapacity(queueCapacity)
+    {
+
+    }
+
+    void GridCorpusLoader::load(const std::vector<std::string>& paths, const Consumer& consumer)
+    {
+        // Files which cannot be loaded are reported to the consumer, they do not stop the others.
+        auto loadOne = [&paths](std::size_t, std::size_t i)
+        {
+            LoadedGrid result = { i, paths[i], std::nullopt, "" };
+            try
+            {
+                result.grid.emplace(loadGridFile(paths[i]));
+            }
+            catch(const std::exception& e)
+            {
+                result.error = e.what();
+            }
+
+            return result;
+        };
+
+        ParallelTools::produceAndConsume<LoadedGrid>(paths.size(), _threadCount, _queueCapacity, loadOne, consumer);
+    }
+
+    void GridCorpusLoader::loadDirectory(const std::string& directory, const Consumer& consumer)
+    {
+        load(listGridFiles(directory), consumer);
+    }
+
+    void GridCorpusLoader::loadManifest(const std::string& manifestPath, const Consumer& consumer)
+    {
+        load(readManifest(manifestPath), consumer);
+    }
+
+    Grid GridCorpusLoader::loadGridFile(const std::string& path)
+    {
+        std::string extension = fs::path(path).extension().string();
+        if (extension == ".pxgb")
+        {
+            BinaryGridSerializer binary = BinaryGridSerializer();
+            return binary.loadGridFromFile(path);
+        }
+        if (extension == ".non")
+        {
+            NonGridSerializer non = NonGridSerializer();
+            return non.loadGridFromFile(path);
+        }
+        if (extension == ".g")
+        {
+            OlsakGridReader olsak = OlsakGridReader();
+            return olsak.loadGridFromFile(path);
+        }
+
+        // Both XML flavours are told apart by their root element, reading the file only once.
+        if (extension == ".xml" && fs::exists(path))
+        {
+            MappedFile file = MappedFile(path);
+            const char* data = (const char*) file.data();
+            if (WebpbnGridReader::isWebpbnDocument(data, file.size()))
+            {
+                WebpbnGridReader webpbn = WebpbnGridReader();
+                return webpbn.loadGridFromBuffer(data, file.size());
+            }
+
+            XMLGridStreamReader xml = XMLGridStreamReader();
+            return xml.loadGridFromBuffer(data, file.size());
+        }
+
+        XMLGridStreamReader xml = XMLGridStreamReader();
+        return xml.loadGridFromFile(path);
+    }
+
+    std::vector<std::string> GridCorpusLoader::listGridFiles(const std::string& directory)
+    {
+        if (!fs::is_directory(directory))
+        {
+            throw FileNotFoundError(directory + ": directory not found.");
+        }
+
+        std::vector<std::string> files;
+        for (const fs::directory_entry& entry : fs::recursive_directory_iterator(directory))
+        {
+            std::string extension = entry.path().extension().string();
+            if (entry.is_regular_file() && (extension == ".xml" || extension == ".pxgb" || extension == ".non" || extension == ".g"))
+            {
+                files.push_back(entry.path().string());
+            }
+        }
+
+        // Directory iteration order is unspecified.
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    std::vector<std::string> GridCorpusLoader::readManifest(const std::string& manifestPath)
+    {
+        std::ifstream manifest = std::ifstream(manifestPath);
+        if (!manifest.is_open())
+        {
+            throw FileNotFoundError(manifestPath + ": file not found.");
+        }
+
+        fs::path base = fs::path(manifestPath).parent_path();
+        std::vector<std::string> files;
+        std::string line;
+        while (std::getline(manifest, line))
+        {
+            StringTools::popCR(line);
+            std::size_t start = line.find_first_not_of(" \t");
+            if (start == std::string::npos || line[start] == '#') continue;
+
+            std::size_t end = line.find_last_not_of(" \t");
+            fs::path entry = fs::path(line.substr(start, end - start + 1));
+            files.push_back((entry.is_absolute() ? entry : base / entry).string());
+        }
+
+        return files;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef IO__GRID_CORPUS_LOADER_HPP
+#define IO__GRID_CORPUS_LOADER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Loads large sets of grid files using several threads. Workers read and parse files concurrently
+    // and hand results over through a bounded queue, so that memory use stays bounded when the
+    // consumer is slower than the loading.
+    class GridCorpusLoader
+    {
+        public:     // Types
+            // Outcome of loading one file of the corpus.
+            struct LoadedGrid
+            {
+                std::size_t index;          // Position of the file in the list of paths to load.
+                std::string path;
+                std::optional<Grid> grid;   // Empty if loading failed.
+                std::string error;          // Reason of the failure, if any.
+            };
+
+            using Consumer = std::function<void(LoadedGrid&&)>;
+
+        private:    // Attributes
+            std::size_t _threadCount;
+            std::size_t _queueCapacity;
+
+        public:     // Public methods
+            // A thread count of 0 uses one thread per hardware thread.
+            GridCorpusLoader(std::size_t threadCount = 0, std::size_t queueCapacity = 64);
+
+            // Load every file and pass results to the consumer, on the calling thread, in completion order.
+            // Files which fail to load are reported to the consumer as well. If the consumer throws,
+            // loading stops and the exception is propagated once workers are done.
+            void load(const std::vector<std::string>& paths, const Consumer& consumer);
+            // Same as above, for every grid file below a directory.
+            void loadDirectory(const std::string& directory, const Consumer& consumer);
+            // Same as above, for every file listed in a manifest.
+            void loadManifest(const std::string& manifestPath, const Consumer& consumer);
+
+            // Load a single grid file, picking the format from its extension: .pxgb for binary, .non for
+            // Tatham puzzles, .g for Olsak puzzles, XML otherwise (webpbn puzzles are recognised from their root).
+            static Grid loadGridFile(const std::string& path);
+            // List grid files (.xml, .pxgb, .non and .g) below a directory, recursively, in sorted order.
+            static std::vector<std::string> listGridFiles(const std::string& directory);
+            // Read a manifest: one path per line, relative to the manifest location unless absolute.
+            // Blank lines and lines starting with '#' are ignored.
+            static std::vector<std::string> readManifest(const std::string& manifestPath);
+    };
+}
+
+#endif//IO__GRID_CORPUS_LOADER_HPP
\ No newline at end of file
@@ -0,0 +1,353 @@
+#include "grid_image_writer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "grid_archive_reader.hpp"
+#include "exceptions/image_export_error.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+#include "../tools/thread_pool.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    namespace
+    {
+        // Grey levels of cells in PGM and PNG images.
+        const unsigned char CHECKED_GREY = 0x00;
+        const unsigned char CLEARED_GREY = 0xFF;
+        const unsigned char CROSSED_GREY = 0xC8;
+
+        // Largest payload of an uncompressed deflate block.
+        const std::size_t DEFLATE_STORED_BLOCK_MAX = 0xFFFF;
+        // Largest number of bytes summed before the Adler-32 sums must be reduced.
+        const std::size_t ADLER32_BLOCK_MAX = 5552;
+
+        std::array<std::uint32_t, 256> makeCRC32Table()
+        {
+            std::array<std::uint32_t, 256> table;
+            for (std::uint32_t n = 0; n < 256; n++)
+            {
+                std::uint32_t c = n;
+                for (int k = 0; k < 8; k++)
+                {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                table[n] = c;
+            }
+            return table;
+        }
+
+        const std::array<std::uint32_t, 256> CRC32_TABLE = makeCRC32Table();
+
+        // CRC-32 as used by PNG chunks (ISO 3309).
+        std::uint32_t crc32(const unsigned char* data, std::size_t size)
+        {
+            std::uint32_t c = 0xFFFFFFFFu;
+            for (std::size_t i = 0; i < size; i++)
+            {
+                c = CRC32_TABLE[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+            }
+            return c ^ 0xFFFFFFFFu;
+        }
+
+        // Adler-32 checksum ending zlib streams (RFC 1950).
+        std::uint32_t adler32(const unsigned char* data, std::size_t size)
+        {
+            std::uint32_t a = 1;
+            std::uint32_t b = 0;
+            while (size > 0)
+            {
+                std::size_t block = std::min(size, ADLER32_BLOCK_MAX);
+                for (std::size_t i = 0; i < block; i++)
+                {
+                    a += data[i];
+                    b += a;
+                }
+                a %= 65521;
+                b %= 65521;
+                data += block;
+                size -= block;
+            }
+            return (b << 16) | a;
+        }
+
+        void appendUInt32BE(std::string& out, std::uint32_t value)
+        {
+            out.push_back((char) (value >> 24));
+            out.push_back((char) (value >> 16));
+            out.push_back((char) (value >> 8));
+            out.push_back((char) value);
+        }
+
+        void appendUInt16LE(std::string& out, std::uint16_t value)
+        {
+            out.push_back((char) value);
+            out.push_back((char) (value >> 8));
+        }
+
+        // Append a PNG chunk: length, type, data, then the CRC of type and data.
+        void appendPNGChunk(std::string& out, const char* type, const std::string& data)
+        {
+            appendUInt32BE(out, (std::uint32_t) data.size());
+            std::size_t crcStart = out.size();
+            out.append(type, 4);
+            out += data;
+            appendUInt32BE(out, crc32((const unsigned char*) out.data() + crcStart, out.size() - crcStart));
+        }
+
+        // Wrap data in a zlib stream made of uncompressed deflate blocks (RFC 1950, RFC 1951).
+        std::string zlibStore(const std::string& data)
+        {
+            std::string out;
+            std::size_t blockCount = std::max<std::size_t>(1, (data.size() + DEFLATE_STORED_BLOCK_MAX - 1) / DEFLATE_STORED_BLOCK_MAX);
+            out.reserve(2 + data.size() + 5 * blockCount + 4);
+
+            // Deflate, 32K window, no preset dictionary, lowest compression level: 0x7801 is a multiple of 31.
+            out.push_back((char) 0x78);
+            out.push_back((char) 0x01);
+
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < blockCount; i++)
+            {
+                std::uint16_t length = (std::uint16_t) std::min(data.size() - offset, DEFLATE_STORED_BLOCK_MAX);
+
+                // BFINAL on the last block, BTYPE 00 (stored), then the length and its one's complement.
+                out.push_back((char) (i == blockCount - 1 ? 0x01 : 0x00));
+                appendUInt16LE(out, length);
+                appendUInt16LE(out, (std::uint16_t) ~length);
+                out.append(data, offset, length);
+                offset += length;
+            }
+
+            appendUInt32BE(out, adler32((const unsigned char*) data.data(), data.size()));
+            return out;
+        }
+
+        unsigned char cellGrey(cell_t cell)
+        {
+            if (cell == CELL_CHECKED) return CHECKED_GREY;
+            if (cell == CELL_CROSSED) return CROSSED_GREY;
+            return CLEARED_GREY;
+        }
+
+        void checkNotEmpty(const Grid& grid)
+        {
+            if (grid.getWidth() == 0 || grid.getHeight() == 0)
+            {
+                throw ImageExportError("Cannot export an image of a grid with no cells.");
+            }
+        }
+
+        void writeFile(const std::string& path, const std::string& data)
+        {
+            std::ofstream f = std::ofstream(path, std::ios::binary | std::ios::trunc);
+            f.write(data.data(), data.size());
+            f.close();
+
+            if (f.fail())
+            {
+                throw ImageExportError("Could not write image file " + path + ".");
+            }
+        }
+    }
+
+    GridImageWriter::GridImageWriter(int scale) :
+        _scale(scale)
+    {
+        if (scale < 1)
+        {
+            throw ImageExportError("Image scale must be at least 1, cannot accept " + std::to_string(scale) + ".");
+        }
+    }
+
+    int GridImageWriter::getScale() const
+    {
+        return _scale;
+    }
+
+    std::string GridImageWriter::renderPBM(const Grid& grid) const
+    {
+        checkNotEmpty(grid);
+        std::size_t width = (std::size_t) grid.getWidth() * _scale;
+        std::size_t height = (std::size_t) grid.getHeight() * _scale;
+        std::size_t rowBytes = (width + 7) / 8;
+
+        std::string out = "P4\n" + std::to_string(width) + " " + std::to_string(height) + "\n";
+        out.reserve(out.size() + rowBytes * height);
+
+        // Pixels are packed 8 to a byte, most significant bit first, set for black.
+        std::string packedRow;
+        for (int i = 0; i < grid.getHeight(); i++)
+        {
+            packedRow.assign(rowBytes, '\0');
+            std::vector<cell_t> row = grid.getRow(i);
+            for (std::size_t x = 0; x < width; x++)
+            {
+                if (row[x / _scale] == CELL_CHECKED) packedRow[x / 8] |= (char) (0x80 >> (x % 8));
+            }
+
+            for (int k = 0; k < _scale; k++)
+            {
+                out += packedRow;
+            }
+        }
+
+        return out;
+    }
+
+    std::string GridImageWriter::renderPGM(const Grid& grid) const
+    {
+        checkNotEmpty(grid);
+        std::size_t width = (std::size_t) grid.getWidth() * _scale;
+        std::size_t height = (std::size_t) grid.getHeight() * _scale;
+
+        std::string out = "P5\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+        out.reserve(out.size() + width * height);
+
+        std::string pixelRow;
+        for (int i = 0; i < grid.getHeight(); i++)
+        {
+            pixelRow.clear();
+            appendGreyRow(pixelRow, grid.getRow(i));
+
+            for (int k = 0; k < _scale; k++)
+            {
+                out += pixelRow;
+            }
+        }
+
+        return out;
+    }
+
+    std::string GridImageWriter::renderPNG(const Grid& grid) const
+    {
+        checkNotEmpty(grid);
+        std::size_t width = (std::size_t) grid.getWidth() * _scale;
+        std::size_t height = (std::size_t) grid.getHeight() * _scale;
+
+        // Raw image data: every scanline starts with its filter type, 0 (none).
+        std::string scanlines;
+        scanlines.reserve((width + 1) * height);
+
+        std::string scanline;
+        for (int i = 0; i < grid.getHeight(); i++)
+        {
+            scanline.assign(1, '\0');
+            appendGreyRow(scanline, grid.getRow(i));
+
+            for (int k = 0; k < _scale; k++)
+            {
+                scanlines += scanline;
+            }
+        }
+
+        // Width, height, bit depth 8, colour type 0 (greyscale), default compression and filter methods, no interlacing.
+        std::string header;
+        appendUInt32BE(header, (std::uint32_t) width);
+        appendUInt32BE(header, (std::uint32_t) height);
+        header += std::string("\x08\x00\x00\x00\x00", 5);
+
+        std::string out = std::string("\x89PNG\r\n\x1a\n", 8);
+        appendPNGChunk(out, "IHDR", header);
+        appendPNGChunk(out, "IDAT", zlibStore(scanlines));
+        appendPNGChunk(out, "IEND", std::string());
+
+        return out;
+    }
+
+    std::string GridImageWriter::render(const Grid& grid, const std::string& extension) const
+    {
+        if (extension == ".pbm") return renderPBM(grid);
+        if (extension == ".pgm") return renderPGM(grid);
+        if (extension == ".png") return renderPNG(grid);
+
+        throw ImageExportError("Unsupported image format \"" + extension + "\", expected .pbm, .pgm or .png.");
+    }
+
+    void GridImageWriter::saveGridToFile(const Grid& grid, const std::string& path) const
+    {
+        writeFile(path, render(grid, fs::path(path).extension().string()));
+    }
+
+    GridImageWriter::BatchResult GridImageWriter::exportArchive(const std::string& archivePath, const std::string& outputDirectory, const std::string& extension, std::size_t threadCount) const
+    {
+        if (!isSupportedExtension(extension))
+        {
+            throw ImageExportError("Unsupported image format \"" + extension + "\", expected .pbm, .pgm or .png.");
+        }
+
+        GridArchiveReader reader = GridArchiveReader(archivePath);
+        fs::create_directories(outputDirectory);
+
+        BatchResult result = {0, {}};
+        std::size_t count = reader.size();
+        if (count == 0) return result;
+
+        std::size_t digits = std::to_string(count - 1).size();
+        std::size_t threads = std::min(threadCount > 0 ? threadCount : ThreadPool::defaultThreadCount(), count);
+        std::mutex resultMutex;
+
+        {
+            ThreadPool pool = ThreadPool(threads);
+            for (std::size_t t = 0; t < threads; t++)
+            {
+                // Each worker takes every `threads`-th grid, so that no work is queued per grid.
+                pool.submit([&, t] ()
+                {
+                    std::size_t written = 0;
+                    std::vector<std::string> errors;
+
+                    for (std::size_t index = t; index < count; index += threads)
+                    {
+                        std::string name = std::to_string(index);
+                        name.insert(0, digits - name.size(), '0');
+                        std::string path = (fs::path(outputDirectory) / (name + extension)).string();
+
+                        try
+                        {
+                            writeFile(path, render(reader.gridAt(index), extension));
+                            written++;
+                        }
+                        catch(const std::exception& e)
+                        {
+                            errors.push_back(path + ": " + e.what());
+                        }
+                    }
+
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    result.written += written;
+                    result.errors.insert(result.errors.end(), errors.begin(), errors.end());
+                });
+            }
+            pool.waitIdle();
+        }
+
+        // File names are zero-padded, sorting messages puts them in archive order.
+        std::sort(result.errors.begin(), result.errors.end());
+        return result;
+    }
+
+    bool GridImageWriter::isSupportedExtension(const std::string& extension)
+    {
+        return extension == ".pbm" || extension == ".pgm" || extension == ".png";
+    }
+
+    void GridImageWriter::appendGreyRow(std::string& out, const std::vector<cell_t>& row) const
+    {
+        for (cell_t cell : row)
+        {
+            out.append(_scale, (char) cellGrey(cell));
+        }
+    }
+}
\ No newline at end of file
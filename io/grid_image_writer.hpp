@@ -0,0 +1,59 @@
+#ifndef IO__GRID_IMAGE_WRITER_HPP
+#define IO__GRID_IMAGE_WRITER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "exceptions/image_export_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Writes the cells of grids as images, one square of `scale` pixels per cell: checked cells are
+    // black, cleared cells are white and crossed cells are light grey where the format allows it
+    // (white in PBM). Supported formats are binary PBM (P4), binary PGM (P5) and 8-bit greyscale PNG,
+    // the latter with uncompressed deflate blocks so that no compression library is needed.
+    class GridImageWriter
+    {
+        public:     // Types
+            // Outcome of a batch export.
+            struct BatchResult
+            {
+                std::size_t written;                // Number of images written.
+                std::vector<std::string> errors;    // One message for each grid which could not be exported.
+            };
+
+        private:    // Attributes
+            int _scale;
+
+        public:     // Public methods
+            explicit GridImageWriter(int scale = 1);
+
+            int getScale() const;
+
+            // Encode a grid into an image held in memory.
+            std::string renderPBM(const Grid& grid) const;
+            std::string renderPGM(const Grid& grid) const;
+            std::string renderPNG(const Grid& grid) const;
+            // Encode a grid in the format its extension tells (.pbm, .pgm or .png), auto-throw if unsupported.
+            std::string render(const Grid& grid, const std::string& extension) const;
+
+            // Save a grid as an image, in the format the extension of the path tells.
+            void saveGridToFile(const Grid& grid, const std::string& path) const;
+
+            // Export every grid of an archive to `<outputDirectory>/<index>.<extension>`, using several
+            // threads (a thread count of 0 uses one thread per hardware thread). Indices are zero-padded
+            // so that files sort in archive order. Grids which fail to export do not stop the others.
+            BatchResult exportArchive(const std::string& archivePath, const std::string& outputDirectory, const std::string& extension, std::size_t threadCount = 0) const;
+
+            // Whether an image format is supported for the given extension (leading dot included).
+            static bool isSupportedExtension(const std::string& extension);
+
+        private:    // Private methods
+            // Append the greyscale pixels of one grid row, `scale` pixels per cell.
+            void appendGreyRow(std::string& out, const std::vector<cell_t>& row) const;
+    };
+}
+
+#endif//IO__GRID_IMAGE_WRITER_HPP
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "grid_journal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include "async_grid_saver.hpp"
+#include "webpbn_grid_reader.hpp"
+#include "exceptions/invalid_grid_journal_error.hpp"
+#include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
+#include "../tools/mapped_file.hpp"
+#include "../tools/varint_tools.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    namespace
+    {
+        std::uint32_t fnv1a(const unsigned char* data, std::size_t size)
+        {
+            std::uint32_t hash = 2166136261u;
+            for (std::size_t i = 0; i < size; i++)
+            {
+                hash ^= data[i];
+                hash *= 16777619u;
+            }
+
+            return hash;
+        }
+    }
+
+    GridJournal::GridJournal(const std::string& basePath, std::shared_ptr<AsyncGridSaver> saver) :
+        _basePath(basePath),
+        _journalPath(journalPathFor(basePath)),
+        _file(nullptr),
+        _recordCount(0),
+        _saver(saver)
+    {
+
+    }
+
+    GridJournal::~GridJournal()
+    {
+        close();
+    }
+
+    const std::string& GridJournal::getBasePath() const
+    {
+        return _basePath;
+    }
+
+    const std::string& GridJournal::getJournalPath() const
+    {
+        return _journalPath;
+    }
+
+    std::size_t GridJournal::recordCount() const
+    {
+        return _recordCount;
+    }
+
+    void GridJournal::reset(const Grid& base)
+    {
+        close();
+        _file = std::fopen(_journalPath.c_str(), "wb");
+        if (!_file)
+        {
+            throw InvalidGridJournalError("Could not open " + _journalPath + " for writing.");
+        }
+
+        std::string header = std::string(MAGIC, 4);
+        header.push_back((char) FORMAT_VERSION);
+        VarintTools::appendVarint(header, base.getWidth());
+        VarintTools::appendVarint(header, base.getHeight());
+
+        if (std::fwrite(header.data(), 1, header.size(), _file) != header.size() || std::fflush(_file) != 0)
+        {
+            close();
+            throw InvalidGridJournalError("Could not write to " + _journalPath + ".");
+        }
+        _recordCount = 0;
+    }
+
+    void GridJournal::append(const GridDelta& delta)
+    {
+        if (!_file)
+        {
+            throw InvalidGridJournalError("Journal " + _journalPath + " is not open.");
+        }
+
+        std::string payload = delta.serialize();
+        std::uint32_t checksum = fnv1a((const unsigned char*) payload.data(), payload.size());
+
+        std::string record;
+        record.reserve(payload.size() + VarintTools::VARINT_MAX_LENGTH + 4);
+        VarintTools::appendVarint(record, payload.size());
+        record += payload;
+        for (int i = 0; i < 4; i++)
+        {
+            record.push_back((char) ((checksum >> (8 * i)) & 0xFF));
+        }
+
+        // The whole record goes out in a single write, followed by a flush.
+        if (std::fwrite(record.data(), 1, record.size(), _file) != record.size() || std::fflush(_file) != 0)
+        {
+            throw InvalidGridJournalError("Could not write to " + _journalPath + ".");
+        }
+        _recordCount++;
+    }
+
+    void GridJournal::compact(const Grid& grid)
+    {
+        // If a crash happens in between, replaying the old journal over the new base file is harmless:
+        // edits record absolute values, all of which the new base file already holds.
+        // Saves in flight write through the same temporary file, and would rename an older grid over this one.
+        if (_saver) _saver->waitIdle();
+        AsyncGridSaver::saveGridToFile(grid, _basePath);
+        reset(grid);
+    }
+
+    void GridJournal::discard()
+    {
+        close();
+        std::error_code ignored;
+        fs::remove(_journalPath, ignored);
+        _recordCount = 0;
+    }
+
+    std::string GridJournal::journalPathFor(const std::string& basePath)
+    {
+        return basePath + ".journal";
+    }
+
+    bool GridJournal::canJournal(const std::string& basePath)
+    {
+        std::string extension = fs::path(basePath).extension().string();
+        if (extension == ".pxgb") return true;
+        if (extension != ".xml") return false;
+
+        // webpbn puzzles share the extension of native XML grids but would be overwritten in the wrong format.
+        std::error_code error;
+        if (!fs::exists(basePath, error)) return true;
+
+        MappedFile file = MappedFile(basePath);
+        return !WebpbnGridReader::isWebpbnDocument((const char*) file.data(), file.size());
+    }
+
+    int GridJournal::replay(const std::string& journalPath, Grid& grid)
+    {
+        MappedFile file = MappedFile(journalPath);
+        const unsigned char* cursor = file.data();
+        const unsigned char* end = cursor + file.size();
+
+        // Header.
+        std::uint64_t width;
+        std::uint64_t height;
+        if ((std::size_t) (end - cursor) < 5 || std::string((const char*) cursor, 4) != std::string(MAGIC, 4) || cursor[4] != FORMAT_VERSION)
+        {
+            throw InvalidGridJournalError(journalPath + " is not a grid journal.");
+        }
+        cursor += 5;
+        if (!VarintTools::readVarint(cursor, end, width) || !VarintTools::readVarint(cursor, end, height))
+        {
+            throw InvalidGridJournalError(journalPath + " has a truncated header.");
+        }
+        if (width != (std::uint64_t) grid.getWidth() || height != (std::uint64_t) grid.getHeight())
+        {
+            throw InvalidGridJournalError(journalPath + " records edits for a grid of different dimensions.");
+        }
+
+        // Records, up to the first incomplete or corrupted one.
+        int applied = 0;
+        while (cursor != end)
+        {
+            std::uint64_t length;
+            if (!VarintTools::readVarint(cursor, end, length) || length + 4 > (std::uint64_t) (end - cursor)) break;
+
+            const unsigned char* payload = cursor;
+            const unsigned char* stored = cursor + length;
+            std::uint32_t checksum = stored[0] | (stored[1] << 8) | (stored[2] << 16) | ((std::uint32_t) stored[3] << 24);
+            if (fnv1a(payload, length) != checksum) break;
+
+            try
+            {
+                apply(grid, GridDelta::deserialize(std::string((const char*) payload, length)));
+            }
+            catch(const std::exception&)
+            {
+                break;
+            }
+
+            cursor = stored + 4;
+            applied++;
+        }
+
+        return applied;
+    }
+
+    void GridJournal::close()
+    {
+        if (_file)
+        {
+            std::fclose(_file);
+            _file = nullptr;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef IO__GRID_JOURNAL_HPP
+#define IO__GRID_JOURNAL_HPP
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "async_grid_saver.hpp"
+#include "exceptions/invalid_grid_journal_error.hpp"
+#include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
+
+namespace Picross
+{
+    // Append-only log of the edits made onto a grid saved in a base file, kept in "<base>.journal".
+    // Each edit costs a few bytes of sequential write instead of a rewrite of the base file, which
+    // only happens on compaction. Layout:
+    //  - magic bytes "PXGJ", a format version byte, then the grid width and height as varints;
+    //  - one record per edit: payload length as a varint, the serialized GridDelta, then a
+    //    little-endian FNV-1a checksum of the payload on 4 bytes.
+    // A record torn by a crash fails its checksum, replay stops right before it.
+    class GridJournal
+    {
+        private:    // Attributes
+            std::string _basePath;
+            std::string _journalPath;
+            std::FILE* _file;
+            std::size_t _recordCount;
+            // Saver which may have saves of the base file in flight (can be nullptr).
+            std::shared_ptr<AsyncGridSaver> _saver;
+
+        public:     // Public methods
+            inline static const char MAGIC[] = "PXGJ";
+            inline static const unsigned char FORMAT_VERSION = 1;
+
+            // The journal file is not touched until reset() is called. Compaction waits for the saves
+            // queued on the saver, if any, so that none of them can overwrite the compacted base file.
+            explicit GridJournal(const std::string& basePath, std::shared_ptr<AsyncGridSaver> saver = nullptr);
+            ~GridJournal();
+
+            GridJournal(const GridJournal& other) = delete;
+            GridJournal& operator=(const GridJournal& other) = delete;
+
+            const std::string& getBasePath() const;
+            const std::string& getJournalPath() const;
+            // Number of edits appended since the last reset.
+            std::size_t recordCount() const;
+
+            // Start a new, empty journal for edits made onto the given grid. Previous content is discarded.
+            void reset(const Grid& base);
+            // Append one edit and hand it over to the OS, so that it survives a crash of the application.
+            void append(const GridDelta& delta);
+            // Write the grid to the base file, then start a new journal on top of it.
+            void compact(const Grid& grid);
+            // Close the journal and remove its file.
+            void discard();
+
+            static std::string journalPathFor(const std::string& basePath);
+            // Whether grids can be compacted into the given base file without losing information:
+            // only native XML and binary grid files qualify.
+            static bool canJournal(const std::string& basePath);
+            // Apply the edits recorded in a journal file onto a grid, and return how many were applied.
+            // Throws InvalidGridJournalError if the journal does not describe a grid of the same dimensions.
+            static int replay(const std::string& journalPath, Grid& grid);
+
+        private:    // Private methods
+            void close();
+    };
+}
+
+#endif//IO__GRID_JOURNAL_HPP
\ No newline at end of file
@@ -7,7 +7,8 @@
 std::ostream& operator<<(std::ostream& os, Picross::Grid const& grid)
 {
     // Print the input grid with hints.
-    Picross::TextGridFormatter txt = Picross::TextGridFormatter();
-    os << txt.renderGridWithHints(grid);
+    // Kept around so that hint gutters are only rendered again when hints change.
+    thread_local Picross::TextGridFormatter txt = Picross::TextGridFormatter();
+    txt.renderGridWithHints(os, grid);
     return os;
 }
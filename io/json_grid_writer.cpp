@@ -0,0 +1,155 @@
+#include "json_grid_writer.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        const char hexDigits[] = "0123456789abcdef";
+
+        void appendHints(std::string& out, const std::vector<std::vector<int>>& hints)
+        {
+            out += '[';
+            for (std::size_t k = 0; k < hints.size(); k++)
+            {
+                if (k > 0) out += ',';
+                out += '[';
+                for (std::size_t l = 0; l < hints[k].size(); l++)
+                {
+                    if (l > 0) out += ',';
+                    JSONGridWriter::appendInteger(out, hints[k][l]);
+                }
+                out += ']';
+            }
+            out += ']';
+        }
+
+        void appendBase64(std::string& out, const std::string& data)
+        {
+            std::size_t start = out.size();
+            out.resize(start + 4 * ((data.size() + 2) / 3));
+            char* it = &out[start];
+
+            std::size_t i = 0;
+            for (; i + 3 <= data.size(); i += 3)
+            {
+                unsigned int chunk = ((unsigned char) data[i] << 16) | ((unsigned char) data[i + 1] << 8) | (unsigned char) data[i + 2];
+                *it++ = base64Alphabet[(chunk >> 18) & 0x3F];
+                *it++ = base64Alphabet[(chunk >> 12) & 0x3F];
+                *it++ = base64Alphabet[(chunk >> 6) & 0x3F];
+                *it++ = base64Alphabet[chunk & 0x3F];
+            }
+
+            std::size_t remaining = data.size() - i;
+            if (remaining > 0)
+            {
+                unsigned int chunk = (unsigned char) data[i] << 16;
+                if (remaining == 2) chunk |= (unsigned char) data[i + 1] << 8;
+                *it++ = base64Alphabet[(chunk >> 18) & 0x3F];
+                *it++ = base64Alphabet[(chunk >> 12) & 0x3F];
+                *it++ = remaining == 2 ? base64Alphabet[(chunk >> 6) & 0x3F] : '=';
+                *it++ = '=';
+            }
+        }
+    }
+
+    JSONGridWriter::JSONGridWriter()
+    {
+
+    }
+
+    void JSONGridWriter::appendGrid(std::string& out, const Grid& grid) const
+    {
+        int width = grid.getWidth();
+        int height = grid.getHeight();
+
+        out += "{\"width\":";
+        appendInteger(out, width);
+        out += ",\"height\":";
+        appendInteger(out, height);
+        out += ",\"rows\":";
+        appendHints(out, grid.getAllRowHints());
+        out += ",\"columns\":";
+        appendHints(out, grid.getAllColHints());
+
+        // Cells, packed 4 per byte as in the binary format.
+        std::string packed = std::string(((std::size_t) width * height + 3) / 4, '\0');
+        std::size_t index = 0;
+        for (int i = 0; i < height; i++)
+        {
+            for (cell_t cell : grid.getRow(i))
+            {
+                packed[index / 4] |= (char) (cell << (2 * (index % 4)));
+                index++;
+            }
+        }
+
+        out += ",\"cells\":\"";
+        appendBase64(out, packed);
+        out += "\"}";
+    }
+
+    std::string JSONGridWriter::writeGrid(const Grid& grid) const
+    {
+        std::string out;
+        appendGrid(out, grid);
+        return out;
+    }
+
+    void JSONGridWriter::writeGrid(std::ostream& os, const Grid& grid) const
+    {
+        std::string out;
+        appendGrid(out, grid);
+        os.write(out.data(), out.size());
+    }
+
+    void JSONGridWriter::appendString(std::string& out, const std::string& s)
+    {
+        out += '"';
+
+        // Copy runs of characters which need no escaping in one go.
+        std::size_t runStart = 0;
+        for (std::size_t i = 0; i < s.size(); i++)
+        {
+            unsigned char c = s[i];
+            if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+            out.append(s, runStart, i - runStart);
+            runStart = i + 1;
+            switch (c)
+            {
+                case '"':   out += "\\\"";  break;
+                case '\\':  out += "\\\\";  break;
+                case '\b':  out += "\\b";   break;
+                case '\f':  out += "\\f";   break;
+                case '\n':  out += "\\n";   break;
+                case '\r':  out += "\\r";   break;
+                case '\t':  out += "\\t";   break;
+                default:
+                    out += "\\u00";
+                    out += hexDigits[c >> 4];
+                    out += hexDigits[c & 0xF];
+                    break;
+            }
+        }
+        out.append(s, runStart, std::string::npos);
+
+        out += '"';
+    }
+
+    void JSONGridWriter::appendInteger(std::string& out, long long value)
+    {
+        char buffer[24];
+        char* end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+        out.append(buffer, end);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef IO__JSON_GRID_WRITER_HPP
+#define IO__JSON_GRID_WRITER_HPP
+
+#include <ostream>
+#include <string>
+
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Writes grids as single-line JSON objects, without building any document tree:
+    //  {"width":W,"height":H,"rows":[[...],...],"columns":[[...],...],"cells":"..."}
+    // Hints are arrays of integers, one per row and per column. Cells are packed the same way as in the
+    // binary format (row-major, 2 bits per cell, 4 cells per byte starting from the low bits), then
+    // encoded in base64 with padding.
+    class JSONGridWriter
+    {
+        public:     // Public methods
+            JSONGridWriter();
+
+            // Append the JSON object of a grid to a string.
+            void appendGrid(std::string& out, const Grid& grid) const;
+            std::string writeGrid(const Grid& grid) const;
+            void writeGrid(std::ostream& os, const Grid& grid) const;
+
+            // Append a JSON string literal, escaping quotes, backslashes and control characters.
+            static void appendString(std::string& out, const std::string& s);
+            static void appendInteger(std::string& out, long long value);
+    };
+}
+
+#endif//IO__JSON_GRID_WRITER_HPP
\ No newline at end of file
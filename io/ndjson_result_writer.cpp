@@ -0,0 +1,96 @@
+#include "ndjson_result_writer.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include "json_grid_writer.hpp"
+
+namespace Picross
+{
+    NDJSONResultWriter::NDJSONResultWriter(std::ostream& os) :
+        _os(os),
+        _buffer(),
+        _written(0),
+        _gridWriter()
+    {
+        _buffer.reserve(FLUSH_THRESHOLD + 4096);
+    }
+
+    NDJSONResultWriter::~NDJSONResultWriter()
+    {
+        flush();
+    }
+
+    void NDJSONResultWriter::write(const Result& result)
+    {
+        appendResult(_buffer, result);
+        _written++;
+
+        if (_buffer.size() >= FLUSH_THRESHOLD)
+        {
+            _os.write(_buffer.data(), _buffer.size());
+            _buffer.clear();
+        }
+    }
+
+    void NDJSONResultWriter::flush()
+    {
+        _os.write(_buffer.data(), _buffer.size());
+        _buffer.clear();
+        _os.flush();
+    }
+
+    std::size_t NDJSONResultWriter::written() const
+    {
+        return _written;
+    }
+
+    void NDJSONResultWriter::appendResult(std::string& out, const Result& result) const
+    {
+        out += "{\"id\":";
+        JSONGridWriter::appendString(out, result.puzzleId);
+        out += ",\"status\":\"";
+        out += statusName(result.status);
+        out += "\",\"timeUs\":";
+        JSONGridWriter::appendInteger(out, std::chrono::duration_cast<std::chrono::microseconds>(result.solveTime).count());
+
+        out += ",\"stats\":{";
+        for (std::size_t k = 0; k < result.stats.size(); k++)
+        {
+            if (k > 0) out += ',';
+            JSONGridWriter::appendString(out, result.stats[k].first);
+            out += ':';
+            JSONGridWriter::appendInteger(out, result.stats[k].second);
+        }
+        out += '}';
+
+        if (!result.message.empty())
+        {
+            out += ",\"message\":";
+            JSONGridWriter::appendString(out, result.message);
+        }
+
+        if (result.grid)
+        {
+            out += ",\"grid\":";
+            _gridWriter.appendGrid(out, *result.grid);
+        }
+
+        out += "}\n";
+    }
+
+    std::string NDJSONResultWriter::statusName(Status status)
+    {
+        switch (status)
+        {
+            case Status::Solved:        return "solved";
+            case Status::Unsolved:      return "unsolved";
+            case Status::Contradiction: return "contradiction";
+            case Status::Timeout:       return "timeout";
+            case Status::Error:         return "error";
+        }
+        return "error";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef IO__NDJSON_RESULT_WRITER_HPP
+#define IO__NDJSON_RESULT_WRITER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "json_grid_writer.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Streams batch solving results as newline-delimited JSON, one object per line:
+    //  {"id":"...","status":"solved","timeUs":123,"stats":{"name":value,...},"message":"...","grid":{...}}
+    // The message and grid members are only present when the result holds one. Lines are gathered in a
+    // buffer which is written out once it grows past a threshold, when flushing, or on destruction.
+    class NDJSONResultWriter
+    {
+        public:     // Types
+            enum class Status
+            {
+                Solved,         // The grid was solved.
+                Unsolved,       // The solver stopped before the grid was solved.
+                Contradiction,  // The hints cannot be satisfied.
+                Timeout,        // The solver ran out of time.
+                Error           // Solving could not be carried out.
+            };
+
+            struct Result
+            {
+                std::string puzzleId;
+                Status status;
+                std::chrono::nanoseconds solveTime;
+                // Named counters, written in order.
+                std::vector<std::pair<std::string, std::int64_t>> stats;
+                // Grid to write alongside the result, if any.
+                const Grid* grid;
+                // Reason of an error or a timeout, written if not empty.
+                std::string message;
+            };
+
+            // Size past which the buffer is written out to the stream.
+            inline static const std::size_t FLUSH_THRESHOLD = 1 << 16;
+
+        private:    // Attributes
+            std::ostream& _os;
+            std::string _buffer;
+            std::size_t _written;
+            JSONGridWriter _gridWriter;
+
+        public:     // Public methods
+            NDJSONResultWriter(std::ostream& os);
+            ~NDJSONResultWriter();
+
+            NDJSONResultWriter(const NDJSONResultWriter& other) = delete;
+            NDJSONResultWriter& operator=(const NDJSONResultWriter& other) = delete;
+
+            void write(const Result& result);
+            // Write buffered lines out and flush the stream.
+            void flush();
+
+            // Number of results written so far.
+            std::size_t written() const;
+
+            // Append the JSON line of a result, newline included.
+            void appendResult(std::string& out, const Result& result) const;
+
+            static std::string statusName(Status status);
+    };
+}
+
+#endif//IO__NDJSON_RESULT_WRITER_HPP
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "non_grid_serializer.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "clue_text.hpp"
+#include "exceptions/invalid_nonogram_file_error.hpp"
+#include "../core/grid.hpp"
+#include "../tools/mapped_file.hpp"
+
+namespace Picross
+{
+    NonGridSerializer::NonGridSerializer()
+    {
+
+    }
+
+    void NonGridSerializer::saveGridToFile(const Grid& grid, std::string path)
+    {
+        std::string data = saveGridToString(grid);
+
+        std::ofstream f = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        if (!f.is_open())
+        {
+            throw InvalidNonogramFileError("Could not open " + path + " for writing.");
+        }
+
+        f.write(data.data(), data.size());
+        f.close();
+        if (f.fail())
+        {
+            throw InvalidNonogramFileError("Could not write to " + path + ".");
+        }
+    }
+
+    std::string NonGridSerializer::saveGridToString(const Grid& grid)
+    {
+        std::string out = "width " + std::to_string(grid.getWidth()) + "\n";
+        out += "height " + std::to_string(grid.getHeight()) + "\n";
+
+        out += "\nrows\n";
+        for (const std::vector<int>& hints : grid.getAllRowHints())
+        {
+            out += formatClueLine(hints, ',') + "\n";
+        }
+
+        out += "\ncolumns\n";
+        for (const std::vector<int>& hints : grid.getAllColHints())
+        {
+            out += formatClueLine(hints, ',') + "\n";
+        }
+
+        return out;
+    }
+
+    Grid NonGridSerializer::loadGridFromFile(std::string path)
+    {
+        MappedFile file = MappedFile(path);
+        return loadGridFromBuffer((const char*) file.data(), file.size());
+    }
+
+    Grid NonGridSerializer::loadGridFromBuffer(const char* data, std::size_t size)
+    {
+        const char* cursor = data;
+        const char* end = data + size;
+        int lineNumber = 0;
+
+        int width = -1;
+        int height = -1;
+        bool rowsFound = false;
+        bool columnsFound = false;
+        std::vector<std::vector<int>> rowHints;
+        std::vector<std::vector<int>> colHints;
+
+        while (cursor != end)
+        {
+            std::string_view line = trimText(nextTextLine(cursor, end));
+            lineNumber++;
+            if (line.empty() || line[0] == '#') continue;
+
+            std::string_view keyword = line.substr(0, line.find_first_of(" \t"));
+            std::string_view value = trimText(line.substr(keyword.size()));
+
+            if (keyword == "width")
+            {
+                width = parseDimension(value, keyword, lineNumber);
+            }
+            else if (keyword == "height")
+            {
+                height = parseDimension(value, keyword, lineNumber);
+            }
+            else if (keyword == "rows")
+            {
+                if (height < 0) throw InvalidNonogramFileError("Section \"rows\" found before \"height\" on line " + std::to_string(lineNumber) + ".");
+                rowHints = readClueSection(cursor, end, height, keyword, lineNumber);
+                rowsFound = true;
+            }
+            else if (keyword == "columns")
+            {
+                if (width < 0) throw InvalidNonogramFileError("Section \"columns\" found before \"width\" on line " + std::to_string(lineNumber) + ".");
+                colHints = readClueSection(cursor, end, width, keyword, lineNumber);
+                columnsFound = true;
+            }
+            // Any other keyword carries metadata only.
+        }
+
+        if (!rowsFound) throw InvalidNonogramFileError("Missing section \"rows\" in provided file.");
+        if (!columnsFound) throw InvalidNonogramFileError("Missing section \"columns\" in provided file.");
+
+        return Grid(width, height, std::move(rowHints), std::move(colHints));
+    }
+
+    int NonGridSerializer::parseDimension(std::string_view value, std::string_view keyword, int lineNumber)
+    {
+        int dimension = parseClueValue(value);
+        if (dimension < 0)
+        {
+            throw InvalidNonogramFileError("Invalid " + std::string(keyword) + " \"" + std::string(value) + "\" on line " + std::to_string(lineNumber) + ".");
+        }
+
+        return dimension;
+    }
+
+    std::vector<std::vector<int>> NonGridSerializer::readClueSection(const char*& cursor, const char* end, int count, std::string_view keyword, int& lineNumber)
+    {
+        std::vector<std::vector<int>> hints = std::vector<std::vector<int>>(count);
+        for (int i = 0; i < count; i++)
+        {
+            if (cursor == end)
+            {
+                throw InvalidNonogramFileError("Section \"" + std::string(keyword) + "\" ends after " + std::to_string(i) + " lines, " + std::to_string(count) + " expected.");
+            }
+
+            // Blank lines are lines with no clue, they belong to the section.
+            std::string_view line = nextTextLine(cursor, end);
+            lineNumber++;
+            if (!parseClueLine(line, hints[i]))
+            {
+                throw InvalidNonogramFileError("Invalid clues \"" + std::string(trimText(line)) + "\" on line " + std::to_string(lineNumber) + ".");
+            }
+        }
+
+        return hints;
+    }
+}
\ No newline at end of file
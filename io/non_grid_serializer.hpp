@@ -0,0 +1,38 @@
+#ifndef IO__NON_GRID_SERIALIZER_HPP
+#define IO__NON_GRID_SERIALIZER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "exceptions/invalid_nonogram_file_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Reads and writes puzzles in the .non format used by Simon Tatham's puzzle collection:
+    // "width" and "height" lines, then "rows" and "columns" sections holding one comma-separated
+    // clue line per row or column. Other keywords (title, author, goal...) are skipped.
+    // Only clues are carried by the format, loaded grids have all their cells cleared.
+    class NonGridSerializer
+    {
+        public:     // Public methods
+            NonGridSerializer();
+
+            void saveGridToFile(const Grid& grid, std::string path);
+            std::string saveGridToString(const Grid& grid);
+            // Memory-maps the file and parses it in a single pass.
+            Grid loadGridFromFile(std::string path);
+            // Parse a puzzle from an in-memory document. Throws InvalidNonogramFileError on malformed input.
+            Grid loadGridFromBuffer(const char* data, std::size_t size);
+
+        private:    // Private methods
+            // Parse the value of a "width" or "height" line, auto-throw if malformed.
+            int parseDimension(std::string_view value, std::string_view keyword, int lineNumber);
+            // Read the `count` clue lines of a "rows" or "columns" section, advancing the cursor.
+            std::vector<std::vector<int>> readClueSection(const char*& cursor, const char* end, int count, std::string_view keyword, int& lineNumber);
+    };
+}
+
+#endif//IO__NON_GRID_SERIALIZER_HPP
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "olsak_grid_reader.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "clue_text.hpp"
+#include "exceptions/invalid_nonogram_file_error.hpp"
+#include "../core/grid.hpp"
+#include "../tools/mapped_file.hpp"
+
+namespace Picross
+{
+    OlsakGridReader::OlsakGridReader()
+    {
+
+    }
+
+    Grid OlsakGridReader::loadGridFromFile(std::string path)
+    {
+        MappedFile file = MappedFile(path);
+        return loadGridFromBuffer((const char*) file.data(), file.size());
+    }
+
+    Grid OlsakGridReader::loadGridFromBuffer(const char* data, std::size_t size)
+    {
+        const char* cursor = data;
+        const char* end = data + size;
+        int lineNumber = 0;
+
+        // 0 before the first section, 1 in rows, 2 in columns, 3 past them.
+        int section = 0;
+        std::vector<std::vector<int>> hints[2];
+        std::vector<int> lineHints;
+
+        while (cursor != end)
+        {
+            std::string_view line = trimText(nextTextLine(cursor, end));
+            lineNumber++;
+
+            if (!line.empty() && line[0] == ':')
+            {
+                section++;
+                continue;
+            }
+            if (section == 0 || section > 2 || line.empty() || line[0] == '#') continue;
+
+            if (!parseClueLine(line, lineHints))
+            {
+                // Clues of coloured puzzles carry a colour suffix, which ends up here as well.
+                throw InvalidNonogramFileError("Invalid clues \"" + std::string(line) + "\" on line " + std::to_string(lineNumber) + " (only black and white puzzles are supported).");
+            }
+            hints[section - 1].push_back(lineHints);
+        }
+
+        if (section < 1) throw InvalidNonogramFileError("Missing row section in provided file.");
+        if (section < 2) throw InvalidNonogramFileError("Missing column section in provided file.");
+
+        int height = (int) hints[0].size();
+        int width = (int) hints[1].size();
+        return Grid(width, height, std::move(hints[0]), std::move(hints[1]));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#ifndef IO__OLSAK_GRID_READER_HPP
+#define IO__OLSAK_GRID_READER_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "exceptions/invalid_nonogram_file_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Reads black and white puzzles in the .g format of Mirek Olsak's griddlers solver: a section
+    // introduced by a line starting with ':' holding one blank-separated clue line per row, then
+    // a second such section for columns. Grid dimensions are given by the number of clue lines.
+    // Lines before the first section (comments, colour definitions) and after the second are skipped.
+    class OlsakGridReader
+    {
+        public:     // Public methods
+            OlsakGridReader();
+
+            // Memory-maps the file and parses it in a single pass.
+            Grid loadGridFromFile(std::string path);
+            // Parse a puzzle from an in-memory document. Throws InvalidNonogramFileError on malformed input.
+            Grid loadGridFromBuffer(const char* data, std::size_t size);
+    };
+}
+
+#endif//IO__OLSAK_GRID_READER_HPP
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "row_rle.hpp"
+
+#include <string>
+#include <string_view>
+
+#include "../core/cell_t.hpp"
+
+namespace Picross
+{
+    std::string encodeRowRLE(const cell_t* cells, int count)
+    {
+        std::string out;
+        int i = 0;
+        while (i < count)
+        {
+            // Measure the run starting at i.
+            int run = 1;
+            while (i + run < count && cells[i + run] == cells[i])
+            {
+                run++;
+            }
+
+            if (run > 1)
+            {
+                out += std::to_string(run);
+            }
+
+            switch (cells[i])
+            {
+                case CELL_CHECKED:
+                    out.push_back(ROW_RLE_CHECKED);
+                    break;
+                case CELL_CROSSED:
+                    out.push_back(ROW_RLE_CROSSED);
+                    break;
+                default:
+                    out.push_back(ROW_RLE_CLEARED);
+                    break;
+            }
+
+            i += run;
+        }
+
+        return out;
+    }
+
+    bool decodeRowRLE(std::string_view text, cell_t* cells, int count)
+    {
+        int filled = 0;
+        int run = 0;
+        bool hasRun = false;
+
+        for (char c : text)
+        {
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+            {
+                continue;
+            }
+
+            if (c >= '0' && c <= '9')
+            {
+                // Runs can never be longer than the row, which also keeps the count from overflowing.
+                run = run * 10 + (c - '0');
+                hasRun = true;
+                if (run > count) return false;
+                continue;
+            }
+
+            cell_t val;
+            switch (c)
+            {
+                case ROW_RLE_CHECKED:
+                    val = CELL_CHECKED;
+                    break;
+                case ROW_RLE_CLEARED:
+                    val = CELL_CLEARED;
+                    break;
+                case ROW_RLE_CROSSED:
+                    val = CELL_CROSSED;
+                    break;
+                default:
+                    return false;
+            }
+
+            if (!hasRun) run = 1;
+            if (run == 0 || filled + run > count) return false;
+
+            for (int k = 0; k < run; k++)
+            {
+                cells[filled++] = val;
+            }
+
+            run = 0;
+            hasRun = false;
+        }
+
+        // A trailing count without a symbol is malformed.
+        return !hasRun && filled == count;
+    }
+}
\ No newline at end of file
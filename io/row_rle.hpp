@@ -0,0 +1,25 @@
+#ifndef IO__ROW_RLE_HPP
+#define IO__ROW_RLE_HPP
+
+#include <string>
+#include <string_view>
+
+#include "../core/cell_t.hpp"
+
+namespace Picross
+{
+    // Symbols used in run-length encoded rows.
+    inline static const char ROW_RLE_CHECKED = '#';
+    inline static const char ROW_RLE_CLEARED = '.';
+    inline static const char ROW_RLE_CROSSED = 'x';
+
+    // Encodes cells as a sequence of runs, each being an optional repeat count followed by a cell symbol
+    // (a missing count means 1). For instance, "3.#2x" stands for 3 cleared, 1 checked and 2 crossed cells.
+    std::string encodeRowRLE(const cell_t* cells, int count);
+
+    // Decodes a run-length encoded row into exactly `count` cells. Whitespace is ignored.
+    // Returns false if the text is malformed or does not describe exactly `count` cells.
+    bool decodeRowRLE(std::string_view text, cell_t* cells, int count);
+}
+
+#endif//IO__ROW_RLE_HPP
\ No newline at end of file
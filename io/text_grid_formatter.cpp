@@ -1,20 +1,39 @@
 #include "text_grid_formatter.hpp"
 #include "../core/utility.hpp"
 #include "../core/exceptions/unrecognized_cell_value_error.hpp"
-#include "../tools/string_tools.hpp"
-#include "../tools/iterable_tools.hpp"
 
-#include <iostream>
-#include <stdexcept>
 #include <algorithm>
-#include <cmath>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace Picross
 {
+	namespace
+	{
+		// Box-drawing characters, built once rather than on every use of the macros.
+		const std::string topLeftChar = TOP_LEFT_CHAR;
+		const std::string topRightChar = TOP_RIGHT_CHAR;
+		const std::string bottomLeftChar = BOTTOM_LEFT_CHAR;
+		const std::string bottomRightChar = BOTTOM_RIGHT_CHAR;
+		const std::string leftCrossChar = LEFT_CROSS_CHAR;
+		const std::string rightCrossChar = RIGHT_CROSS_CHAR;
+		const std::string topCrossChar = TOP_CROSS_CHAR;
+		const std::string bottomCrossChar = BOTTOM_CROSS_CHAR;
+		const std::string middleCrossChar = MIDDLE_CROSS_CHAR;
+		const std::string verticalChar = VERTICAL_CHAR;
+		const std::string horizontalChar = HORIZONTAL_CHAR;
+	}
+
 	TextGridFormatter::TextGridFormatter() :
 		_checkedChar(_defaultCheckedChar),
 		_clearedChar(_defaultClearedChar),
-		_crossedChar(_defaultCrossedChar)
+		_crossedChar(_defaultCrossedChar),
+		_hintGutters()
 	{
 
 	}
@@ -22,87 +41,65 @@ namespace Picross
 	TextGridFormatter::TextGridFormatter(std::string checkedChar, std::string emptyChar, std::string crossedChar) :
 		_checkedChar(checkedChar),
 		_clearedChar(emptyChar),
-		_crossedChar(crossedChar)
+		_crossedChar(crossedChar),
+		_hintGutters()
 	{
 
 	}
 
 	std::string TextGridFormatter::renderGrid(const Grid& grid, bool emptyCrossedCells, int cellWidth)
 	{
-		int width = grid.getWidth();
-		int height = grid.getHeight();
+		RenderLayout layout = computeLayout(grid, false, emptyCrossedCells, cellWidth);
 
+		// The size of the render is known beforehand, so the output is allocated only once.
+		// Border lines are built once per render, whatever the height of the grid.
 		std::string s;
-		// First line.
-		s += renderTopLine(width, cellWidth);
-
-		// All rows and interlines (except the last row).
-		for (int i = 0; i < height - 1; i++)
-		{
-			s += renderRow(grid.getRow(i), emptyCrossedCells, cellWidth);
-			s += renderInterline(width, cellWidth);
-		}
-
-		// Last row and bottom line.
-		s += renderRow(grid.getRow(height - 1), emptyCrossedCells, cellWidth);
-		s += renderBottomLine(width, cellWidth);
+		s.reserve(renderedSize(grid, layout));
+		renderLines(grid, layout, s, nullptr);
 
 		return s;
 	}
 
 	std::string TextGridFormatter::renderGridWithHints(const Grid& grid, bool emptyCrossedCells)
 	{
-		// Separately render 4 elements:
-		// - a padding block (empty space top left of the displayed grid),
-		// - the vertical hints of the grid,
-		// - the horizontal hints of the grid,
-		// - the grid itself.
-		// Then combine all of those to get the final render.
-		//
-		// Several numbers are needed before doing all that:
-		// - the character width of the maximum column hint, which will affect the cell width of the whole grid,
-		// - the width of the widest stringified row hint vector, which will affect the width of the padding block.
+		RenderLayout layout = computeLayout(grid, true, emptyCrossedCells, 1);
 
-		int width = grid.getWidth();
-		int height = grid.getHeight();
+		std::string s;
+		s.reserve(renderedSize(grid, layout));
+		renderLines(grid, layout, s, nullptr);
+
+		return s;
+	}
 
-		// Find the character width of the maximum column hint.
-		int charWidth = findCharWidthFromColHintSequences(grid.getAllColHints());
-		// The above may return garbage in case of no column hints, set it back to 1.
-		if (charWidth < 1) charWidth = 1;
+	void TextGridFormatter::renderGrid(std::ostream& os, const Grid& grid, bool emptyCrossedCells, int cellWidth)
+	{
+		RenderLayout layout = computeLayout(grid, false, emptyCrossedCells, cellWidth);
 
-		// Stringify the row hint vectors.
-		std::vector<std::string> stringifiedRowHints = stringifyRowHintSequences(grid.getAllRowHints());
-		// Generated row hint strings are all the same length.
-		int rowHintStringLength = stringifiedRowHints[0].length();
+		// Only one line is held in memory at any time.
+		std::string line;
+		line.reserve(longestLineSize(grid, layout));
+		renderLines(grid, layout, line, &os);
+	}
 
-		// Stringify the col hint vectors.
-		std::vector<std::vector<std::string>> stringifiedColHints = stringifyColHintSequences(grid.getAllColHints(), charWidth);
+	void TextGridFormatter::renderGridWithHints(std::ostream& os, const Grid& grid, bool emptyCrossedCells)
+	{
+		RenderLayout layout = computeLayout(grid, true, emptyCrossedCells, 1);
 
-		// Get the height of the col hints in the final render (size of any vector in the vector of stringified hint vectors).
-		int colHintsStringHeight = stringifiedColHints[0].size();
+		std::string line;
+		line.reserve(longestLineSize(grid, layout));
+		renderLines(grid, layout, line, &os);
+	}
 
-		// Separately render all four aforementioned blocks.
-		std::string paddingBlock = padBlock(rowHintStringLength, colHintsStringHeight, " ");
-		std::string hHintsStr = renderStringifiedRowHints(stringifiedRowHints);
-		std::string vHintsStr = renderStringifiedColHintSequenceVector(stringifiedColHints);
-		std::string gridStr = renderGrid(grid, emptyCrossedCells, charWidth);
+	TextGridFormatter::RenderGeometry TextGridFormatter::renderGeometry(const Grid& grid, bool withHints, int cellWidth)
+	{
+		if (!withHints) return {cellWidth, 0, 0};
 
-		// In all blocks (if appropriate), remove the final \n to negate useless newline concatenation.
-		if (paddingBlock.length()) paddingBlock.pop_back();
-		if (vHintsStr.length()) vHintsStr.pop_back();
-		if (hHintsStr.length()) hHintsStr.pop_back();
-		gridStr.pop_back();
+		return measureHints(grid.getAllRowHints(), grid.getAllColHints());
+	}
 
-		// Combine all blocks to get the final render.
-		std::string s;
-		if (colHintsStringHeight)
-		{
-			// Only use the top blocks if non-empty, otherwise a useless '\n' is inserted.
-			s += StringTools::multilineConcatenation(paddingBlock, vHintsStr);
-		}
-		s += StringTools::multilineConcatenation(hHintsStr, gridStr);
-		return s;
+	std::size_t TextGridFormatter::renderedSize(const Grid& grid, bool withHints, bool emptyCrossedCells, int cellWidth)
+	{
+		return renderedSize(grid, computeLayout(grid, withHints, emptyCrossedCells, withHints ? 1 : cellWidth));
 	}
 
 	std::string TextGridFormatter::getCharacter(cell_t cellContent)
@@ -185,304 +182,342 @@ namespace Picross
 		_crossedChar = _defaultCrossedChar;
 	}
 
-	int TextGridFormatter::findCharWidthFromColHintSequences(const std::vector<std::vector<int>>& hintVectors)
+	TextGridFormatter::RenderLayout TextGridFormatter::computeLayout(const Grid& grid, bool withHints, bool emptyCrossedCells, int cellWidth)
 	{
-		// Lambda which takes in a vector of ints (assumed unsigned) and returns the max int from it.
-		auto lambda_maxElement = [] (const std::vector<int>& vec) -> int
-		{
-			// Find the max element.
-			auto it = std::max_element(vec.begin(), vec.end());
-			// Return it (or 0 if the vector was empty).
-			return it != vec.end() ? (*it) : 0;
-		};
-
-		// Vector which will receive the greatest hint from each column hint sequence.
-		std::vector<int> maxColHints = std::vector<int>();
-		maxColHints.resize(hintVectors.size());
+		RenderLayout layout;
+		layout.withHints = withHints;
+		layout.emptyCrossedCells = emptyCrossedCells;
+		layout.geometry = {cellWidth, 0, 0};
+		layout.gutters = nullptr;
 
-		// Retrieve the greatest hint in each column of the grid.
-		std::transform(hintVectors.begin(), hintVectors.end(), maxColHints.begin(), lambda_maxElement);
-
-		// Now find the max hint from all the max col hints.
-		int maxHint = *(std::max_element(maxColHints.begin(), maxColHints.end()));
+		if (withHints)
+		{
+			layout.gutters = &hintGutters(grid);
+			layout.geometry = layout.gutters->geometry;
+		}
 
-		// Given the biggest column hint in all the grid, find how much char width is needed to display it.
-		return floor(log10(maxHint)) + 1;
+		return layout;
 	}
 
-	std::string TextGridFormatter::renderRow(const std::vector<cell_t>& row, bool emptyCrossedCells, int cellWidth)
+	TextGridFormatter::RenderGeometry TextGridFormatter::measureHints(const std::vector<std::vector<int>>& rowHints, const std::vector<std::vector<int>>& colHints)
 	{
-		// A row looks like this (cellWidth == 1):
-		// ║■║ ║■║ ║ ║ ... ║×║×║×║ ║
+		// A render with hints is made of 4 blocks:
+		// - a padding block (empty space top left of the displayed grid),
+		// - the vertical hints of the grid,
+		// - the horizontal hints of the grid,
+		// - the grid itself.
+		// Each output line is the concatenation of a line from a left block and a line from a right block.
 		//
-		// (cellWidth == 2):
-		// ║■■║  ║■■║  ║  ║ ... ║××║××║××║  ║
+		// Several numbers are needed before rendering any of them:
+		// - the character width of the maximum column hint, which will affect the cell width of the whole grid,
+		// - the width of the widest row hint sequence, which will affect the width of the left blocks,
+		// - the length of the longest column hint sequence, which will affect the height of the top blocks.
 
-		std::string s;
-		s += VERTICAL_CHAR;
+		RenderGeometry geometry = {1, 0, 0};
 
-		int width = row.size();
-		for (int i = 0; i < width; i++)
+		// Cells are at least one character wide, even without any column hint.
+		int maxHint = 0;
+		for (const std::vector<int>& hints : colHints)
 		{
-			std::string contentChar = getCharacter(row[i]);
-			if (emptyCrossedCells)
+			for (int hint : hints)
 			{
-				contentChar = getCharacter(CELL_CLEARED);
+				if (hint > maxHint) maxHint = hint;
 			}
-			s += pad(cellWidth, contentChar) + VERTICAL_CHAR;
+
+			if ((int) hints.size() > geometry.colHintHeight) geometry.colHintHeight = hints.size();
 		}
-		s += '\n';
+		geometry.cellWidth = digitCount(maxHint);
 
-		return s;
+		for (const std::vector<int>& hints : rowHints)
+		{
+			int hintWidth = hintSequenceWidth(hints);
+			if (hintWidth > geometry.gutterWidth) geometry.gutterWidth = hintWidth;
+		}
+
+		return geometry;
 	}
 
-	std::string TextGridFormatter::renderTopLine(int width, int cellWidth)
+	const TextGridFormatter::HintGutters& TextGridFormatter::hintGutters(const Grid& grid)
 	{
-		// The top line looks like this (cellWidth == 1):
-		// ╔═╦═╦═╦═╦═ ... ╦═╦═╦═╦═╦═╗
-		//
-		// (cellWidth == 2):
-		// ╔══╦══╦══╦══╦══ ... ╦══╦══╦══╦══╦══╗
+		// Hints are the same as last time, nothing to render.
+		if (_hintGutters.hintVersion == grid.hintVersion()) return _hintGutters;
 
-		std::string s;
-		s += TOP_LEFT_CHAR;
+		std::vector<std::vector<int>> rowHints = grid.getAllRowHints();
+		std::vector<std::vector<int>> colHints = grid.getAllColHints();
+		RenderGeometry geometry = measureHints(rowHints, colHints);
 
-		for (int i = 0; i < width - 1; i++)
+		_hintGutters.hintVersion = grid.hintVersion();
+		_hintGutters.geometry = geometry;
+
+		// Column hints, bottom-aligned, next to the padding block:
+		//       ║2║ ║ ║ ║1║
+		//       ║1║3║ ║4║1║
+		_hintGutters.colHintLines.clear();
+		for (int i = 0; i < geometry.colHintHeight; i++)
 		{
-			s += pad(cellWidth, HORIZONTAL_CHAR) + TOP_CROSS_CHAR;
+			_hintGutters.colHintLines.append(geometry.gutterWidth, ' ');
+			appendColHintLine(_hintGutters.colHintLines, colHints, i, geometry.colHintHeight, geometry.cellWidth);
 		}
-		s += pad(cellWidth, HORIZONTAL_CHAR) + TOP_RIGHT_CHAR + '\n';
 
-		return s;
+		// Right-aligned row hints, all of them exactly as wide as the gutter.
+		_hintGutters.rowHints.clear();
+		for (const std::vector<int>& hints : rowHints)
+		{
+			appendRowHints(_hintGutters.rowHints, hints, geometry.gutterWidth);
+		}
+
+		_hintGutters.separator.clear();
+		appendRepeated(_hintGutters.separator, geometry.gutterWidth, horizontalChar);
+
+		return _hintGutters;
 	}
 
-	std::string TextGridFormatter::renderInterline(int width, int cellWidth)
+	std::size_t TextGridFormatter::renderedSize(const Grid& grid, const RenderLayout& layout)
 	{
-		// An interline looks like this (cellWidth == 1):
-		// ╠═╬═╬═╬═╬═╬═ ... ╬═╬═╬═╬═╣
-		//
-		// (cellWidth == 2):
-		// ╠══╬══╬══╬══╬══╬══ ... ╬══╬══╬══╬══╣
+		std::size_t width = grid.getWidth();
+		std::size_t height = grid.getHeight();
+		std::size_t cellWidth = layout.geometry.cellWidth;
 
-		std::string s;
-		s += LEFT_CROSS_CHAR;
+		// Border lines: left corner, then for each cell its horizontal bars and the following junction, then '\n'.
+		std::size_t borderLineSize = topLeftChar.size() + width * (cellWidth * horizontalChar.size() + topCrossChar.size()) + 1;
 
-		for (int i = 0; i < width - 1; i++)
+		// Rows: a vertical bar for each cell plus one, the cell characters and '\n'.
+		std::size_t size = (height + 1) * borderLineSize;
+		size += height * ((width + 1) * verticalChar.size() + 1);
+		for (cell_t value : {CELL_CHECKED, CELL_CLEARED, CELL_CROSSED})
 		{
-			s += pad(cellWidth, HORIZONTAL_CHAR) + MIDDLE_CROSS_CHAR;
+			size += (std::size_t) grid.getCellCount(value) * cellWidth * cellCharacter(value, layout.emptyCrossedCells).size();
 		}
-		s += pad(cellWidth, HORIZONTAL_CHAR) + RIGHT_CROSS_CHAR + '\n';
 
-		return s;
+		if (layout.gutters != nullptr)
+		{
+			// Column hint lines, a horizontal separator before each border line, the hints before each row.
+			size += layout.gutters->colHintLines.size();
+			size += (height + 1) * layout.gutters->separator.size();
+			size += layout.gutters->rowHints.size();
+		}
+
+		return size;
 	}
 
-	std::string TextGridFormatter::renderBottomLine(int width, int cellWidth)
+	std::size_t TextGridFormatter::longestLineSize(const Grid& grid, const RenderLayout& layout)
 	{
-		// The bottom line looks like this (cellWidth == 1):
-		// ╚═╩═╩═╩═╩═ ... ╩═╩═╩═╩═╩═╝
-		//
-		// (cellWidth == 2)
-		// ╚══╩══╩══╩══╩══ ... ╩══╩══╩══╩══╩══╝
-		
-		std::string s;
-		s += BOTTOM_LEFT_CHAR;
+		std::size_t width = grid.getWidth();
+		std::size_t cellWidth = layout.geometry.cellWidth;
+		std::size_t gutterBytes = layout.gutters != nullptr ? layout.gutters->separator.size() : 0;
 
-		for (int i = 0; i < width - 1; i++)
-		{
-			s += pad(cellWidth, HORIZONTAL_CHAR) + BOTTOM_CROSS_CHAR;
-		}
-		s += pad(cellWidth, HORIZONTAL_CHAR) + BOTTOM_RIGHT_CHAR + '\n';
+		std::size_t maxCharSize = std::max({_checkedChar.size(), _clearedChar.size(), _crossedChar.size()});
+		std::size_t borderLineSize = topLeftChar.size() + width * (cellWidth * horizontalChar.size() + topCrossChar.size()) + 1;
+		std::size_t rowLineSize = (width + 1) * verticalChar.size() + width * cellWidth * maxCharSize + 1;
 
-		return s;
+		return gutterBytes + std::max(borderLineSize, rowLineSize);
 	}
 
-	std::string TextGridFormatter::renderStringifiedRowHints(const std::vector<std::string>& stringifiedHintVectors)
+	void TextGridFormatter::renderLines(const Grid& grid, const RenderLayout& layout, std::string& buffer, std::ostream* os)
 	{
-		// Guarantee: input strings are all the same length.
-		int stringLength = stringifiedHintVectors[0].length();
+		int width = grid.getWidth();
+		int height = grid.getHeight();
+		int cellWidth = layout.geometry.cellWidth;
+		int gutterWidth = layout.geometry.gutterWidth;
 
-		std::string s;
-		for (auto it = stringifiedHintVectors.begin(); it != stringifiedHintVectors.end(); it++)
+		// Hand the line over to the stream, if any, and reuse the buffer for the next one.
+		auto endLine = [&buffer, os] ()
 		{
-			// Generate a separator string like:
-			// ══════════ ... ═════════
-			s += pad(stringLength, HORIZONTAL_CHAR) + '\n';
+			if (os == nullptr) return;
+			os->write(buffer.data(), buffer.size());
+			buffer.clear();
+		};
 
-			// Concatenate the padded hints.
-			s += *it + '\n';
+		// Hint gutters come from the cache, only the cell area is rendered.
+		static const std::string noGutter;
+		const std::string& separator = layout.gutters != nullptr ? layout.gutters->separator : noGutter;
+		if (layout.gutters != nullptr)
+		{
+			const std::string& colHintLines = layout.gutters->colHintLines;
+			if (os != nullptr) os->write(colHintLines.data(), colHintLines.size());
+			else buffer += colHintLines;
 		}
-		// Generate bottom separator string.
-		s += pad(stringLength, HORIZONTAL_CHAR) + '\n';
 
-		return s;
-	}
+		// Border lines and cell contents are the same all over the grid, build them once and copy them around.
+		std::string topLine, interline, bottomLine;
+		appendBorderLine(topLine, width, cellWidth, topLeftChar, topCrossChar, topRightChar);
+		appendBorderLine(interline, width, cellWidth, leftCrossChar, middleCrossChar, rightCrossChar);
+		appendBorderLine(bottomLine, width, cellWidth, bottomLeftChar, bottomCrossChar, bottomRightChar);
 
-	std::string TextGridFormatter::renderStringifiedColHintSequenceVector(const std::vector<std::vector<std::string>>& stringifiedHintVectors)
-	{
-		// Guarantee: input vectors are all the same size.
-		int sequenceLength = stringifiedHintVectors[0].size();
+		std::array<std::string, CELL_T_VALUE_COUNT> cellSegments;
+		for (cell_t value : CELL_T_ORDERED_VALUES)
+		{
+			appendRepeated(cellSegments[value], cellWidth, cellCharacter(value, layout.emptyCrossedCells));
+			cellSegments[value] += verticalChar;
+		}
 
-		std::string s;
-		// For every row of hints across the hint vectors...
-		for (int i = 0; i < sequenceLength; i++)
+		// Every border line of the grid is preceded by a horizontal separator in the row hint gutter,
+		// every row is preceded by its right-aligned hints:
+		// ═════╔═╦═╗
+		//   1 2║■║ ║
+		// ═════╠═╬═╣
+		for (int i = 0; i < height; i++)
 		{
-			// Render the row across the vectors, which will ultimately look like that:
-			// ║2║ ║ ║ ║1║
+			buffer += separator;
+			buffer += (i == 0) ? topLine : interline;
+			endLine();
 
-			for (auto it = stringifiedHintVectors.begin(); it != stringifiedHintVectors.end(); it++)
-			{
-				s += VERTICAL_CHAR + it->at(i);
-			}
-			s += VERTICAL_CHAR + '\n';
+			if (layout.gutters != nullptr) buffer.append(layout.gutters->rowHints, i * gutterWidth, gutterWidth);
+			appendRow(buffer, grid, i, cellSegments);
+			endLine();
 		}
 
-		return s;
+		buffer += separator;
+		buffer += bottomLine;
+		endLine();
 	}
 
-	std::string TextGridFormatter::pad(int length, const std::string& padString)
+	const std::string& TextGridFormatter::cellCharacter(cell_t cellContent, bool emptyCrossedCells)
 	{
-		std::string s;
-		for (int i = 0; i < length; i++)
+		switch(cellContent)
 		{
-			s += padString;
+			case CELL_CHECKED:
+				return _checkedChar;
+			case CELL_CLEARED:
+				return _clearedChar;
+			case CELL_CROSSED:
+				return emptyCrossedCells ? _clearedChar : _crossedChar;
+			default:
+				// Auto throw if character is not valid.
+				isValidCellValue(cellContent, true);
+				// Otherwise the cell state might just not be recognized.
+				std::string s = "TextGridFormatter: unhandled cell value: " + cellValueToString(cellContent) + ".\n";
+				throw UnrecognizedCellValueError(s);
 		}
-		return s;
 	}
 
-	std::string TextGridFormatter::padBlock(int width, int height, const std::string& padString)
+	void TextGridFormatter::appendBorderLine(std::string& s, int width, int cellWidth, const std::string& left, const std::string& cross, const std::string& right)
 	{
-		std::string s;
-		for (int i = 0; i < height; i++)
+		// The top line looks like this (cellWidth == 1):
+		// ╔═╦═╦═╦═╦═ ... ╦═╦═╦═╦═╦═╗
+		//
+		// (cellWidth == 2):
+		// ╔══╦══╦══╦══╦══ ... ╦══╦══╦══╦══╦══╗
+		//
+		// Interlines and the bottom line only differ in their junction characters.
+
+		s += left;
+		for (int i = 0; i < width - 1; i++)
 		{
-			s += pad(width, padString) + '\n';
+			appendRepeated(s, cellWidth, horizontalChar);
+			s += cross;
 		}
-		return s;
+		appendRepeated(s, cellWidth, horizontalChar);
+		s += right;
+		s += '\n';
 	}
 
-	std::vector<std::string> TextGridFormatter::stringifyRowHintSequences(const std::vector<std::vector<int>>& hintVectors)
+	void TextGridFormatter::appendRow(std::string& s, const Grid& grid, int row, const std::array<std::string, CELL_T_VALUE_COUNT>& cellSegments)
 	{
-		// Vector which will receive the stringified hint sequences.
-		std::vector<std::string> stringifiedHints;
-		int maxStringLength = 0;
+		// A row looks like this (cellWidth == 1):
+		// ║■║ ║■║ ║ ║ ... ║×║×║×║ ║
+		//
+		// (cellWidth == 2):
+		// ║■■║  ║■■║  ║  ║ ... ║××║××║××║  ║
 
-		// For each hint sequence...
-		for (auto it = hintVectors.begin(); it != hintVectors.end(); it++)
-		{
-			// Turn it into a string.
-			std::string stringifiedVector = StringTools::iterableToString(*it);
+		// Cells are read in place, rendering a row allocates nothing once the buffer is large enough.
+		const cell_t* cells = grid.getRowData(row);
+		const cell_t* cellsEnd = cells + grid.getWidth();
 
-			// Update the max generated string length if needed.
-			if (stringifiedVector.length() > maxStringLength)
-			{
-				maxStringLength = stringifiedVector.length();
-			}
-			stringifiedHints.push_back(stringifiedVector);
-		}
-
-		// Pad all generated strings when needed.
-		for (auto it = stringifiedHints.begin(); it != stringifiedHints.end(); it++)
+		// Appending cells one by one is dominated by per-call overhead, grow the string once and copy the segments in place.
+		std::size_t rowSize = verticalChar.size() + 1;
+		for (const cell_t* cell = cells; cell != cellsEnd; cell++)
 		{
-			int padLength = maxStringLength - it->length();
-			*it = pad(padLength, " ") + *it;
+			rowSize += cellSegments[*cell].size();
 		}
 
-		// Example:
-		// 		hintVectors:
-		// 		{
-		//			{3, 4, 1},
-		// 			{2, 2, 2, 2},
-		// 			{7, 2}
-		// 		}
-		//
-		//		will give
-		//
-		// 		stringifiedHints:
-		// 		{
-		//			"  3 4 1",
-		//			"2 2 2 2",
-		//			"    7 2"
-		// 		}
-		// 		and maxStringLength: 7
-
-		return stringifiedHints;
-	}
-
-	std::vector<std::vector<std::string>> TextGridFormatter::stringifyColHintSequences(const std::vector<std::vector<int>>& hintVectors, int charWidth)
-	{
-		// Get the size of the biggest hint sequence.
-		int maxHintSequenceLength = IterTools::maxIterableLength(hintVectors);
-
-		// Vector which will receive the sequences of stringified hints.
-		std::vector<std::vector<std::string>> stringifiedHints = std::vector<std::vector<std::string>>();
+		std::size_t offset = s.size();
+		s.resize(offset + rowSize);
+		char* out = &s[offset];
 
-		// Transform int hint vectors into padded string hint vectors.
-		for (auto it = hintVectors.begin(); it != hintVectors.end(); it++)
+		out = std::copy(verticalChar.begin(), verticalChar.end(), out);
+		for (const cell_t* cell = cells; cell != cellsEnd; cell++)
 		{
-			// Turn each int hint sequence into a string hint sequence, each of which is space-padded to match charWidth.
-			// Every output string sequence will be the same size as all others, as empty strings will be prepended to each in order to match maxHintSequenceLength.
-			stringifiedHints.push_back(stringifyColHintsInVector(*it, charWidth, maxHintSequenceLength));
+			const std::string& segment = cellSegments[*cell];
+			out = std::copy(segment.begin(), segment.end(), out);
 		}
-
-		// Example:
-		// 		hintVectors:
-		// 		{
-		//			{3, 4, 1},
-		// 			{2, 2, 2, 2},
-		// 			{7, 2}
-		// 		}
-		//
-		//		will give
-		//
-		// 		stringifiedHints:
-		// 		{
-		//			{" ", "3", "4", "1"},
-		//			{"2", "2", "2", "2"},
-		//			{" ", " ", "7", "2"}
-		// 		}
-
-		return stringifiedHints;
+		*out = '\n';
 	}
 
-	std::vector<std::string> TextGridFormatter::stringifyColHintsInVector(const std::vector<int>& hints, int charWidth, int maxHintSequenceLength)
+	void TextGridFormatter::appendColHintLine(std::string& s, const std::vector<std::vector<int>>& colHints, int line, int height, int charWidth)
 	{
-		// Vector which will receive stringified hints.
-		std::vector<std::string> stringifiedHints;
-
-		// Calculate how many empty strings need to be generated and prepended to the final vector.
-		// This is so the hints, once rendered, will all be the same size vertically, like so: (double-quotes added for clarity)
+		// Hint sequences shorter than the tallest one are padded with blanks on top,
+		// so that all of them end on the last line: (double-quotes added for clarity)
 		// ║" 2"║"  "║"  "║"  "║"10"║
 		// ║" 1"║"10"║" 4"║"  "║" 5"║
-		int hintSequenceLengthDiff = maxHintSequenceLength - hints.size();
 
-		// Generate empty strings and prepend them to the final vector.
-		for (int i = 0; i < hintSequenceLengthDiff; i++)
+		for (const std::vector<int>& hints : colHints)
 		{
-			stringifiedHints.push_back(pad(charWidth, " "));
+			s += verticalChar;
+
+			int index = line - (height - (int) hints.size());
+			if (index < 0) s.append(charWidth, ' ');
+			else appendHint(s, hints[index], charWidth);
 		}
+		s += verticalChar;
+		s += '\n';
+	}
+
+	void TextGridFormatter::appendRowHints(std::string& s, const std::vector<int>& hints, int gutterWidth)
+	{
+		// Example with a gutter 7 characters wide:
+		// 		{3, 4, 1} gives "  3 4 1"
+		// 		{2, 2, 2, 2} gives "2 2 2 2"
+		// 		{7, 2} gives "    7 2"
 
-		// Transform int hints into space-padded string hints and append them to the final vector.
+		s.append(gutterWidth - hintSequenceWidth(hints), ' ');
 		for (auto it = hints.begin(); it != hints.end(); it++)
 		{
-			// For each hint in the sequence, strigify and pad it.
-			stringifiedHints.push_back(stringifyAndPadHint(*it, charWidth));
+			if (it != hints.begin()) s += ' ';
+			appendHint(s, *it, 1);
 		}
+	}
 
-		return stringifiedHints;
+	void TextGridFormatter::appendRepeated(std::string& s, int count, const std::string& padString)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			s += padString;
+		}
 	}
 
-	std::string TextGridFormatter::stringifyAndPadHint(const int& hint, int charWidth)
+	void TextGridFormatter::appendHint(std::string& s, int hint, int charWidth)
 	{
-		// Stringify the hint.
-		std::string s = std::to_string(hint);
-		// Calculate needed padding width.
-		int padLength = charWidth - s.length();
+		char digits[16];
+		std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), hint);
+		int length = result.ptr - digits;
 
 		// Prepend padding if needed.
-		if (padLength > 0)
+		if (length < charWidth) s.append(charWidth - length, ' ');
+		s.append(digits, length);
+	}
+
+	int TextGridFormatter::digitCount(int hint)
+	{
+		int count = 1;
+		while (hint >= 10)
 		{
-			s = pad(padLength, " ") + s;
+			hint /= 10;
+			count++;
 		}
+		return count;
+	}
 
-		return s;
+	int TextGridFormatter::hintSequenceWidth(const std::vector<int>& hints)
+	{
+		if (hints.empty()) return 0;
+
+		// Digits of every hint, plus a space between each of them.
+		int width = hints.size() - 1;
+		for (int hint : hints)
+		{
+			width += digitCount(hint);
+		}
+		return width;
 	}
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #ifndef IO__TEXT_GRID_FORMATTER_HPP
 #define IO__TEXT_GRID_FORMATTER_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -24,6 +28,42 @@ namespace Picross
 {
 	class TextGridFormatter
 	{
+		public:		// Types
+			// Where cells end up in a render, in characters.
+			struct RenderGeometry
+			{
+				int cellWidth;
+				// Width of the row hints on the left of the grid.
+				int gutterWidth;
+				// Number of column hint lines above the grid.
+				int colHintHeight;
+			};
+
+		private:	// Private types
+			// Hint gutters rendered for a given version of grid hints.
+			struct HintGutters
+			{
+				// Version of the hints these were rendered from, 0 if none.
+				std::uint64_t hintVersion = 0;
+				RenderGeometry geometry;
+				// Column hint lines, left padding included.
+				std::string colHintLines;
+				// Row hints of every row, each exactly as wide as the gutter.
+				std::string rowHints;
+				// Horizontal bar across the gutter.
+				std::string separator;
+			};
+
+			// Dimensions of a render, computed once before writing anything.
+			struct RenderLayout
+			{
+				bool withHints;
+				bool emptyCrossedCells;
+				RenderGeometry geometry;
+				// Cached hint gutters, nullptr when rendering without hints.
+				const HintGutters* gutters;
+			};
+
 		private:	// Attributes
 		// Cell display characters
 			inline static const std::string _defaultCheckedChar = "■";
@@ -34,6 +74,9 @@ namespace Picross
 			std::string _clearedChar;
 			std::string _crossedChar;
 
+			// Hints change far less often than cells: their rendering is kept until the hints of the grid change.
+			HintGutters _hintGutters;
+
 		public:		// Public methods
 			TextGridFormatter();
 			TextGridFormatter(std::string checkedChar, std::string emptyChar, std::string crossedChar);
@@ -41,6 +84,14 @@ namespace Picross
 		// Rendering
 			std::string renderGrid(const Grid& grid, bool emptyCrossedCells = false, int cellWidth = 1);
 			std::string renderGridWithHints(const Grid& grid, bool emptyCrossedCells = false);
+			// Stream the render line by line, without building the whole string.
+			void renderGrid(std::ostream& os, const Grid& grid, bool emptyCrossedCells = false, int cellWidth = 1);
+			void renderGridWithHints(std::ostream& os, const Grid& grid, bool emptyCrossedCells = false);
+
+			// Where cells end up in a render.
+			static RenderGeometry renderGeometry(const Grid& grid, bool withHints, int cellWidth = 1);
+			// Exact size in bytes of a render, as reserved before rendering into a string.
+			std::size_t renderedSize(const Grid& grid, bool withHints, bool emptyCrossedCells = false, int cellWidth = 1);
 			
 		// Cell character customization
 			std::string getCharacter(cell_t cellContent);
@@ -49,40 +100,40 @@ namespace Picross
 			void resetAllCharacters();
 
 		private:	// Private methods
-			// Find the minimum char width needed to render given vertical hints.
-			static int findCharWidthFromColHintSequences(const std::vector<std::vector<int>>& hintVectors);
-
-		// Grid rendering tools
-			// Renders the provided grid row into a string.
-			std::string renderRow(const std::vector<cell_t>& row, bool emptyCrossedCells, int cellWidth);
-			// Renders the top line of a grid into a string.
-			static std::string renderTopLine(int width, int cellWidth);
-			// Renders an interline of a grid into a string.
-			static std::string renderInterline(int width, int cellWidth);
-			// Renders the bottom line of a grid into a string.
-			static std::string renderBottomLine(int width, int cellWidth);
-
-		// Hint rendering tools
-			// Renders the horizontal hints of a grid into a string.
-			static std::string renderStringifiedRowHints(const std::vector<std::string>& stringifiedHintVectors);
-			// Renders the vertical hints of a grid into a string.
-			static std::string renderStringifiedColHintSequenceVector(const std::vector<std::vector<std::string>>& stringifiedHintVectors);
-
-		// Padding tools
-			// Returns a string containing `length` times `padString`.
-			static std::string pad(int length, const std::string& padString);
-			// Returns a string containing `height` lines, each containing `width` times `padString`.
-			static std::string padBlock(int width, int height, const std::string& padString);
-
-		// Hint stringifying tools
-			// Turns a vector of hint sequences into a vector of stringified hint sequences.
-			static std::vector<std::string> stringifyRowHintSequences(const std::vector<std::vector<int>>& hintVectors);
-			// Turn a vector of int hint sequences into a vector of individually stringified and padded hints.
-			static std::vector<std::vector<std::string>> stringifyColHintSequences(const std::vector<std::vector<int>>& hintVectors, int charWidth);
-			// Given a hint sequence, individually stringify and pad every hint, and prepend empty strings to the final vector so its size matches the requested max hint sequence length.
-			static std::vector<std::string> stringifyColHintsInVector(const std::vector<int>& hints, int charWidth, int maxHintSequenceLength);
-			// Stringify a single hint and pad it so the final string length matches the requested char width.
-			static std::string stringifyAndPadHint(const int& hint, int charWidth);
+			// Compute the layout of a render with or without hints, rendering hint gutters if they are not cached.
+			RenderLayout computeLayout(const Grid& grid, bool withHints, bool emptyCrossedCells, int cellWidth);
+			// Measure a render with hints.
+			static RenderGeometry measureHints(const std::vector<std::vector<int>>& rowHints, const std::vector<std::vector<int>>& colHints);
+			// Get the hint gutters of a grid, rendering them only if the cached ones are for different hints.
+			const HintGutters& hintGutters(const Grid& grid);
+			// Exact size in bytes of a render with the given layout.
+			std::size_t renderedSize(const Grid& grid, const RenderLayout& layout);
+			// Size in bytes of the longest line of a render with the given layout.
+			std::size_t longestLineSize(const Grid& grid, const RenderLayout& layout);
+			// Write a render line by line into `buffer`. When `os` is provided, every line is flushed to it and the buffer is reused.
+			void renderLines(const Grid& grid, const RenderLayout& layout, std::string& buffer, std::ostream* os);
+			// Character a cell is displayed with, auto-throw if the cell value is not recognized.
+			const std::string& cellCharacter(cell_t cellContent, bool emptyCrossedCells);
+
+		// Line rendering tools (all of them append to `s`, including the final '\n' where relevant)
+			// Appends a horizontal border line, such as ╔═╦═╗, ╠═╬═╣ or ╚═╩═╝.
+			static void appendBorderLine(std::string& s, int width, int cellWidth, const std::string& left, const std::string& cross, const std::string& right);
+			// Appends a row of cells, such as ║■║ ║×║, given the rendered cell contents (each followed by its right bar) indexed by cell value.
+			static void appendRow(std::string& s, const Grid& grid, int row, const std::array<std::string, CELL_T_VALUE_COUNT>& cellSegments);
+			// Appends the `line`-th line of column hints, bottom-aligned, such as ║2║ ║ ║1║.
+			static void appendColHintLine(std::string& s, const std::vector<std::vector<int>>& colHints, int line, int height, int charWidth);
+			// Appends a row hint sequence, space-separated and right-aligned to `gutterWidth`.
+			static void appendRowHints(std::string& s, const std::vector<int>& hints, int gutterWidth);
+			// Appends `count` times `padString`.
+			static void appendRepeated(std::string& s, int count, const std::string& padString);
+			// Appends a hint right-aligned to `charWidth`.
+			static void appendHint(std::string& s, int hint, int charWidth);
+
+		// Measuring tools
+			// Number of decimal digits in a hint.
+			static int digitCount(int hint);
+			// Character width of a space-separated hint sequence.
+			static int hintSequenceWidth(const std::vector<int>& hints);
 	};
 }
 
@@ -0,0 +1,150 @@
+#include "webpbn_grid_reader.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "clue_text.hpp"
+#include "xml_tokenizer.hpp"
+#include "exceptions/invalid_nonogram_file_error.hpp"
+#include "exceptions/tinyxml2_error.hpp"
+#include "../core/grid.hpp"
+#include "../tools/mapped_file.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        // Which clue collection is being read.
+        const int CLUES_NONE = -1;
+        const int CLUES_ROWS = 0;
+        const int CLUES_COLUMNS = 1;
+    }
+
+    WebpbnGridReader::WebpbnGridReader()
+    {
+
+    }
+
+    Grid WebpbnGridReader::loadGridFromFile(std::string path)
+    {
+        MappedFile file = MappedFile(path);
+        return loadGridFromBuffer((const char*) file.data(), file.size());
+    }
+
+    Grid WebpbnGridReader::loadGridFromBuffer(const char* data, std::size_t size)
+    {
+        XMLTokenizer tokens = XMLTokenizer(data, size);
+
+        bool inPuzzle = false;
+        bool puzzleDone = false;
+        int colorCount = 0;
+        int clues = CLUES_NONE;
+        bool inLine = false;
+        bool inCount = false;
+        std::string_view countText;
+        bool found[2] = { false, false };
+        std::vector<std::vector<int>> hints[2];
+
+        int token;
+        while (!puzzleDone && (token = tokens.next()) != XMLTokenizer::TOKEN_END_OF_INPUT)
+        {
+            std::string_view name = tokens.name();
+            if (token == XMLTokenizer::TOKEN_START_ELEMENT)
+            {
+                if (!inPuzzle)
+                {
+                    inPuzzle = (name == "puzzle");
+                    if (inPuzzle)
+                    {
+                        const XMLTokenizer::Attribute* type = tokens.findAttribute("type");
+                        if (type && type->value != "grid")
+                        {
+                            throw InvalidNonogramFileError("Unsupported puzzle type \"" + std::string(type->value) + "\" in provided file.");
+                        }
+                    }
+                }
+                else if (name == "color" && clues == CLUES_NONE)
+                {
+                    colorCount++;
+                }
+                else if (name == "clues")
+                {
+                    const XMLTokenizer::Attribute* type = tokens.findAttribute("type");
+                    std::string_view value = type ? type->value : std::string_view();
+                    clues = (value == "rows") ? CLUES_ROWS : (value == "columns") ? CLUES_COLUMNS : CLUES_NONE;
+                    if (clues == CLUES_NONE)
+                    {
+                        throw InvalidNonogramFileError("Invalid clues type \"" + std::string(value) + "\" on line " + std::to_string(tokens.line()) + ".");
+                    }
+                    found[clues] = true;
+                    hints[clues].clear();
+                }
+                else if (name == "line" && clues != CLUES_NONE)
+                {
+                    inLine = true;
+                    hints[clues].emplace_back();
+                }
+                else if (name == "count" && inLine)
+                {
+                    inCount = true;
+                    countText = std::string_view();
+                }
+            }
+            else if (token == XMLTokenizer::TOKEN_TEXT)
+            {
+                if (inCount) countText = tokens.text();
+            }
+            else if (token == XMLTokenizer::TOKEN_END_ELEMENT)
+            {
+                if (name == "count" && inCount)
+                {
+                    inCount = false;
+                    int value = parseClueValue(trimText(countText));
+                    if (value <= 0)
+                    {
+                        throw InvalidNonogramFileError("Invalid count \"" + std::string(trimText(countText)) + "\" on line " + std::to_string(tokens.line()) + ".");
+                    }
+                    hints[clues].back().push_back(value);
+                }
+                else if (name == "line")
+                {
+                    inLine = false;
+                }
+                else if (name == "clues")
+                {
+                    clues = CLUES_NONE;
+                }
+                else if (name == "puzzle" && inPuzzle)
+                {
+                    puzzleDone = true;
+                }
+            }
+        }
+
+        if (!inPuzzle) throw InvalidNonogramFileError("Missing element \"puzzle\" in provided file.");
+        if (colorCount > 2) throw InvalidNonogramFileError("Puzzle uses " + std::to_string(colorCount) + " colors, only black and white puzzles are supported.");
+        if (!found[CLUES_ROWS]) throw InvalidNonogramFileError("Missing row clues in provided file.");
+        if (!found[CLUES_COLUMNS]) throw InvalidNonogramFileError("Missing column clues in provided file.");
+
+        int height = (int) hints[CLUES_ROWS].size();
+        int width = (int) hints[CLUES_COLUMNS].size();
+        return Grid(width, height, std::move(hints[CLUES_ROWS]), std::move(hints[CLUES_COLUMNS]));
+    }
+
+    bool WebpbnGridReader::isWebpbnDocument(const char* data, std::size_t size)
+    {
+        try
+        {
+            XMLTokenizer tokens = XMLTokenizer(data, size);
+            if (tokens.next() != XMLTokenizer::TOKEN_START_ELEMENT) return false;
+            return tokens.name() == "puzzleset" || tokens.name() == "puzzle";
+        }
+        catch(const tinyxml2::TinyXML2Error&)
+        {
+            return false;
+        }
+    }
+}
\ No newline at end of file
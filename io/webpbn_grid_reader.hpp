@@ -0,0 +1,33 @@
+#ifndef IO__WEBPBN_GRID_READER_HPP
+#define IO__WEBPBN_GRID_READER_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "exceptions/invalid_nonogram_file_error.hpp"
+#include "exceptions/tinyxml2_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Reads black and white puzzles in the XML format of webpbn.com: a <puzzle> element, optionally
+    // wrapped in a <puzzleset>, holding <clues type="rows"> and <clues type="columns"> elements made
+    // of one <line> of <count> elements per row or column. Only the first puzzle of a set is read.
+    // The file is parsed in a single forward pass, without building a DOM.
+    class WebpbnGridReader
+    {
+        public:     // Public methods
+            WebpbnGridReader();
+
+            // Memory-maps the file and parses it in a single pass.
+            Grid loadGridFromFile(std::string path);
+            // Parse a puzzle from an in-memory document. Throws InvalidNonogramFileError on unsupported
+            // or incomplete puzzles and tinyxml2::TinyXML2Error on malformed XML.
+            Grid loadGridFromBuffer(const char* data, std::size_t size);
+
+            // Whether an XML document looks like a webpbn puzzle, judging from its root element.
+            static bool isWebpbnDocument(const char* data, std::size_t size);
+    };
+}
+
+#endif//IO__WEBPBN_GRID_READER_HPP
\ No newline at end of file
@@ -1,11 +1,16 @@
 #include "xml_grid_serializer.hpp"
 
+#include <cstdio>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <vector>
+#include <utility>
 
 #include "exceptions/tinyxml2_error.hpp"
 #include "exceptions/invalid_xml_grid_error.hpp"
+#include "exceptions/xml_grid_write_error.hpp"
+#include "row_rle.hpp"
 #include "../lib/tinyxml2/tinyxml2.hpp"
 #include "../core/grid.hpp"
 #include "../core/utility.hpp"
@@ -20,36 +25,34 @@ namespace Picross
 
     void XMLGridSerialzer::saveGridToFile(const Grid& grid, std::string path)
     {
-        // Construct an XML grid from the given grid.
-        tinyxml2::XMLDocument xmlDoc;
+        // Elements are written to the file as they are printed, through a large stdio buffer. The file is
+        // declared after the buffer, so that it is closed before the buffer goes away, even if printing throws.
+        std::vector<char> buffer = std::vector<char>(WRITE_BUFFER_SIZE);
 
-        // Create the main element, with both width and height.
-        tinyxml2::XMLElement* gridElt = xmlDoc.NewElement("grid");
-        gridElt->SetAttribute("width", grid.getWidth());
-        gridElt->SetAttribute("height", grid.getHeight());
-        xmlDoc.InsertFirstChild(gridElt);
-
-        // Create the hints element.
-        tinyxml2::XMLElement* hintsElt = xmlDoc.NewElement("hints");
-        gridElt->InsertEndChild(hintsElt);
-
-        // Make an XML element out of the horizontal hints and attach it to the hints element.
-        tinyxml2::XMLElement* hHintsElt = xmlDoc.NewElement("horizontal");
-        hintsElt->InsertEndChild(hHintsElt);
-        addXMLHints(xmlDoc, hHintsElt, grid.getAllRowHints());
+        // Atempt to open the specified file and throw if it fails.
+        std::unique_ptr<std::FILE, decltype(&std::fclose)> file = std::unique_ptr<std::FILE, decltype(&std::fclose)>(std::fopen(path.c_str(), "w"), &std::fclose);
+        if (!file)
+        {
+            throw tinyxml2::TinyXML2Error(tinyxml2::XML_ERROR_FILE_COULD_NOT_BE_OPENED);
+        }
+        std::setvbuf(file.get(), buffer.data(), _IOFBF, buffer.size());
 
-        // Same for vertical hints.
-        tinyxml2::XMLElement* vHintsElt = xmlDoc.NewElement("vertical");
-        hintsElt->InsertEndChild(vHintsElt);
-        addXMLHints(xmlDoc, vHintsElt, grid.getAllColHints());
+        tinyxml2::XMLPrinter printer(file.get());
+        printXMLGrid(printer, grid);
 
-        // Make an XML element out of the grid content and attach it to the whole grid.
-        tinyxml2::XMLElement* contentElt = xmlDoc.NewElement("content");
-        gridElt->InsertEndChild(contentElt);
-        addXMLGridContent(xmlDoc, contentElt, grid);
+        bool failed = std::ferror(file.get()) != 0;
+        failed = (std::fclose(file.release()) != 0) || failed;
+        if (failed)
+        {
+            throw XMLGridWriteError("Could not write grid to " + path + ".");
+        }
+    }
 
-        // Save it all.
-        saveXMLFile(xmlDoc, path);
+    std::string XMLGridSerialzer::saveGridToString(const Grid& grid)
+    {
+        tinyxml2::XMLPrinter printer;
+        printXMLGrid(printer, grid);
+        return std::string(printer.CStr(), printer.CStrSize() - 1);
     }
 
     Grid XMLGridSerialzer::loadGridFromFile(std::string path)
@@ -80,7 +83,7 @@ namespace Picross
         if (vHints.size() != width) throw InvalidXMLGridError("Not enough vertical hint entries for specified grid width.");
 
         // Construct the grid with all parsed elements.
-        Grid grid(width, height, hHints, vHints);
+        Grid grid(width, height, std::move(hHints), std::move(vHints));
 
         // Parse contents and fill the grid with it.
         tinyxml2::XMLElement* contentElt = findFirstChildOrThrow(gridElt, "content");
@@ -138,29 +141,52 @@ namespace Picross
         // Set the whole grid to that default state.
         grid.setCellRange(0, height - 1, 0, width - 1, defaultState);
 
-        // Retrieve all cell values from XML.
-        tinyxml2::XMLElement* cellElt = contentElt->FirstChildElement("cell");
-        while (cellElt)
+        // Retrieve all cell values from XML, given either as single cells or as run-length encoded rows.
+        std::vector<cell_t> rowCells = std::vector<cell_t>(width);
+        tinyxml2::XMLElement* elt = contentElt->FirstChildElement();
+        while (elt)
         {
-            // Get cell coordinates.
-            int row = getValueFromAttribute<int>(cellElt, "row");
-            int col = getValueFromAttribute<int>(cellElt, "col");
+            std::string name = elt->Name();
+            if (name == "cell")
+            {
+                // Get cell coordinates.
+                int row = getValueFromAttribute<int>(elt, "row");
+                int col = getValueFromAttribute<int>(elt, "col");
 
-            // Get cell state.
-            std::string stateStr = getValueFromAttribute<std::string>(cellElt, "state");
-            cell_t state = stringToCellState(stateStr);
+                // Get cell state.
+                std::string stateStr = getValueFromAttribute<std::string>(elt, "state");
+                cell_t state = stringToCellState(stateStr);
 
-            // Set the corresponding cell in the grid.
-            try
-            {
-                grid.setCell(row, col, state);
+                // Set the corresponding cell in the grid.
+                try
+                {
+                    grid.setCell(row, col, state);
+                }
+                catch(const IndexOutOfBoundsError& e)
+                {
+                    throw InvalidXMLGridError("Specified cell coordinates exceed grid boundaries in provided file.");
+                }
             }
-            catch(const IndexOutOfBoundsError& e)
+            else if (name == "row")
             {
-                throw InvalidXMLGridError("Specified cell coordinates exceed grid boundaries in provided file.");
+                // Get row index.
+                int row = getValueFromAttribute<int>(elt, "index");
+                if (!grid.isValidRow(row))
+                {
+                    throw InvalidXMLGridError("Specified row index exceeds grid boundaries in provided file.");
+                }
+
+                // Decode the whole row and set it in the grid.
+                const char* text = elt->GetText();
+                std::string rle = text ? text : "";
+                if (!decodeRowRLE(rle, rowCells.data(), width))
+                {
+                    throw InvalidXMLGridError("Invalid row encoding \"" + rle + "\" for grid width " + std::to_string(width) + " in provided file.");
+                }
+                grid.setRow(row, rowCells);
             }
 
-            cellElt = cellElt->NextSiblingElement("cell");
+            elt = elt->NextSiblingElement();
         }
     }
 
@@ -172,63 +198,116 @@ namespace Picross
         throw InvalidXMLGridError("String \"" + value + "\" cannot be bound to a cell_t value.");
     }
 
-    void XMLGridSerialzer::saveXMLFile(tinyxml2::XMLDocument& doc, std::string path)
+    void XMLGridSerialzer::printXMLGrid(tinyxml2::XMLPrinter& printer, const Grid& grid)
     {
-        // Atempt to save to the specified file and throw if any error is returned.
-        tinyxml2::XMLError err = doc.SaveFile(path.c_str());
-        if (err)
-        {
-            throw tinyxml2::TinyXML2Error(err);
-        }
+        // Open the main element, with both width and height.
+        printer.OpenElement("grid");
+        printer.PushAttribute("width", grid.getWidth());
+        printer.PushAttribute("height", grid.getHeight());
+
+        // Hints element, holding horizontal then vertical hints.
+        printer.OpenElement("hints");
+        printer.OpenElement("horizontal");
+        printXMLHints(printer, grid.getAllRowHints());
+        printer.CloseElement();
+        printer.OpenElement("vertical");
+        printXMLHints(printer, grid.getAllColHints());
+        printer.CloseElement();
+        printer.CloseElement();
+
+        // Grid content.
+        printer.OpenElement("content");
+        printXMLGridContent(printer, grid);
+        printer.CloseElement();
+
+        printer.CloseElement();
     }
 
-    void XMLGridSerialzer::addXMLHints(tinyxml2::XMLDocument& sourceDoc, tinyxml2::XMLElement* root, const std::vector<std::vector<int>>& hints)
+    void XMLGridSerialzer::printXMLHints(tinyxml2::XMLPrinter& printer, const std::vector<std::vector<int>>& hints)
     {
         // For every hint sequence...
         for (auto it = hints.begin(); it != hints.end(); it++)
         {
             // Generate an "entry" element.
-            tinyxml2::XMLElement* entryElt = sourceDoc.NewElement("entry");
-            root->InsertEndChild(entryElt);
+            printer.OpenElement("entry");
 
             // For every hint in the sequence...
             for (auto jt = it->begin(); jt != it->end(); jt++)
             {
                 // Generate a hint value.
-                tinyxml2::XMLElement* valueElt = sourceDoc.NewElement("hintValue");
-                valueElt->SetText(*jt);
-                entryElt->InsertEndChild(valueElt);
+                printer.OpenElement("hintValue");
+                printer.PushText(*jt);
+                printer.CloseElement();
             }
+
+            printer.CloseElement();
         }
     }
 
-    void XMLGridSerialzer::addXMLGridContent(tinyxml2::XMLDocument& sourceDoc, tinyxml2::XMLElement* root, const Grid& grid)
+    void XMLGridSerialzer::printXMLGridContent(tinyxml2::XMLPrinter& printer, const Grid& grid)
     {
         // Compute and set the default cell value for the grid.
         cell_t defaultState = grid.mostPresentState();
-        root->SetAttribute("default", cellStateToString(defaultState).c_str());
+        printer.PushAttribute("default", cellStateToString(defaultState).c_str());
 
         int width = grid.getWidth();
         int height = grid.getHeight();
-        // Iterate over all cells.
+        // Each row is written either as single cells or as one encoded row, whichever is shorter.
         for (int row = 0; row < height; row++)
         {
+            std::vector<cell_t> cells = grid.getRow(row);
+            std::string rowIndex = std::to_string(row);
+
+            std::size_t cellsLength = 0;
             for (int col = 0; col < width; col++)
             {
-                cell_t state = grid.getCell(row, col);
+                if (cells[col] != defaultState)
+                {
+                    cellsLength += cellElementLength(rowIndex.size(), std::to_string(col).size(), cellStateToString(cells[col]).size());
+                }
+            }
+
+            // Nothing to write for rows which only hold the default state.
+            if (cellsLength == 0) continue;
+
+            std::string rle = encodeRowRLE(cells.data(), width);
+            if (rowElementLength(rowIndex.size(), rle.size()) < cellsLength)
+            {
+                printer.OpenElement("row");
+                printer.PushAttribute("index", row);
+                printer.PushText(rle.c_str());
+                printer.CloseElement();
+                continue;
+            }
+
+            for (int col = 0; col < width; col++)
+            {
+                cell_t state = cells[col];
                 if (state != defaultState)
                 {
                     // Generate a "cell" element for every cell whose state is different from the computed default.
-                    tinyxml2::XMLElement* cellElt = sourceDoc.NewElement("cell");
-                    cellElt->SetAttribute("row", row);
-                    cellElt->SetAttribute("col", col);
-                    cellElt->SetAttribute("state", cellStateToString(state).c_str());
-                    root->InsertEndChild(cellElt);
+                    printer.OpenElement("cell");
+                    printer.PushAttribute("row", row);
+                    printer.PushAttribute("col", col);
+                    printer.PushAttribute("state", cellStateToString(state).c_str());
+                    printer.CloseElement();
                 }
             }
         }
     }
 
+    std::size_t XMLGridSerialzer::cellElementLength(std::size_t rowLength, std::size_t colLength, std::size_t stateLength)
+    {
+        // <cell row="" col="" state=""/>, plus indentation and line break.
+        return 30 + rowLength + colLength + stateLength + CONTENT_ELEMENT_INDENT + 1;
+    }
+
+    std::size_t XMLGridSerialzer::rowElementLength(std::size_t indexLength, std::size_t rleLength)
+    {
+        // <row index=""></row>, plus indentation and line break.
+        return 20 + indexLength + rleLength + CONTENT_ELEMENT_INDENT + 1;
+    }
+
     std::string XMLGridSerialzer::cellStateToString(cell_t value)
     {
         if (value == CELL_CHECKED) return "checked";
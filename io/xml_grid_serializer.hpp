@@ -1,6 +1,7 @@
 #ifndef IO__XML_GRID_SERIALIZER_HPP
 #define IO__XML_GRID_SERIALIZER_HPP
 
+#include <cstddef>
 #include <string>
 #include <stdexcept>
 #include <vector>
@@ -15,9 +16,16 @@ namespace Picross
     class XMLGridSerialzer
     {
         public:     // Public methods
+            // Size of the stdio buffer used when saving.
+            inline static const std::size_t WRITE_BUFFER_SIZE = 1 << 16;
+            // Indentation of the elements inside the "content" element.
+            inline static const std::size_t CONTENT_ELEMENT_INDENT = 8;
+
             XMLGridSerialzer();
 
             void saveGridToFile(const Grid& grid, std::string path);
+            // Same output as saveGridToFile, returned in memory.
+            std::string saveGridToString(const Grid& grid);
             Grid loadGridFromFile(std::string path);
 
         private:    // Private methods
@@ -33,13 +41,16 @@ namespace Picross
             // Get a cell state from a string.
             cell_t stringToCellState(std::string value);
 
-        // Writing utilities
-            // Save the provided grid to an XML file of given name.
-            void saveXMLFile(tinyxml2::XMLDocument& doc, std::string path);
-            // Add hints from a vector of vectors into an XML element.
-            void addXMLHints(tinyxml2::XMLDocument& sourceDoc, tinyxml2::XMLElement* root, const std::vector<std::vector<int>>& hints);
-            // Add grid content from a grid into an XML element.
-            void addXMLGridContent(tinyxml2::XMLDocument& sourceDoc, tinyxml2::XMLElement* root, const Grid& grid);
+        // Writing utilities (elements are streamed to the printer, no document is built)
+            // Print the whole grid element.
+            void printXMLGrid(tinyxml2::XMLPrinter& printer, const Grid& grid);
+            // Print hints from a vector of vectors as a sequence of entry elements.
+            void printXMLHints(tinyxml2::XMLPrinter& printer, const std::vector<std::vector<int>>& hints);
+            // Print the cells of a grid which differ from the default state.
+            void printXMLGridContent(tinyxml2::XMLPrinter& printer, const Grid& grid);
+            // Printed length of a "cell" element and of a "row" element, given the length of their values.
+            std::size_t cellElementLength(std::size_t rowLength, std::size_t colLength, std::size_t stateLength);
+            std::size_t rowElementLength(std::size_t indexLength, std::size_t rleLength);
             // Convert a cell state into a string
             std::string cellStateToString(cell_t value);
 
@@ -0,0 +1,409 @@
+#include "xml_grid_stream_reader.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "exceptions/tinyxml2_error.hpp"
+#include "exceptions/invalid_xml_grid_error.hpp"
+#include "xml_tokenizer.hpp"
+#include "row_rle.hpp"
+#include "../lib/tinyxml2/tinyxml2.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+#include "../tools/mapped_file.hpp"
+#include "../tools/exceptions/file_not_found_error.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        // Role of an open element, decided from its name and the role of its parent.
+        const int SECTION_IGNORED = 0;
+        const int SECTION_DOCUMENT = 1;
+        const int SECTION_GRID = 2;
+        const int SECTION_HINTS = 3;
+        const int SECTION_HORIZONTAL = 4;
+        const int SECTION_VERTICAL = 5;
+        const int SECTION_ENTRY = 6;
+        const int SECTION_HINT_VALUE = 7;
+        const int SECTION_CONTENT = 8;
+        const int SECTION_CELL = 9;
+        const int SECTION_ROW = 10;
+
+        // Content read before the grid could be built: either a single cell or a whole row.
+        struct PendingContent
+        {
+            int row;
+            int col;                    // -1 for a whole row.
+            cell_t state;
+            std::vector<cell_t> cells;  // Decoded row, for whole rows only.
+        };
+
+        // Run an action and keep the first exception it throws, so that errors can be raised in the
+        // same order as a DOM-based loader would, which validates sections one after the other.
+        template<typename Action>
+        void captureError(std::exception_ptr& slot, Action action)
+        {
+            if (slot) return;
+
+            try
+            {
+                action();
+            }
+            catch(...)
+            {
+                slot = std::current_exception();
+            }
+        }
+
+        InvalidXMLGridError missingElementError(const std::string& name)
+        {
+            return InvalidXMLGridError("Missing element \"" + name + "\" in provided file.");
+        }
+    }
+
+    XMLGridStreamReader::XMLGridStreamReader()
+    {
+
+    }
+
+    Grid XMLGridStreamReader::loadGridFromFile(std::string path)
+    {
+        // Report a missing file the same way tinyxml2 would.
+        auto openFile = [&path]()
+        {
+            try
+            {
+                return MappedFile(path);
+            }
+            catch(const FileNotFoundError& e)
+            {
+                throw tinyxml2::TinyXML2Error(tinyxml2::XML_ERROR_FILE_NOT_FOUND);
+            }
+        };
+
+        MappedFile file = openFile();
+        return loadGridFromBuffer(reinterpret_cast<const char*>(file.data()), file.size());
+    }
+
+    Grid XMLGridStreamReader::loadGridFromBuffer(const char* data, std::size_t size)
+    {
+        XMLTokenizer tokens = XMLTokenizer(data, size);
+        std::vector<int> sections = { SECTION_DOCUMENT };
+
+        bool gridFound = false;
+        bool hintsFound = false;
+        bool hintsClosed = false;
+        bool horizontalFound = false;
+        bool verticalFound = false;
+        bool contentFound = false;
+        int width = 0;
+        int height = 0;
+
+        // Hints are read straight into the vectors handed to the grid.
+        std::vector<std::vector<int>> hHints;
+        std::vector<std::vector<int>> vHints;
+        std::vector<std::vector<int>>* currentHints = nullptr;
+        bool hintValueHasText = false;
+        std::exception_ptr hHintsError;
+        std::exception_ptr vHintsError;
+
+        // Cells are written into the grid once it is built, or kept aside if the content comes
+        // before the hints in the file.
+        std::optional<Grid> grid;
+        std::vector<cell_t> rowBuffer;
+        std::vector<PendingContent> pendingContent;
+        bool contentBeforeHints = false;
+        cell_t defaultState = CELL_CLEARED;
+        std::exception_ptr contentError;
+        int rowIndex = 0;
+        bool rowHasText = false;
+
+        // Decode a run-length encoded row into the grid, or keep it aside.
+        auto decodeRow = [&](std::string_view text)
+        {
+            captureError(contentError, [&]()
+            {
+                // Rows go through a single reused buffer once the grid is built.
+                std::vector<cell_t> pendingRow;
+                std::vector<cell_t>& target = grid ? rowBuffer : pendingRow;
+                target.resize(std::max(width, 0));
+
+                if (!decodeRowRLE(text, target.data(), width))
+                {
+                    throw InvalidXMLGridError("Invalid row encoding \"" + std::string(text) + "\" for grid width " + std::to_string(width) + " in provided file.");
+                }
+
+                if (grid)
+                {
+                    grid->setRow(rowIndex, rowBuffer);
+                }
+                else
+                {
+                    pendingContent.push_back({rowIndex, -1, CELL_CLEARED, std::move(pendingRow)});
+                }
+            });
+        };
+
+        // Check hints in the order of the DOM-based loader and construct the grid.
+        auto buildGrid = [&]()
+        {
+            if (!hintsFound) throw missingElementError("hints");
+            if (!horizontalFound) throw missingElementError("horizontal");
+            if (!verticalFound) throw missingElementError("vertical");
+
+            if (hHintsError) std::rethrow_exception(hHintsError);
+            if (hHints.empty()) throw missingElementError("entry");
+            if ((int) hHints.size() != height) throw InvalidXMLGridError("Not enough horizontal hint entries for specified grid height.");
+
+            if (vHintsError) std::rethrow_exception(vHintsError);
+            if (vHints.empty()) throw missingElementError("entry");
+            if ((int) vHints.size() != width) throw InvalidXMLGridError("Not enough vertical hint entries for specified grid width.");
+
+            grid.emplace(width, height, std::move(hHints), std::move(vHints));
+        };
+
+        int token;
+        while ((token = tokens.next()) != XMLTokenizer::TOKEN_END_OF_INPUT)
+        {
+            if (token == XMLTokenizer::TOKEN_START_ELEMENT)
+            {
+                int parent = sections.back();
+                std::string_view name = tokens.name();
+                int section = SECTION_IGNORED;
+
+                if (parent == SECTION_DOCUMENT && name == "grid" && !gridFound)
+                {
+                    section = SECTION_GRID;
+                    gridFound = true;
+                    width = getIntAttribute(tokens, "width");
+                    height = getIntAttribute(tokens, "height");
+                }
+                else if (parent == SECTION_GRID && name == "hints" && !hintsFound)
+                {
+                    section = SECTION_HINTS;
+                    hintsFound = true;
+                }
+                else if (parent == SECTION_HINTS && name == "horizontal" && !horizontalFound)
+                {
+                    section = SECTION_HORIZONTAL;
+                    horizontalFound = true;
+                }
+                else if (parent == SECTION_HINTS && name == "vertical" && !verticalFound)
+                {
+                    section = SECTION_VERTICAL;
+                    verticalFound = true;
+                }
+                else if ((parent == SECTION_HORIZONTAL || parent == SECTION_VERTICAL) && name == "entry")
+                {
+                    section = SECTION_ENTRY;
+                    currentHints = (parent == SECTION_HORIZONTAL) ? &hHints : &vHints;
+                    currentHints->emplace_back();
+                }
+                else if (parent == SECTION_ENTRY && name == "hintValue")
+                {
+                    section = SECTION_HINT_VALUE;
+                    hintValueHasText = false;
+                }
+                else if (parent == SECTION_GRID && name == "content" && !contentFound)
+                {
+                    section = SECTION_CONTENT;
+                    contentFound = true;
+
+                    // Usual layout: hints are complete, so the grid can be built right away.
+                    if (hintsClosed)
+                    {
+                        buildGrid();
+                    }
+                    contentBeforeHints = !grid;
+
+                    captureError(contentError, [&]()
+                    {
+                        defaultState = stringToCellState(getStringAttribute(tokens, "default"));
+                    });
+
+                    // New grids are all cleared already.
+                    if (grid && !contentError && defaultState != CELL_CLEARED && width > 0 && height > 0)
+                    {
+                        grid->setCellRange(0, height - 1, 0, width - 1, defaultState);
+                    }
+                }
+                else if (parent == SECTION_CONTENT && name == "cell")
+                {
+                    section = SECTION_CELL;
+                    captureError(contentError, [&]()
+                    {
+                        int row = getIntAttribute(tokens, "row");
+                        int col = getIntAttribute(tokens, "col");
+                        cell_t state = stringToCellState(getStringAttribute(tokens, "state"));
+
+                        if (row < 0 || row >= height || col < 0 || col >= width)
+                        {
+                            throw InvalidXMLGridError("Specified cell coordinates exceed grid boundaries in provided file.");
+                        }
+
+                        if (grid)
+                        {
+                            grid->setCell(row, col, state);
+                        }
+                        else
+                        {
+                            pendingContent.push_back({row, col, state, {}});
+                        }
+                    });
+                }
+                else if (parent == SECTION_CONTENT && name == "row")
+                {
+                    section = SECTION_ROW;
+                    rowHasText = false;
+                    captureError(contentError, [&]()
+                    {
+                        rowIndex = getIntAttribute(tokens, "index");
+                        if (rowIndex < 0 || rowIndex >= height)
+                        {
+                            throw InvalidXMLGridError("Specified row index exceeds grid boundaries in provided file.");
+                        }
+                    });
+                }
+
+                sections.push_back(section);
+            }
+            else if (token == XMLTokenizer::TOKEN_TEXT)
+            {
+                if (sections.back() == SECTION_HINT_VALUE && !hintValueHasText)
+                {
+                    hintValueHasText = true;
+                    captureError(currentHints == &hHints ? hHintsError : vHintsError, [&]()
+                    {
+                        currentHints->back().push_back(parseIntText(tokens.text()));
+                    });
+                }
+                else if (sections.back() == SECTION_ROW && !rowHasText)
+                {
+                    rowHasText = true;
+                    decodeRow(tokens.text());
+                }
+            }
+            else if (token == XMLTokenizer::TOKEN_END_ELEMENT)
+            {
+                int section = sections.back();
+                if (section == SECTION_HINT_VALUE && !hintValueHasText)
+                {
+                    captureError(currentHints == &hHints ? hHintsError : vHintsError, []()
+                    {
+                        throw tinyxml2::TinyXML2Error(tinyxml2::XML_NO_TEXT_NODE);
+                    });
+                }
+                else if (section == SECTION_ROW && !rowHasText)
+                {
+                    decodeRow("");
+                }
+                else if (section == SECTION_HINTS)
+                {
+                    hintsClosed = true;
+                }
+
+                sections.pop_back();
+            }
+        }
+
+        if (!gridFound) throw InvalidXMLGridError("Missing root node \"grid\" in provided file.");
+
+        if (!grid)
+        {
+            buildGrid();
+        }
+
+        if (!contentFound) throw missingElementError("content");
+        if (contentError) std::rethrow_exception(contentError);
+
+        if (contentBeforeHints)
+        {
+            // The grid was only built now, replay the content kept aside.
+            if (width > 0 && height > 0)
+            {
+                grid->setCellRange(0, height - 1, 0, width - 1, defaultState);
+            }
+            for (const PendingContent& pending : pendingContent)
+            {
+                if (pending.col == -1)
+                {
+                    grid->setRow(pending.row, pending.cells);
+                }
+                else
+                {
+                    grid->setCell(pending.row, pending.col, pending.state);
+                }
+            }
+        }
+
+        return std::move(*grid);
+    }
+
+    int XMLGridStreamReader::getIntAttribute(const XMLTokenizer& tokens, std::string_view name)
+    {
+        const XMLTokenizer::Attribute* attr = tokens.findAttribute(name);
+        if (!attr)
+        {
+            throw tinyxml2::TinyXML2Error(tinyxml2::XML_NO_ATTRIBUTE);
+        }
+
+        try
+        {
+            return parseIntText(attr->value);
+        }
+        catch(const tinyxml2::TinyXML2Error& e)
+        {
+            throw tinyxml2::TinyXML2Error(tinyxml2::XML_WRONG_ATTRIBUTE_TYPE);
+        }
+    }
+
+    std::string XMLGridStreamReader::getStringAttribute(const XMLTokenizer& tokens, std::string_view name)
+    {
+        const XMLTokenizer::Attribute* attr = tokens.findAttribute(name);
+        if (!attr)
+        {
+            throw InvalidXMLGridError("Missing attribute " + std::string(name) + " in element " + std::string(tokens.name()) + " in provided file.");
+        }
+
+        return XMLTokenizer::decodeEntities(attr->value);
+    }
+
+    int XMLGridStreamReader::parseIntText(std::string_view text)
+    {
+        // Same leniency as tinyxml2: leading whitespace and sign allowed, trailing characters ignored.
+        std::size_t start = 0;
+        while (start < text.size() && (text[start] == ' ' || text[start] == '\t' || text[start] == '\n' || text[start] == '\r'))
+        {
+            start++;
+        }
+        if (start < text.size() && text[start] == '+')
+        {
+            start++;
+        }
+
+        int value;
+        std::from_chars_result res = std::from_chars(text.data() + start, text.data() + text.size(), value);
+        if (res.ec != std::errc())
+        {
+            throw tinyxml2::TinyXML2Error(tinyxml2::XML_CAN_NOT_CONVERT_TEXT);
+        }
+
+        return value;
+    }
+
+    cell_t XMLGridStreamReader::stringToCellState(const std::string& value)
+    {
+        if (value == "checked") return CELL_CHECKED;
+        if (value == "cleared") return CELL_CLEARED;
+        if (value == "crossed") return CELL_CROSSED;
+        throw InvalidXMLGridError("String \"" + value + "\" cannot be bound to a cell_t value.");
+    }
+}
\ No newline at end of file
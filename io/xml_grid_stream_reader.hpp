@@ -0,0 +1,40 @@
+#ifndef IO__XML_GRID_STREAM_READER_HPP
+#define IO__XML_GRID_STREAM_READER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "exceptions/tinyxml2_error.hpp"
+#include "exceptions/invalid_xml_grid_error.hpp"
+#include "xml_tokenizer.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Loads grids saved by XMLGridSerialzer in a single forward pass over the file, without building
+    // a DOM: hints are collected into their final vectors and cells are written straight into the
+    // grid once it is built. Only content found before the hints in the file is kept aside until then.
+    // Accepts the same schema and raises the same errors as XMLGridSerialzer.
+    class XMLGridStreamReader
+    {
+        public:     // Public methods
+            XMLGridStreamReader();
+
+            Grid loadGridFromFile(std::string path);
+            // Load a grid from an in-memory XML document.
+            Grid loadGridFromBuffer(const char* data, std::size_t size);
+
+        private:    // Private methods
+            // Get the value of an integer attribute of the current element, auto-throw if missing or malformed.
+            int getIntAttribute(const XMLTokenizer& tokens, std::string_view name);
+            // Get the value of a string attribute of the current element, auto-throw if missing.
+            std::string getStringAttribute(const XMLTokenizer& tokens, std::string_view name);
+            // Parse the integer value of a text token, auto-throw if malformed.
+            int parseIntText(std::string_view text);
+            // Get a cell state from a string.
+            cell_t stringToCellState(const std::string& value);
+    };
+}
+
+#endif//IO__XML_GRID_STREAM_READER_HPP
\ No newline at end of file
@@ -0,0 +1,351 @@
+#include "xml_tokenizer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "exceptions/tinyxml2_error.hpp"
+#include "../lib/tinyxml2/tinyxml2.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        bool isXMLWhitespace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        bool isNameChar(char c)
+        {
+            unsigned char u = (unsigned char) c;
+            return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9')
+                || u == '_' || u == ':' || u == '-' || u == '.' || u >= 0x80;
+        }
+
+        bool startsWith(const char* cursor, const char* end, std::string_view prefix)
+        {
+            return (std::size_t) (end - cursor) >= prefix.size() && std::string_view(cursor, prefix.size()) == prefix;
+        }
+
+        void appendUTF8(std::string& out, std::uint32_t codepoint)
+        {
+            if (codepoint < 0x80)
+            {
+                out.push_back((char) codepoint);
+            }
+            else if (codepoint < 0x800)
+            {
+                out.push_back((char) (0xC0 | (codepoint >> 6)));
+                out.push_back((char) (0x80 | (codepoint & 0x3F)));
+            }
+            else if (codepoint < 0x10000)
+            {
+                out.push_back((char) (0xE0 | (codepoint >> 12)));
+                out.push_back((char) (0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back((char) (0x80 | (codepoint & 0x3F)));
+            }
+            else
+            {
+                out.push_back((char) (0xF0 | (codepoint >> 18)));
+                out.push_back((char) (0x80 | ((codepoint >> 12) & 0x3F)));
+                out.push_back((char) (0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back((char) (0x80 | (codepoint & 0x3F)));
+            }
+        }
+    }
+
+    XMLTokenizer::XMLTokenizer(const char* data, std::size_t size) :
+        _cursor(data),
+        _end(data + size),
+        _line(1),
+        _openElements(),
+        _attributes(),
+        _name(),
+        _text(),
+        _depth(0),
+        _pendingSelfClose(false),
+        _rootSeen(false)
+    {
+        // Skip a UTF-8 byte order mark.
+        if (startsWith(_cursor, _end, "\xEF\xBB\xBF"))
+        {
+            _cursor += 3;
+        }
+    }
+
+    int XMLTokenizer::next()
+    {
+        // A self-closing element yields its end token right after its start token.
+        if (_pendingSelfClose)
+        {
+            _pendingSelfClose = false;
+            _depth = (int) _openElements.size();
+            _openElements.pop_back();
+            return TOKEN_END_ELEMENT;
+        }
+
+        while (true)
+        {
+            if (_cursor == _end)
+            {
+                if (!_openElements.empty()) fail(tinyxml2::XML_ERROR_PARSING, "unclosed element <" + std::string(_openElements.back()) + ">");
+                if (!_rootSeen) fail(tinyxml2::XML_ERROR_EMPTY_DOCUMENT, "no element found");
+                _depth = 0;
+                return TOKEN_END_OF_INPUT;
+            }
+
+            if (*_cursor != '<')
+            {
+                // Text up to the next markup.
+                const char* start = _cursor;
+                bool blank = true;
+                while (_cursor != _end && *_cursor != '<')
+                {
+                    if (*_cursor == '\n') _line++;
+                    if (!isXMLWhitespace(*_cursor)) blank = false;
+                    _cursor++;
+                }
+
+                if (blank) continue;
+                if (_openElements.empty()) fail(tinyxml2::XML_ERROR_PARSING_TEXT, "text outside of any element");
+
+                _text = std::string_view(start, _cursor - start);
+                _depth = (int) _openElements.size();
+                return TOKEN_TEXT;
+            }
+
+            if (startsWith(_cursor, _end, "<?"))
+            {
+                skipUntil("?>");
+            }
+            else if (startsWith(_cursor, _end, "<!--"))
+            {
+                skipUntil("-->");
+            }
+            else if (startsWith(_cursor, _end, "<![CDATA["))
+            {
+                _cursor += 9;
+                const char* start = _cursor;
+                skipUntil("]]>");
+                if (_openElements.empty()) fail(tinyxml2::XML_ERROR_PARSING_CDATA, "CDATA outside of any element");
+
+                _text = std::string_view(start, (_cursor - 3) - start);
+                _depth = (int) _openElements.size();
+                return TOKEN_TEXT;
+            }
+            else if (startsWith(_cursor, _end, "<!"))
+            {
+                // DOCTYPE and other declarations, internal subsets are not supported.
+                skipUntil(">");
+            }
+            else if (startsWith(_cursor, _end, "</"))
+            {
+                return readEndElement();
+            }
+            else
+            {
+                return readStartElement();
+            }
+        }
+    }
+
+    std::string_view XMLTokenizer::name() const
+    {
+        return _name;
+    }
+
+    std::string_view XMLTokenizer::text() const
+    {
+        return _text;
+    }
+
+    const std::vector<XMLTokenizer::Attribute>& XMLTokenizer::attributes() const
+    {
+        return _attributes;
+    }
+
+    const XMLTokenizer::Attribute* XMLTokenizer::findAttribute(std::string_view name) const
+    {
+        for (const Attribute& attr : _attributes)
+        {
+            if (attr.name == name) return &attr;
+        }
+
+        return nullptr;
+    }
+
+    int XMLTokenizer::depth() const
+    {
+        return _depth;
+    }
+
+    int XMLTokenizer::line() const
+    {
+        return _line;
+    }
+
+    std::string XMLTokenizer::decodeEntities(std::string_view raw)
+    {
+        std::string out;
+        out.reserve(raw.size());
+
+        std::size_t i = 0;
+        while (i < raw.size())
+        {
+            std::size_t semicolon;
+            if (raw[i] != '&' || (semicolon = raw.find(';', i)) == std::string_view::npos)
+            {
+                out.push_back(raw[i++]);
+                continue;
+            }
+
+            std::string_view entity = raw.substr(i + 1, semicolon - i - 1);
+            if (entity == "lt") out.push_back('<');
+            else if (entity == "gt") out.push_back('>');
+            else if (entity == "amp") out.push_back('&');
+            else if (entity == "quot") out.push_back('"');
+            else if (entity == "apos") out.push_back('\'');
+            else if (entity.size() > 1 && entity[0] == '#')
+            {
+                // Numeric character reference, decimal or hexadecimal.
+                bool hex = (entity[1] == 'x' || entity[1] == 'X');
+                std::uint32_t codepoint = 0;
+                for (std::size_t k = hex ? 2 : 1; k < entity.size(); k++)
+                {
+                    char c = entity[k];
+                    int digit = (c >= '0' && c <= '9') ? c - '0'
+                              : (hex && c >= 'a' && c <= 'f') ? c - 'a' + 10
+                              : (hex && c >= 'A' && c <= 'F') ? c - 'A' + 10
+                              : -1;
+                    if (digit < 0 || codepoint > 0x10FFFF) break;
+                    codepoint = codepoint * (hex ? 16 : 10) + digit;
+                }
+                appendUTF8(out, codepoint);
+            }
+            else
+            {
+                // Unknown entity: keep it as is.
+                out.append(raw.substr(i, semicolon - i + 1));
+            }
+            i = semicolon + 1;
+        }
+
+        return out;
+    }
+
+    int XMLTokenizer::readStartElement()
+    {
+        // Skip '<'.
+        _cursor++;
+        _name = readName();
+        if (_name.empty()) fail(tinyxml2::XML_ERROR_PARSING_ELEMENT, "invalid element name");
+
+        _attributes.clear();
+        while (true)
+        {
+            skipWhitespace();
+            if (_cursor == _end) fail(tinyxml2::XML_ERROR_PARSING_ELEMENT, "unterminated element <" + std::string(_name) + ">");
+
+            if (*_cursor == '>')
+            {
+                _cursor++;
+                break;
+            }
+            if (*_cursor == '/')
+            {
+                if (!startsWith(_cursor, _end, "/>")) fail(tinyxml2::XML_ERROR_PARSING_ELEMENT, "unexpected '/' in element <" + std::string(_name) + ">");
+                _cursor += 2;
+                _pendingSelfClose = true;
+                break;
+            }
+
+            // name="value" or name='value'
+            Attribute attr;
+            attr.name = readName();
+            if (attr.name.empty()) fail(tinyxml2::XML_ERROR_PARSING_ATTRIBUTE, "invalid attribute in element <" + std::string(_name) + ">");
+
+            skipWhitespace();
+            if (_cursor == _end || *_cursor != '=') fail(tinyxml2::XML_ERROR_PARSING_ATTRIBUTE, "missing '=' after attribute " + std::string(attr.name));
+            _cursor++;
+            skipWhitespace();
+
+            if (_cursor == _end || (*_cursor != '"' && *_cursor != '\'')) fail(tinyxml2::XML_ERROR_PARSING_ATTRIBUTE, "unquoted value for attribute " + std::string(attr.name));
+            char quote = *_cursor++;
+            const char* start = _cursor;
+            while (_cursor != _end && *_cursor != quote)
+            {
+                if (*_cursor == '\n') _line++;
+                _cursor++;
+            }
+            if (_cursor == _end) fail(tinyxml2::XML_ERROR_PARSING_ATTRIBUTE, "unterminated value for attribute " + std::string(attr.name));
+
+            attr.value = std::string_view(start, _cursor - start);
+            _cursor++;
+            _attributes.push_back(attr);
+        }
+
+        _openElements.push_back(_name);
+        _depth = (int) _openElements.size();
+        _rootSeen = true;
+        return TOKEN_START_ELEMENT;
+    }
+
+    int XMLTokenizer::readEndElement()
+    {
+        // Skip "</".
+        _cursor += 2;
+        _name = readName();
+        skipWhitespace();
+        if (_cursor == _end || *_cursor != '>') fail(tinyxml2::XML_ERROR_PARSING_ELEMENT, "unterminated closing tag </" + std::string(_name) + ">");
+        _cursor++;
+
+        if (_openElements.empty() || _openElements.back() != _name)
+        {
+            fail(tinyxml2::XML_ERROR_MISMATCHED_ELEMENT, "unexpected closing tag </" + std::string(_name) + ">");
+        }
+
+        _depth = (int) _openElements.size();
+        _openElements.pop_back();
+        return TOKEN_END_ELEMENT;
+    }
+
+    void XMLTokenizer::skipUntil(std::string_view terminator)
+    {
+        while (!startsWith(_cursor, _end, terminator))
+        {
+            if (_cursor == _end) fail(tinyxml2::XML_ERROR_PARSING, "missing \"" + std::string(terminator) + "\"");
+            if (*_cursor == '\n') _line++;
+            _cursor++;
+        }
+
+        _cursor += terminator.size();
+    }
+
+    std::string_view XMLTokenizer::readName()
+    {
+        const char* start = _cursor;
+        while (_cursor != _end && isNameChar(*_cursor))
+        {
+            _cursor++;
+        }
+
+        return std::string_view(start, _cursor - start);
+    }
+
+    void XMLTokenizer::skipWhitespace()
+    {
+        while (_cursor != _end && isXMLWhitespace(*_cursor))
+        {
+            if (*_cursor == '\n') _line++;
+            _cursor++;
+        }
+    }
+
+    void XMLTokenizer::fail(tinyxml2::XMLError err, const std::string& what) const
+    {
+        throw tinyxml2::TinyXML2Error(err, what + " (line " + std::to_string(_line) + ")");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef IO__XML_TOKENIZER_HPP
+#define IO__XML_TOKENIZER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../lib/tinyxml2/tinyxml2.hpp"
+
+namespace Picross
+{
+    // Forward-only pull tokenizer over an in-memory XML document. Tokens are views into the input
+    // buffer, which must outlive the tokenizer: nothing is copied, and the only allocations are the
+    // reused attribute and element stacks. Declarations, comments and DOCTYPEs are skipped.
+    // Malformed input throws tinyxml2::TinyXML2Error.
+    class XMLTokenizer
+    {
+        public:     // Types
+            struct Attribute
+            {
+                std::string_view name;
+                std::string_view value;     // Raw value, entities are not decoded.
+            };
+
+            // Token types returned by next().
+            inline static const int TOKEN_END_OF_INPUT = 0;
+            inline static const int TOKEN_START_ELEMENT = 1;
+            inline static const int TOKEN_END_ELEMENT = 2;
+            inline static const int TOKEN_TEXT = 3;
+
+        private:    // Attributes
+            const char* _cursor;
+            const char* _end;
+            int _line;
+            std::vector<std::string_view> _openElements;
+            std::vector<Attribute> _attributes;
+            std::string_view _name;
+            std::string_view _text;
+            int _depth;
+            bool _pendingSelfClose;         // Whether the last start element was self-closing and still needs its end token.
+            bool _rootSeen;
+
+        public:     // Public methods
+            XMLTokenizer(const char* data, std::size_t size);
+
+            // Advance to the next token and return its type. Whitespace-only text is skipped.
+            int next();
+
+            // Name of the current element (start and end tokens).
+            std::string_view name() const;
+            // Raw content of the current text token (CDATA sections are returned as text).
+            std::string_view text() const;
+            // Attributes of the current start element.
+            const std::vector<Attribute>& attributes() const;
+            // Find an attribute of the current start element, nullptr if absent.
+            const Attribute* findAttribute(std::string_view name) const;
+            // Number of elements enclosing the current token; a root start element has depth 1.
+            int depth() const;
+            // Line of the input the tokenizer is currently on.
+            int line() const;
+
+            // Decode the predefined entities and character references of a raw value.
+            static std::string decodeEntities(std::string_view raw);
+
+        private:    // Private methods
+            int readStartElement();
+            int readEndElement();
+            void skipUntil(std::string_view terminator);
+            std::string_view readName();
+            void skipWhitespace();
+            // Throw a parsing error mentioning the current line.
+            [[noreturn]] void fail(tinyxml2::XMLError err, const std::string& what) const;
+    };
+}
+
+#endif//IO__XML_TOKENIZER_HPP
\ No newline at end of file
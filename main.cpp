@@ -1,4 +1,7 @@
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <string>
 #include <vector>
 #include <memory>
 
@@ -12,6 +15,7 @@
 #include "picross_cli/cli_solve_grid_command.hpp"
 #include "picross_cli/cli_save_grid_command.hpp"
 #include "picross_cli/cli_modify_grid_command.hpp"
+#include "picross_cli/cli_batch_solver.hpp"
 
 #include "cmake_defines.hpp"
 
@@ -21,6 +25,7 @@ using Picross::CLIModifyGridCommand;
 using Picross::CLISaveGridCommand;
 using Picross::CLILoadGridCommand;
 using Picross::CLICreateGridCommand;
+using Picross::CLIBatchSolver;
 
 using PicrossCLICommand = CLICommand<PicrossCLIState>;
 using PicrossCommandPtr = std::shared_ptr<PicrossCLICommand>;
@@ -34,6 +39,8 @@ using PicrossCLIMenu = CLIMenu<PicrossCLIState>;
 
 // Build CLI app structure and run it.
 void runCLIApp();
+// Solve grids given on the command line, without showing any menu.
+int runBatchSolve(const std::vector<std::string>& args, const char* programName);
 
 int main(int argc, char** argv)
 {
@@ -41,10 +48,65 @@ int main(int argc, char** argv)
 		SetConsoleOutputCP(65001);
 	#endif
 
+	std::vector<std::string> args = std::vector<std::string>(argv + 1, argv + argc);
+	if (!args.empty() && args[0] == "--solve")
+	{
+		return runBatchSolve(std::vector<std::string>(args.begin() + 1, args.end()), argv[0]);
+	}
+
+	if (!args.empty())
+	{
+		CLIBatchSolver::printUsage(std::cerr, argv[0]);
+		return 1;
+	}
+
 	runCLIApp();
 	return 0;
 }
 
+int runBatchSolve(const std::vector<std::string>& args, const char* programName)
+{
+	CLIBatchSolver::Options options;
+	if (!CLIBatchSolver::parseArguments(args, options, std::cerr))
+	{
+		CLIBatchSolver::printUsage(std::cerr, programName);
+		return 1;
+	}
+
+	try
+	{
+		CLIBatchSolver solver = CLIBatchSolver(options);
+		CLIBatchSolver::Summary summary;
+
+		auto start = std::chrono::steady_clock::now();
+		if (options.outputPath.empty())
+		{
+			summary = solver.run(std::cout);
+		}
+		else
+		{
+			std::ofstream output = std::ofstream(options.outputPath, std::ios::trunc);
+			if (!output.is_open())
+			{
+				std::cerr << "Could not open " << options.outputPath << " for writing." << std::endl;
+				return 1;
+			}
+			summary = solver.run(output);
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::cerr << "Solved " << summary.solved << " of " << summary.total << " grids in " << elapsed.count() << " s ("
+				  << summary.unsolved << " unsolved, " << summary.contradictions << " contradictions, "
+				  << summary.timeouts << " timeouts, " << summary.errors << " errors)." << std::endl;
+		return summary.errors ? 1 : 0;
+	}
+	catch(const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+}
+
 void runCLIApp()
 {
 	// Commands available from the "Manipulate grid" menu:
@@ -54,8 +116,15 @@ void runCLIApp()
 		std::make_shared<CLISaveGridCommand>()						// Save the grid to disk
 	};
 
+	// Report background saves as soon as they complete.
+	auto reportSaveResults = [](PicrossCLIState& state, CLIStreams& streams)
+	{
+		state.reportSaveResults(streams);
+	};
+
 	// "Manipulate grid" menu, consisting of the commands instantiated above.
 	PicrossCLIMenu manipulateGridMenu = PicrossCLIMenu(manipulateGridMenuCommands, "Grid manipulation menu", "Close grid", nullptr);
+	manipulateGridMenu.setPromptHook(reportSaveResults);
 
 	// Command sequence for the "Create new grid" option of the main menu:
 	std::vector<PicrossCommandPtr> newGridCommands = {
@@ -77,6 +146,7 @@ void runCLIApp()
 
 	// Creation of the main menu using the command vector defined right above.
 	PicrossCLIMenu mainMenu = PicrossCLIMenu(mainMenuCommands, "Main menu", "Exit", nullptr);
+	mainMenu.setPromptHook(reportSaveResults);
 
 	std::cout << PROJECT_NAME << " " << PROJECT_VERSION << " " << COPYRIGHT_NOTICE << std::endl;
 
@@ -84,5 +154,9 @@ void runCLIApp()
 	PicrossCLIState state = PicrossCLIState();
 	mainMenu.show(state);
 
+	// Do not exit before saves in progress are done.
+	state.saver()->waitIdle();
+	state.reportSaveResults(CLIInput::defaultStreams);
+
 	std::cout << "Thank you for using Picross Engine. Bye!" << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,305 @@
+#include "cli_batch_solver.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../core/grid.hpp"
+#include "../io/grid_archive_reader.hpp"
+#include "../io/grid_corpus_loader.hpp"
+#include "../io/ndjson_result_writer.hpp"
+#include "../solving/batch_solver.hpp"
+#include "../solving/solver.hpp"
+#include "../solving/exceptions/solver_registry_error.hpp"
+#include "../solving/solver_registry.hpp"
+#include "../tools/string_tools.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    namespace
+    {
+        // A grid to solve: a file, or a record of one of the archives.
+        struct BatchItem
+        {
+            std::string id;
+            std::string path;
+            const GridArchiveReader* archive;
+            std::size_t index;
+        };
+
+        NDJSONResultWriter::Status resultStatus(BatchSolver::Status status)
+        {
+            switch (status)
+            {
+                case BatchSolver::Status::Solved:           return NDJSONResultWriter::Status::Solved;
+                case BatchSolver::Status::Unsolved:         return NDJSONResultWriter::Status::Unsolved;
+                case BatchSolver::Status::Contradiction:    return NDJSONResultWriter::Status::Contradiction;
+                case BatchSolver::Status::Timeout:          return NDJSONResultWriter::Status::Timeout;
+                case BatchSolver::Status::Cancelled:        return NDJSONResultWriter::Status::Error;
+                case BatchSolver::Status::Error:            return NDJSONResultWriter::Status::Error;
+            }
+            return NDJSONResultWriter::Status::Error;
+        }
+
+        // Hands each grid over to the first solver of the registry which can solve any grid of its size,
+        // keeping the solvers it made for the next grids.
+        class PickingSolver : public Solver
+        {
+            private:    // Attributes
+                SolverRegistry::Requirements _requirements;
+                std::map<std::string, std::shared_ptr<Solver>> _solvers;
+                std::shared_ptr<Solver> _lastSolver;
+
+            public:     // Public methods
+                PickingSolver(SolverRegistry::Requirements requirements) :
+                    Solver(),
+                    _requirements(requirements),
+                    _solvers(),
+                    _lastSolver(nullptr)
+                {
+
+                }
+
+                virtual std::string name()
+                {
+                    return "Automatic solver";
+                }
+
+                virtual std::shared_ptr<Solver> clone()
+                {
+                    std::shared_ptr<Solver> solver = std::make_shared<PickingSolver>(_requirements);
+                    copySettingsTo(*solver);
+                    return solver;
+                }
+
+                virtual void solve(Grid& grid)
+                {
+                    const SolverRegistry::Entry* entry = SolverRegistry::builtin().pick(grid.getWidth(), grid.getHeight(), _requirements);
+                    if (!entry)
+                    {
+                        throw SolverRegistryError("No registered solver handles " + std::to_string(grid.getWidth()) + "x" + std::to_string(grid.getHeight()) + " grids.");
+                    }
+
+                    std::shared_ptr<Solver>& solver = _solvers[entry->key];
+                    if (!solver) solver = entry->factory();
+                    copySettingsTo(*solver);
+
+                    _lastSolver = solver;
+                    solver->solve(grid);
+                }
+
+                virtual Stats stats()
+                {
+                    return _lastSolver ? _lastSolver->stats() : Stats();
+                }
+        };
+
+        // Parse a non-negative integer option value.
+        bool parseCount(const std::string& value, long long& result)
+        {
+            if (value.empty() || !StringTools::stringIsNum(value, false)) return false;
+
+            try
+            {
+                result = std::stoll(value);
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                return false;
+            }
+        }
+    }
+
+    CLIBatchSolver::CLIBatchSolver(Options options) :
+        _options(options)
+    {
+
+    }
+
+    CLIBatchSolver::Summary CLIBatchSolver::run(std::ostream& out)
+    {
+        // List grids to solve, opening archives once for all workers.
+        std::vector<std::unique_ptr<GridArchiveReader>> archives;
+        std::vector<BatchItem> items;
+        for (const std::string& input : _options.inputs)
+        {
+            if (fs::is_directory(input))
+            {
+                for (const std::string& path : GridCorpusLoader::listGridFiles(input))
+                {
+                    items.push_back({path, path, nullptr, 0});
+                }
+            }
+            else if (fs::path(input).extension() == ".pxga")
+            {
+                archives.push_back(std::make_unique<GridArchiveReader>(input));
+                for (std::size_t i = 0; i < archives.back()->size(); i++)
+                {
+                    items.push_back({input + "#" + std::to_string(i), input, archives.back().get(), i});
+                }
+            }
+            else
+            {
+                items.push_back({input, input, nullptr, 0});
+            }
+        }
+
+        Summary summary = {items.size(), 0, 0, 0, 0, 0};
+        if (items.empty()) return summary;
+
+        // Solvers are made by each worker for itself: timeouts and timers are solver state, which workers cannot share.
+        BatchSolver::SolverFactory factory;
+        if (_options.solverName == AUTO_SOLVER)
+        {
+            // Grids are expected to be solved, within the timeout if there is one.
+            SolverRegistry::Requirements requirements = {true, false, _options.timeout.count() > 0};
+            factory = [this, requirements] ()
+            {
+                std::shared_ptr<Solver> solver = std::make_shared<PickingSolver>(requirements);
+                solver->setTimeout(_options.timeout);
+                return solver;
+            };
+        }
+        else
+        {
+            const SolverRegistry::Entry* entry = SolverRegistry::builtin().find(_options.solverName);
+            if (!entry)
+            {
+                throw SolverRegistryError("No solver is registered as \"" + _options.solverName + "\".");
+            }
+
+            factory = [this, entry] ()
+            {
+                std::shared_ptr<Solver> solver = entry->factory();
+                solver->setTimeout(_options.timeout);
+                return solver;
+            };
+        }
+
+        // Grids are solved from their hints only.
+        auto source = [&items](std::size_t i)
+        {
+            const BatchItem& item = items[i];
+            Grid grid = item.archive ? item.archive->gridAt(item.index) : GridCorpusLoader::loadGridFile(item.path);
+            return Grid(grid.getWidth(), grid.getHeight(), grid.getAllRowHints(), grid.getAllColHints());
+        };
+
+        NDJSONResultWriter writer = NDJSONResultWriter(out);
+        BatchSolver batchSolver = BatchSolver(_options.threadCount, _options.ordered);
+        batchSolver.solveBatch(factory, items.size(), source, [&] (BatchSolver::Result&& result)
+        {
+            NDJSONResultWriter::Status status = resultStatus(result.status);
+            bool withGrid = _options.writeGrids && (status == NDJSONResultWriter::Status::Solved || status == NDJSONResultWriter::Status::Unsolved);
+            writer.write({items[result.index].id, status, result.solveTime, result.stats, withGrid ? &result.grid : nullptr, result.message});
+
+            switch (status)
+            {
+                case NDJSONResultWriter::Status::Solved:        summary.solved++;           break;
+                case NDJSONResultWriter::Status::Unsolved:      summary.unsolved++;         break;
+                case NDJSONResultWriter::Status::Contradiction: summary.contradictions++;   break;
+                case NDJSONResultWriter::Status::Timeout:       summary.timeouts++;         break;
+                case NDJSONResultWriter::Status::Error:         summary.errors++;           break;
+            }
+        });
+
+        writer.flush();
+        return summary;
+    }
+
+    bool CLIBatchSolver::parseArguments(const std::vector<std::string>& args, Options& options, std::ostream& err)
+    {
+        options = {DEFAULT_SOLVER, 0, std::chrono::milliseconds(0), "", false, false, {}};
+
+        for (std::size_t i = 0; i < args.size(); i++)
+        {
+            const std::string& arg = args[i];
+            bool takesValue = arg == "--solver" || arg == "--threads" || arg == "--timeout" || arg == "--output";
+
+            if (takesValue && i + 1 == args.size())
+            {
+                err << "Missing value after " << arg << "." << std::endl;
+                return false;
+            }
+
+            long long count = 0;
+            if (arg == "--solver")
+            {
+                options.solverName = args[++i];
+                if (options.solverName != AUTO_SOLVER && !SolverRegistry::builtin().find(options.solverName))
+                {
+                    err << "Unknown solver \"" << options.solverName << "\"." << std::endl;
+                    return false;
+                }
+            }
+            else if (arg == "--threads" || arg == "--timeout")
+            {
+                if (!parseCount(args[++i], count))
+                {
+                    err << "Invalid value \"" << args[i] << "\" for " << arg << ", expected a non-negative integer." << std::endl;
+                    return false;
+                }
+
+                if (arg == "--threads") options.threadCount = (std::size_t) count;
+                else options.timeout = std::chrono::milliseconds(count);
+            }
+            else if (arg == "--output")
+            {
+                options.outputPath = args[++i];
+            }
+            else if (arg == "--grids")
+            {
+                options.writeGrids = true;
+            }
+            else if (arg == "--ordered")
+            {
+                options.ordered = true;
+            }
+            else if (arg.size() > 2 && arg.substr(0, 2) == "--")
+            {
+                err << "Unknown option " << arg << "." << std::endl;
+                return false;
+            }
+            else
+            {
+                options.inputs.push_back(arg);
+            }
+        }
+
+        if (options.inputs.empty())
+        {
+            err << "No grids to solve." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    void CLIBatchSolver::printUsage(std::ostream& os, const std::string& programName)
+    {
+        os << "Usage:\n";
+        os << "  " << programName << "\n";
+        os << "      Run the interactive menu.\n";
+        os << "  " << programName << " --solve [--solver <name>] [--threads <n>] [--timeout <ms>] [--output <file>] [--grids] [--ordered] <input>...\n";
+        os << "      Solve grid files, directories of grid files and grid archives (.pxga) from their hints, writing\n";
+        os << "      one JSON line of results per grid to the output file, or to the standard output.\n";
+        os << "      --solver   Solver to use (" << DEFAULT_SOLVER << " by default), one of:";
+        for (const SolverRegistry::Entry& entry : SolverRegistry::builtin().entries())
+        {
+            os << " " << entry.key;
+        }
+        os << ", or " << AUTO_SOLVER << " to pick the fastest one able to solve each grid.\n";
+        os << "      --threads  Number of solving threads, 0 for one per hardware thread (default).\n";
+        os << "      --timeout  Time allowed to solve each grid in milliseconds, 0 for no limit (default).\n";
+        os << "      --grids    Write solved grids along with results.\n";
+        os << "      --ordered  Write results in input order rather than as soon as they are available." << std::endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef PICROSS_CLI__CLI_BATCH_SOLVER_HPP
+#define PICROSS_CLI__CLI_BATCH_SOLVER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Picross
+{
+    // Solves many grids without any interaction, as driven by the command line:
+    //  --solve [--solver <name>] [--threads <n>] [--timeout <ms>] [--output <file>] [--grids] [--ordered] <input>...
+    // The solver named `auto` picks, for each grid, the fastest registered solver which solves any grid of its size.
+    // Inputs are grid files, directories (searched recursively for grid files) or grid archives (.pxga).
+    // Grids are solved from their hints only, cells stored in the files are ignored. One NDJSON line is
+    // written per grid (see NDJSONResultWriter), in completion or input order, identified by the path of the
+    // file it comes from, or by `<archive>#<index>` for archived grids.
+    class CLIBatchSolver
+    {
+        public:     // Types
+            struct Options
+            {
+                std::string solverName;             // Key of the solver to use in the solver registry, or AUTO_SOLVER.
+                std::size_t threadCount;            // 0 for one thread per hardware thread.
+                std::chrono::milliseconds timeout;  // Per grid, 0 for none.
+                std::string outputPath;             // Empty to write results to the standard output.
+                bool writeGrids;                    // Whether to write solved grids along with results.
+                bool ordered;                       // Whether to write results in input order.
+                std::vector<std::string> inputs;
+            };
+
+            // Number of grids by outcome.
+            struct Summary
+            {
+                std::size_t total;
+                std::size_t solved;
+                std::size_t unsolved;
+                std::size_t contradictions;
+                std::size_t timeouts;
+                std::size_t errors;
+            };
+
+            inline static const char DEFAULT_SOLVER[] = "backtracking";
+            inline static const char AUTO_SOLVER[] = "auto";
+
+        private:    // Attributes
+            Options _options;
+
+        public:     // Public methods
+            CLIBatchSolver(Options options);
+
+            // Solve every grid of the inputs, writing results to the stream.
+            Summary run(std::ostream& out);
+
+            // Parse the arguments following --solve. Returns false and tells why on the error stream if they are invalid.
+            static bool parseArguments(const std::vector<std::string>& args, Options& options, std::ostream& err);
+            static void printUsage(std::ostream& os, const std::string& programName);
+    };
+}
+
+#endif//PICROSS_CLI__CLI_BATCH_SOLVER_HPP
\ No newline at end of file
@@ -49,6 +49,7 @@ namespace Picross
         {
             // Create the grid.
             state.grid() = Grid(width, height, hHints, vHints);
+            state.gridPath() = "";
             streams.out() << "Grid creation successful." << std::endl;
             return COMMAND_SUCCESS;
         }
@@ -7,7 +7,8 @@
 #include <string>
 #include <iostream>
 
-#include "../io/xml_grid_serializer.hpp"
+#include "../io/grid_corpus_loader.hpp"
+#include "../io/grid_journal.hpp"
 #include "../core/grid.hpp"
 
 namespace Picross
@@ -31,14 +32,14 @@ namespace Picross
     int CLILoadGridCommand::run(PicrossCLIState& state, CLIStreams& streams)
     {
         // Get path from user.
-        std::string path = CLIInput::askForInput<std::string>("Enter path to an XML grid file: ", streams);
+        std::string path = CLIInput::askForInput<std::string>("Enter path to a grid file (XML, .pxgb, .non, webpbn XML or .g): ", streams);
 
-        XMLGridSerialzer reader;
         try
         {
-            // Read the file.
-            Grid loadedGrid = reader.loadGridFromFile(path);
+            // Read the file, in whichever format its extension tells.
+            Grid loadedGrid = GridCorpusLoader::loadGridFile(path);
             state.grid() = loadedGrid;
+            state.gridPath() = GridJournal::canJournal(path) ? path : "";
             streams.out() << "Grid successfully loaded." << std::endl;
 
             return COMMAND_SUCCESS;
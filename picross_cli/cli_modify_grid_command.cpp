@@ -11,14 +11,23 @@
 #include "../picross_shell/shell_check_command.hpp"
 #include "../picross_shell/shell_cross_command.hpp"
 #include "../picross_shell/shell_clear_command.hpp"
+#include "../picross_shell/shell_next_command.hpp"
 #include "../picross_shell/shell_commit_command.hpp"
 #include "../picross_shell/shell_rollback_command.hpp"
 #include "../picross_shell/shell_display_command.hpp"
 #include "../picross_shell/shell_hints_command.hpp"
+#include "../picross_shell/shell_save_command.hpp"
 #include "../picross_shell/shell_exit_command.hpp"
 
 #include <string>
 #include <iostream>
+#include <exception>
+#include <filesystem>
+#include <memory>
+
+#include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
+#include "../io/grid_journal.hpp"
 
 namespace Picross
 {
@@ -44,6 +53,10 @@ namespace Picross
         streams.out() << "Invoking micro-shell..." << std::endl;
         PicrossShell shell = instantiateMicroShell();
         PicrossShellState shellState = CLIStateToShellState(cliState);
+        if (!cliState.gridPath().empty())
+        {
+            openJournal(shellState, cliState.gridPath(), streams);
+        }
 
         bool cleanExit = false;
 
@@ -65,17 +78,22 @@ namespace Picross
             }
         }
         // The shell is done running.
+        shellState.stopLiveDisplay(streams);
+
+        closeJournal(shellState, streams);
 
         // Retrieve modified grid.
+        std::string gridPath = cliState.gridPath();
         cliState = shellStateToCLIState(shellState);
+        cliState.gridPath() = gridPath;
 
         return COMMAND_SUCCESS;
     }
 
     PicrossCLIState CLIModifyGridCommand::shellStateToCLIState(PicrossShellState& shellState)
     {
-        // Keep only the main grid (discarding potential pending changes).
-        PicrossCLIState cliState = PicrossCLIState();
+        // Keep only the main grid (discarding potential pending changes), and the saver so that saves in progress are not lost.
+        PicrossCLIState cliState = PicrossCLIState(shellState.saver());
         cliState.grid() = shellState.mainGrid();
         return cliState;
     }
@@ -83,12 +101,78 @@ namespace Picross
     PicrossShellState CLIModifyGridCommand::CLIStateToShellState(PicrossCLIState& cliState)
     {
         // Copy the grid in CLI in both working grids of the shell state.
-        PicrossShellState shellState = PicrossShellState();
+        PicrossShellState shellState = PicrossShellState(cliState.saver());
         shellState.mainGrid() = cliState.grid();
         shellState.workingGrid() = cliState.grid();
         return shellState;
     }
 
+    void CLIModifyGridCommand::openJournal(PicrossShellState& shellState, const std::string& basePath, CLIStreams& streams)
+    {
+        // A save of the grid may still be in flight: let it land before the journal is based on the file.
+        shellState.saver()->waitIdle();
+        std::shared_ptr<GridJournal> journal = std::make_shared<GridJournal>(basePath, shellState.saver());
+
+        // A journal left on disk means the previous session did not exit properly: replay its edits.
+        Grid recovered = shellState.mainGrid();
+        int recoveredEdits = 0;
+        if (std::filesystem::exists(journal->getJournalPath()))
+        {
+            try
+            {
+                recoveredEdits = GridJournal::replay(journal->getJournalPath(), recovered);
+            }
+            catch(const std::exception& e)
+            {
+                streams.err() << "Journal " << journal->getJournalPath() << " could not be replayed:\n";
+                streams.err() << e.what() << '\n';
+            }
+        }
+
+        try
+        {
+            journal->reset(shellState.mainGrid());
+            if (recoveredEdits > 0)
+            {
+                // Recovered edits are pending changes, journaled again as a single edit.
+                journal->append(diff(shellState.mainGrid(), recovered));
+                shellState.workingGrid() = recovered;
+                streams.out() << "Recovered " << recoveredEdits << " edits from an interrupted session. ";
+                streams.out() << "Use 'commit' to keep them or 'rollback' to discard them." << std::endl;
+            }
+            shellState.setJournal(journal);
+        }
+        catch(const std::exception& e)
+        {
+            // Editing still works without a journal.
+            streams.err() << "Edits will not be journaled:\n";
+            streams.err() << e.what() << '\n';
+        }
+    }
+
+    void CLIModifyGridCommand::closeJournal(PicrossShellState& shellState, CLIStreams& streams)
+    {
+        std::shared_ptr<GridJournal> journal = shellState.journal();
+        if (!journal) return;
+
+        try
+        {
+            // Pending changes were discarded when exiting, only committed ones make it to the file.
+            if (journal->recordCount() > 0)
+            {
+                journal->compact(shellState.mainGrid());
+            }
+            journal->discard();
+        }
+        catch(const std::exception& e)
+        {
+            // Keep the journal around, the edits will be recovered next time.
+            streams.err() << "Grid file " << journal->getBasePath() << " could not be updated:\n";
+            streams.err() << e.what() << '\n';
+        }
+        shellState.setJournal(nullptr);
+    }
+
     CLIModifyGridCommand::PicrossShell CLIModifyGridCommand::instantiateMicroShell()
     {
         // Add all known commands to the shell.
@@ -96,11 +180,20 @@ namespace Picross
         shell.addCommand(std::make_shared<ShellCheckCommand>());
         shell.addCommand(std::make_shared<ShellCrossCommand>());
         shell.addCommand(std::make_shared<ShellClearCommand>());
+        shell.addCommand(std::make_shared<ShellNextCommand>());
         shell.addCommand(std::make_shared<ShellCommitCommand>());
         shell.addCommand(std::make_shared<ShellRollbackCommand>());
         shell.addCommand(std::make_shared<ShellDisplayCommand>());
         shell.addCommand(std::make_shared<ShellHintsCommand>());
+        shell.addCommand(std::make_shared<ShellSaveCommand>());
         shell.setExitCommand(std::make_shared<ShellExitCommand>());
+
+        // Keep the live display up to date, report background saves as soon as they complete.
+        shell.setPromptHook([](PicrossShellState& state, CLIStreams& streams)
+        {
+            state.refreshLiveDisplay(streams);
+            state.reportSaveResults(streams);
+        });
         return shell;
     }
 }
\ No newline at end of file
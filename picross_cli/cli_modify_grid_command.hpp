@@ -29,6 +29,10 @@ namespace Picross
             // Retrieve the main grid from the CLI state into a shell state.
             PicrossShellState CLIStateToShellState(PicrossCLIState& cliState);
             PicrossShell instantiateMicroShell();
+            // Attach a journal of the edits to the shell state, recovering edits left over by an interrupted session.
+            void openJournal(PicrossShellState& shellState, const std::string& basePath, CLIStreams& streams);
+            // Fold the committed grid into its file and remove the journal.
+            void closeJournal(PicrossShellState& shellState, CLIStreams& streams);
     };
 }
 
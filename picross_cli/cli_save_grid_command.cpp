@@ -7,7 +7,8 @@
 #include <string>
 #include <iostream>
 
-#include "../io/xml_grid_serializer.hpp"
+#include "../io/async_grid_saver.hpp"
+#include "../io/grid_journal.hpp"
 
 namespace Picross
 {
@@ -30,25 +31,13 @@ namespace Picross
     int CLISaveGridCommand::run(PicrossCLIState& state, CLIStreams& streams)
     {
         // Get path from user.
-        std::string path = CLIInput::askForInput<std::string>("Enter file path to save the XML grid to: ", streams);
-
-        XMLGridSerialzer writer;
-        try
-        {
-            // Save the grid to the file.
-            writer.saveGridToFile(state.grid(), path);
-            streams.out() << "Grid successfully saved." << std::endl;
-
-            return COMMAND_SUCCESS;
-        }
-        catch(const std::exception& e)
-        {
-            // Informative error logging.
-            streams.err() << "Exception thrown:\n";
-            streams.err() << e.what() << '\n';
-            streams.out() << "Grid could not be saved." << std::endl;
-
-            return COMMAND_FAILURE;
-        }
+        std::string path = CLIInput::askForInput<std::string>("Enter file path to save the grid to (.non for clues only, .pxgb for binary, XML otherwise): ", streams);
+
+        // Save the grid in the background, the outcome is reported at the next prompt.
+        state.saver()->save(state.grid(), path);
+        state.gridPath() = GridJournal::canJournal(path) ? path : "";
+        streams.out() << "Saving grid in the background..." << std::endl;
+
+        return COMMAND_SUCCESS;
     }
 }
\ No newline at end of file
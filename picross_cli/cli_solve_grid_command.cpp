@@ -9,7 +9,7 @@
 #include "../tools/cli/cli_input.hpp"
 #include "picross_cli_state.hpp"
 #include "../solving/solver.hpp"
-#include "../solving/utility.hpp"
+#include "../solving/solver_registry.hpp"
 #include "../io/text_grid_formatter.hpp"
 
 namespace Picross
@@ -32,13 +32,13 @@ namespace Picross
 
     int CLISolveCommand::run(PicrossCLIState& state, CLIStreams& streams)
     {
-        std::vector<SolverPtr> solvers = instantiateAllSolvers();
+        const std::vector<SolverRegistry::Entry>& solvers = SolverRegistry::builtin().entries();
 
         if (solvers.size())
         {
             // Allow choosing from available solvers if any.
             showSolvers(solvers, streams);
-            int input = CLIInput::askForBoundedInput<int>("Please make a choice: ", 0, SOLVER_COUNT, streams);
+            int input = CLIInput::askForBoundedInput<int>("Please make a choice: ", 0, (int) solvers.size(), streams);
 
             // In case of exit, return immediately.
             if (input == 0)
@@ -46,8 +46,8 @@ namespace Picross
                 return COMMAND_SUCCESS;
             }
 
-            // Otherwise, solve.
-            bool result = handleSolving(solvers[input], state, streams);
+            // Otherwise, build the chosen solver and solve.
+            bool result = handleSolving(solvers[input - 1].factory(), state, streams);
             return result ? COMMAND_SUCCESS : COMMAND_FAILURE;            
         }
         else
@@ -59,13 +59,13 @@ namespace Picross
         return COMMAND_SUCCESS;
     }
 
-    void CLISolveCommand::showSolvers(std::vector<CLISolveCommand::SolverPtr>& solvers, CLIStreams& streams)
+    void CLISolveCommand::showSolvers(const std::vector<SolverRegistry::Entry>& solvers, CLIStreams& streams)
     {
         // Print available solvers in a numbered list.
         streams.out() << "Available solvers:\n";
         for (int i = 0; i < solvers.size(); i++)
         {
-            streams.out() << i + 1 << ". " << solvers[i]->name() << '\n';
+            streams.out() << i + 1 << ". " << solvers[i].name << '\n';
         }
         streams.out() << "0. Exit" << std::endl;
     }
@@ -98,7 +98,7 @@ namespace Picross
 
         // Print computed solution, and ask whether to commit the results to the state.
         streams.out() << "The grid is now in the following state:\n";
-        streams.out() << formatter.renderGridWithHints(grid, true);
+        formatter.renderGridWithHints(streams.out(), grid, true);
         bool save = CLIInput::askForInput<bool>("Do you want to keep these changes? ", streams);
 
         if (save)
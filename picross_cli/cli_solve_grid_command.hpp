@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "../solving/solver.hpp"
+#include "../solving/solver_registry.hpp"
 
 namespace Picross
 {
@@ -27,7 +28,7 @@ namespace Picross
 
         private:    // Private methods
             // Print available solvers in a numbered list.
-            void showSolvers(std::vector<SolverPtr>& solvers, CLIStreams& streams);
+            void showSolvers(const std::vector<SolverRegistry::Entry>& solvers, CLIStreams& streams);
             // Solve the grid using a solver.
             bool handleSolving(SolverPtr solver, PicrossCLIState& state, CLIStreams& streams);
     };
@@ -1,13 +1,19 @@
 #include "picross_cli_state.hpp"
 
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include "../core/grid.hpp"
+#include "../io/async_grid_saver.hpp"
+#include "../tools/cli/cli_streams.hpp"
 
 namespace Picross
 {
-    PicrossCLIState::PicrossCLIState() :
-        _grid(0,0)
+    PicrossCLIState::PicrossCLIState(std::shared_ptr<AsyncGridSaver> saver) :
+        _grid(0,0),
+        _gridPath(),
+        _saver(saver)
     {
 
     }
@@ -16,4 +22,19 @@ namespace Picross
     {
         return _grid;
     }
+
+    std::string& PicrossCLIState::gridPath()
+    {
+        return _gridPath;
+    }
+
+    std::shared_ptr<AsyncGridSaver> PicrossCLIState::saver()
+    {
+        return AsyncGridSaver::getOrCreate(_saver);
+    }
+
+    void PicrossCLIState::reportSaveResults(CLIStreams& streams)
+    {
+        AsyncGridSaver::reportResults(_saver, streams.out(), streams.err());
+    }
 }
\ No newline at end of file
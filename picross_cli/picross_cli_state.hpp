@@ -2,8 +2,12 @@
 #define PICROSS_CLI__CLI_PICROSS_CLI_STATE_HPP
 
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include "../core/grid.hpp"
+#include "../io/async_grid_saver.hpp"
+#include "../tools/cli/cli_streams.hpp"
 
 namespace Picross
 {
@@ -11,10 +15,20 @@ namespace Picross
     {
         private:    // Attributes
             Grid _grid;
+            // File the grid was loaded from or saved to, if edits can be journaled against it (empty otherwise).
+            std::string _gridPath;
+            // Shared with the states derived from this one, so that background saves outlive them.
+            std::shared_ptr<AsyncGridSaver> _saver;
 
         public:     // Public methods
-            PicrossCLIState();
+            // A saver is created on first use if none is provided.
+            PicrossCLIState(std::shared_ptr<AsyncGridSaver> saver = nullptr);
             Grid& grid();
+            std::string& gridPath();
+            std::shared_ptr<AsyncGridSaver> saver();
+
+            // Print the outcome of background saves completed since the last call.
+            void reportSaveResults(CLIStreams& streams);
     };
 }
 
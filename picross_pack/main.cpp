@@ -0,0 +1,372 @@
+#include <charconv>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "../io/grid_archive_format.hpp"
+#include "../io/grid_archive_reader.hpp"
+#include "../io/grid_archive_writer.hpp"
+#include "../io/grid_corpus_loader.hpp"
+#include "../io/grid_image_writer.hpp"
+#include "../solving/backtracking_solver.hpp"
+#include "../solving/batch_solver.hpp"
+#include "../solving/difficulty_analyzer.hpp"
+#include "../solving/grid_generator.hpp"
+#include "../core/grid.hpp"
+
+using Picross::Grid;
+using Picross::GridArchiveReader;
+using Picross::GridArchiveWriter;
+using Picross::GridCorpusLoader;
+using Picross::GridImageWriter;
+using Picross::GridGenerator;
+using Picross::BacktrackingSolver;
+using Picross::BatchSolver;
+using Picross::DifficultyAnalyzer;
+
+namespace fs = std::filesystem;
+
+// Print command line usage.
+void printUsage(const char* programName);
+// Report an option value which could not be parsed, followed by the usage. Returns the exit code.
+int invalidValue(const char* programName, const std::string& option, const std::string& value);
+// Parse a whole argument as an unsigned integer, no greater than `max`.
+bool parseUnsigned(const std::string& value, unsigned long long& result, unsigned long long max = ULLONG_MAX);
+// Parse a whole argument as a real number.
+bool parseReal(const std::string& value, double& result);
+// Write an archive next to its destination and only move it in place once `fill` succeeded, so that
+// a failure leaves neither a partial archive nor a damaged previous one behind. Returns the grid count.
+std::size_t writeArchive(const std::string& archivePath, unsigned char recordFormat, const std::function<void(GridArchiveWriter&)>& fill);
+// Collect grid files from a path: the file itself, or every grid file below a directory, in sorted order.
+void collectGridFiles(const std::string& path, std::vector<std::string>& files);
+// Pack grid files into an archive.
+int pack(const std::string& archivePath, const std::vector<std::string>& inputs, unsigned char recordFormat);
+// Print a summary of the contents of an archive.
+int list(const std::string& archivePath);
+// Export every grid of an archive as an image.
+int exportImages(const std::string& archivePath, const std::string& outputDirectory, const std::string& format, int scale);
+// Generate random puzzles with a single solution into an archive.
+int generate(const std::string& archivePath, std::size_t count, GridGenerator::Options options, std::size_t threadCount);
+// Rate the difficulty of every puzzle of an archive.
+int rateDifficulty(const std::string& archivePath, std::size_t threadCount);
+
+int main(int argc, char** argv)
+{
+	std::vector<std::string> args = std::vector<std::string>(argv + 1, argv + argc);
+
+	try
+	{
+		if (args.size() == 2 && args[0] == "--list")
+		{
+			return list(args[1]);
+		}
+
+		if (!args.empty() && args[0] == "--export")
+		{
+			// --export <format> [--scale <n>] <archive> <output directory>
+			unsigned long long scale = 1;
+			if (args.size() == 6 && args[2] == "--scale")
+			{
+				if (!parseUnsigned(args[3], scale, INT_MAX)) return invalidValue(argv[0], args[2], args[3]);
+				args.erase(args.begin() + 2, args.begin() + 4);
+			}
+
+			if (args.size() != 4)
+			{
+				printUsage(argv[0]);
+				return 1;
+			}
+
+			return exportImages(args[2], args[3], args[1], (int) scale);
+		}
+
+		if (!args.empty() && args[0] == "--generate")
+		{
+			// --generate [--density <d>] [--seed <n>] [--threads <n>] <count> <width> <height> <archive>
+			GridGenerator::Options options = {0, 0};
+			unsigned long long threadCount = 0;
+			while (args.size() > 5 && (args[1] == "--density" || args[1] == "--seed" || args[1] == "--threads"))
+			{
+				unsigned long long seed = 0;
+				bool valid = (args[1] == "--density") ? parseReal(args[2], options.density)
+						   : (args[1] == "--seed") ? parseUnsigned(args[2], seed)
+						   : parseUnsigned(args[2], threadCount);
+				if (!valid) return invalidValue(argv[0], args[1], args[2]);
+
+				if (args[1] == "--seed") options.seed = seed;
+				args.erase(args.begin() + 1, args.begin() + 3);
+			}
+
+			if (args.size() != 5)
+			{
+				printUsage(argv[0]);
+				return 1;
+			}
+
+			unsigned long long count, width, height;
+			if (!parseUnsigned(args[1], count)) return invalidValue(argv[0], "<count>", args[1]);
+			if (!parseUnsigned(args[2], width, INT_MAX)) return invalidValue(argv[0], "<width>", args[2]);
+			if (!parseUnsigned(args[3], height, INT_MAX)) return invalidValue(argv[0], "<height>", args[3]);
+
+			options.width = (int) width;
+			options.height = (int) height;
+			return generate(args[4], count, options, threadCount);
+		}
+
+		if (!args.empty() && args[0] == "--difficulty")
+		{
+			// --difficulty [--threads <n>] <archive>
+			unsigned long long threadCount = 0;
+			if (args.size() == 4 && args[1] == "--threads")
+			{
+				if (!parseUnsigned(args[2], threadCount)) return invalidValue(argv[0], args[1], args[2]);
+				args.erase(args.begin() + 1, args.begin() + 3);
+			}
+
+			if (args.size() != 2)
+			{
+				printUsage(argv[0]);
+				return 1;
+			}
+
+			return rateDifficulty(args[1], threadCount);
+		}
+
+		unsigned char recordFormat = Picross::GRID_ARCHIVE_RECORD_BINARY;
+		if (!args.empty() && args[0] == "--xml")
+		{
+			recordFormat = Picross::GRID_ARCHIVE_RECORD_XML;
+			args.erase(args.begin());
+		}
+
+		if (args.size() < 2)
+		{
+			printUsage(argv[0]);
+			return 1;
+		}
+
+		return pack(args[0], std::vector<std::string>(args.begin() + 1, args.end()), recordFormat);
+	}
+	catch(const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+}
+
+void printUsage(const char* programName)
+{
+	std::cerr << "Usage:\n";
+	std::cerr << "  " << programName << " [--xml] <archive> <grid file or directory>...\n";
+	std::cerr << "      Pack XML (.xml) and binary (.pxgb) grid files into an archive, binary records unless --xml is given.\n";
+	std::cerr << "  " << programName << " --list <archive>\n";
+	std::cerr << "      Print the dimensions of every grid in an archive.\n";
+	std::cerr << "  " << programName << " --export <png|pgm|pbm> [--scale <n>] <archive> <output directory>\n";
+	std::cerr << "      Write every grid of an archive as an image, n pixels per cell (1 by default).\n";
+	std::cerr << "  " << programName << " --generate [--density <d>] [--seed <n>] [--threads <n>] <count> <width> <height> <archive>\n";
+	std::cerr << "      Generate random puzzles with a single solution, a ratio d of their cells checked (0.55 by default).\n";
+	std::cerr << "  " << programName << " --difficulty [--threads <n>] <archive>\n";
+	std::cerr << "      Rate how hard every puzzle of an archive is to solve from its hints." << std::endl;
+}
+
+int invalidValue(const char* programName, const std::string& option, const std::string& value)
+{
+	std::cerr << "Invalid value \"" << value << "\" for " << option << ".\n";
+	printUsage(programName);
+	return 1;
+}
+
+bool parseUnsigned(const std::string& value, unsigned long long& result, unsigned long long max)
+{
+	const char* end = value.data() + value.size();
+	unsigned long long parsed;
+	std::from_chars_result res = std::from_chars(value.data(), end, parsed);
+	if (value.empty() || res.ec != std::errc() || res.ptr != end || parsed > max) return false;
+
+	result = parsed;
+	return true;
+}
+
+bool parseReal(const std::string& value, double& result)
+{
+	try
+	{
+		std::size_t parsed;
+		double real = std::stod(value, &parsed);
+		if (parsed != value.size()) return false;
+
+		result = real;
+		return true;
+	}
+	catch(const std::exception&)
+	{
+		return false;
+	}
+}
+
+std::size_t writeArchive(const std::string& archivePath, unsigned char recordFormat, const std::function<void(GridArchiveWriter&)>& fill)
+{
+	std::string temporaryPath = archivePath + ".tmp";
+	try
+	{
+		GridArchiveWriter writer = GridArchiveWriter(temporaryPath, recordFormat);
+		fill(writer);
+		writer.close();
+
+		fs::rename(temporaryPath, archivePath);
+		return writer.size();
+	}
+	catch(...)
+	{
+		// The writer is gone by now, its file is closed.
+		std::error_code ignored;
+		fs::remove(temporaryPath, ignored);
+		throw;
+	}
+}
+
+void collectGridFiles(const std::string& path, std::vector<std::string>& files)
+{
+	if (!fs::is_directory(path))
+	{
+		files.push_back(path);
+		return;
+	}
+
+	std::vector<std::string> found = GridCorpusLoader::listGridFiles(path);
+	files.insert(files.end(), found.begin(), found.end());
+}
+
+int pack(const std::string& archivePath, const std::vector<std::string>& inputs, unsigned char recordFormat)
+{
+	std::vector<std::string> files;
+	for (const std::string& input : inputs)
+	{
+		collectGridFiles(input, files);
+	}
+
+	std::size_t packed = writeArchive(archivePath, recordFormat, [&files](GridArchiveWriter& writer)
+	{
+		for (const std::string& file : files)
+		{
+			try
+			{
+				writer.addGrid(GridCorpusLoader::loadGridFile(file));
+			}
+			catch(const std::exception& e)
+			{
+				throw std::runtime_error(file + ": " + e.what());
+			}
+		}
+	});
+
+	std::cout << "Packed " << packed << " grids into " << archivePath << " (" << fs::file_size(archivePath) << " bytes)." << std::endl;
+	return 0;
+}
+
+int list(const std::string& archivePath)
+{
+	GridArchiveReader reader = GridArchiveReader(archivePath);
+	std::cout << archivePath << ": " << reader.size() << " grids, "
+			  << (reader.getRecordFormat() == Picross::GRID_ARCHIVE_RECORD_XML ? "XML" : "binary") << " records" << std::endl;
+
+	std::size_t index = 0;
+	for (const Grid& grid : reader)
+	{
+		std::cout << index++ << ": " << grid.getWidth() << "x" << grid.getHeight() << (grid.isSolved() ? " (solved)" : "") << std::endl;
+	}
+
+	return 0;
+}
+
+int exportImages(const std::string& archivePath, const std::string& outputDirectory, const std::string& format, int scale)
+{
+	GridImageWriter writer = GridImageWriter(scale);
+	GridImageWriter::BatchResult result = writer.exportArchive(archivePath, outputDirectory, "." + format);
+
+	for (const std::string& error : result.errors)
+	{
+		std::cerr << error << std::endl;
+	}
+
+	std::cout << "Exported " << result.written << " images to " << outputDirectory << "." << std::endl;
+	return result.errors.empty() ? 0 : 1;
+}
+
+int generate(const std::string& archivePath, std::size_t count, GridGenerator::Options options, std::size_t threadCount)
+{
+	GridGenerator generator = GridGenerator(options, threadCount);
+	GridGenerator::Stats stats = {0, 0, 0, 0, 0, std::chrono::nanoseconds(0)};
+	writeArchive(archivePath, Picross::GRID_ARCHIVE_RECORD_BINARY, [&](GridArchiveWriter& writer)
+	{
+		// Puzzles come in completion order, write them in index order so that a seed always gives the same archive.
+		std::map<std::size_t, Grid> pending;
+		std::size_t next = 0;
+		stats = generator.generate(count, [&](std::size_t index, Grid&& grid)
+		{
+			pending.emplace(index, std::move(grid));
+			for (auto it = pending.begin(); it != pending.end() && it->first == next; it = pending.begin())
+			{
+				writer.addGrid(it->second);
+				pending.erase(it);
+				next++;
+			}
+		});
+	});
+
+	std::cout << "Generated " << stats.generated << " " << options.width << "x" << options.height << " puzzles into " << archivePath
+			  << " in " << std::chrono::duration<double>(stats.elapsed).count() << " s (" << stats.puzzlesPerSecond() << " puzzles/s, "
+			  << stats.candidates << " candidates, " << stats.repairs << " repairs, " << stats.exhaustiveChecks << " exhaustive checks, "
+			  << stats.rejected << " rejected)." << std::endl;
+	return 0;
+}
+
+int rateDifficulty(const std::string& archivePath, std::size_t threadCount)
+{
+	GridArchiveReader reader = GridArchiveReader(archivePath);
+
+	// Puzzles are solved once from their hints, and rated from the stats of that solve.
+	std::map<DifficultyAnalyzer::Category, std::size_t> categoryCounts;
+	std::size_t errors = 0;
+	BatchSolver batch = BatchSolver(threadCount, true);
+	batch.solveBatch([] () { return std::make_shared<BacktrackingSolver>(); }, reader.size(), [&reader](std::size_t index)
+	{
+		Grid grid = reader.gridAt(index);
+		return Grid(grid.getWidth(), grid.getHeight(), grid.getAllRowHints(), grid.getAllColHints());
+	},
+	[&](BatchSolver::Result&& result)
+	{
+		std::cout << result.index << ": " << result.grid.getWidth() << "x" << result.grid.getHeight() << " ";
+		if (result.status != BatchSolver::Status::Solved)
+		{
+			std::cout << "error (" << result.message << ")" << std::endl;
+			errors++;
+			return;
+		}
+
+		DifficultyAnalyzer::Report report = DifficultyAnalyzer::assess(result.grid.getWidth(), result.grid.getHeight(), result.stats);
+		categoryCounts[report.category]++;
+		std::cout << DifficultyAnalyzer::categoryName(report.category) << " (" << std::fixed << std::setprecision(1) << report.score << ", "
+				  << report.rounds << " rounds, " << report.guesses << " guesses, depth " << report.depth << ")" << std::endl;
+	});
+
+	std::cout << archivePath << ":";
+	for (const auto& entry : categoryCounts)
+	{
+		std::cout << " " << entry.second << " " << DifficultyAnalyzer::categoryName(entry.first) << ",";
+	}
+	std::cout << " " << errors << " errors." << std::endl;
+	return errors == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -1,9 +1,11 @@
 #include "cell_manip_for_commands.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 #include <string>
 #include "picross_shell_state.hpp"
+#include "../core/grid_delta.hpp"
 #include "../tools/cli/cli_streams.hpp"
 #include "../tools/string_tools.hpp"
 #include "../tools/exceptions/range_bounds_exceeded_error.hpp"
@@ -52,8 +54,20 @@ namespace Picross
             return SHELL_COMMAND_BAD_ARGUMENTS;
         }
 
+        // Record the cells about to change, for the journal.
+        GridDelta delta = GridDelta(width, height);
+        for (int i = std::min(i0, in); i <= std::max(i0, in); i++)
+        {
+            for (int j = std::min(j0, jn); j <= std::max(j0, jn); j++)
+            {
+                cell_t oldValue = state.workingGrid().getCell(i, j);
+                if (oldValue != value) delta.addCellChange(i, j, oldValue, value);
+            }
+        }
+
         // Set the cell range to the corresponding value.
         state.workingGrid().setCellRange(i0, in, j0, jn, value);
+        state.recordEdit(delta);
 
         return SHELL_COMMAND_SUCCESS;
     }
@@ -1,11 +1,24 @@
 #include "picross_shell_state.hpp"
+
+#include <memory>
+
 #include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
+#include "../io/ansi_grid_display.hpp"
+#include "../io/async_grid_saver.hpp"
+#include "../io/grid_journal.hpp"
+#include "../solving/step_solver.hpp"
+#include "../tools/cli/cli_streams.hpp"
 
 namespace Picross
 {
-    PicrossShellState::PicrossShellState() :
+    PicrossShellState::PicrossShellState(std::shared_ptr<AsyncGridSaver> saver) :
         _mainGrid(0, 0),
-        _workingGrid(0, 0)
+        _workingGrid(0, 0),
+        _saver(saver),
+        _journal(nullptr),
+        _liveDisplay(nullptr),
+        _stepSolver()
     {
 
     }
@@ -19,4 +32,60 @@ namespace Picross
     {
         return _workingGrid;
     }
+
+    std::shared_ptr<AsyncGridSaver> PicrossShellState::saver()
+    {
+        return AsyncGridSaver::getOrCreate(_saver);
+    }
+
+    std::shared_ptr<GridJournal> PicrossShellState::journal()
+    {
+        return _journal;
+    }
+
+    void PicrossShellState::setJournal(std::shared_ptr<GridJournal> journal)
+    {
+        _journal = journal;
+    }
+
+    void PicrossShellState::recordEdit(const GridDelta& delta)
+    {
+        if (_journal && !delta.empty())
+        {
+            _journal->append(delta);
+        }
+    }
+
+    std::shared_ptr<AnsiGridDisplay> PicrossShellState::liveDisplay()
+    {
+        return _liveDisplay;
+    }
+
+    void PicrossShellState::setLiveDisplay(std::shared_ptr<AnsiGridDisplay> display)
+    {
+        _liveDisplay = display;
+    }
+
+    void PicrossShellState::refreshLiveDisplay(CLIStreams& streams)
+    {
+        if (_liveDisplay) _liveDisplay->draw(streams.out(), _workingGrid);
+    }
+
+    void PicrossShellState::stopLiveDisplay(CLIStreams& streams)
+    {
+        if (!_liveDisplay) return;
+
+        _liveDisplay->release(streams.out());
+        _liveDisplay = nullptr;
+    }
+
+    StepSolver& PicrossShellState::stepSolver()
+    {
+        return _stepSolver;
+    }
+
+    void PicrossShellState::reportSaveResults(CLIStreams& streams)
+    {
+        AsyncGridSaver::reportResults(_saver, streams.out(), streams.err());
+    }
 }
\ No newline at end of file
@@ -1,7 +1,15 @@
 #ifndef PICROSS_SHELL__PICROSS_SHELL_STATE_HPP
 #define PICROSS_SHELL__PICROSS_SHELL_STATE_HPP
 
+#include <memory>
+
 #include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
+#include "../io/ansi_grid_display.hpp"
+#include "../io/async_grid_saver.hpp"
+#include "../io/grid_journal.hpp"
+#include "../solving/step_solver.hpp"
+#include "../tools/cli/cli_streams.hpp"
 
 namespace Picross
 {
@@ -10,12 +18,38 @@ namespace Picross
         private:    // Attributes
             Grid _mainGrid;
             Grid _workingGrid;
+            std::shared_ptr<AsyncGridSaver> _saver;
+            // Journal of the edits made onto the working grid, if the grid is backed by a file (can be nullptr).
+            std::shared_ptr<GridJournal> _journal;
+            // Display kept up to date with the working grid before each prompt (can be nullptr).
+            std::shared_ptr<AnsiGridDisplay> _liveDisplay;
+            // Deductions made on the working grid, kept from one `next` command to the other.
+            StepSolver _stepSolver;
 
         public:
-            PicrossShellState();
+            // A saver is created on first use if none is provided.
+            PicrossShellState(std::shared_ptr<AsyncGridSaver> saver = nullptr);
             
             Grid& mainGrid();
             Grid& workingGrid();
+            std::shared_ptr<AsyncGridSaver> saver();
+            std::shared_ptr<GridJournal> journal();
+            void setJournal(std::shared_ptr<GridJournal> journal);
+
+            // Record an edit made onto the working grid in the journal, if any.
+            void recordEdit(const GridDelta& delta);
+
+            std::shared_ptr<AnsiGridDisplay> liveDisplay();
+            void setLiveDisplay(std::shared_ptr<AnsiGridDisplay> display);
+            // Bring the live display, if any, up to date with the working grid.
+            void refreshLiveDisplay(CLIStreams& streams);
+            // Give the terminal back and stop updating the live display, if any.
+            void stopLiveDisplay(CLIStreams& streams);
+
+            StepSolver& stepSolver();
+
+            // Print the outcome of background saves completed since the last call.
+            void reportSaveResults(CLIStreams& streams);
     };
 }
 
@@ -7,6 +7,7 @@
 
 #include <vector>
 #include <string>
+#include <exception>
 #include "../tools/string_tools.hpp"
 
 namespace Picross
@@ -35,6 +36,21 @@ namespace Picross
             return SHELL_COMMAND_BAD_ARGUMENTS;
         }
         state.mainGrid() = state.workingGrid();
+
+        // Fold the journaled edits into the file the grid comes from.
+        if (state.journal())
+        {
+            try
+            {
+                state.journal()->compact(state.mainGrid());
+            }
+            catch(const std::exception& e)
+            {
+                // The journal still holds the edits, nothing is lost.
+                streams.out() << "commit: could not write " << state.journal()->getBasePath() << ": " << e.what() << std::endl;
+                return SHELL_COMMAND_FAILURE;
+            }
+        }
         return SHELL_COMMAND_SUCCESS;
     }
 
@@ -52,6 +68,7 @@ namespace Picross
     {
         std::string s;
         s += "commit - save pending changes from the working grid to the main grid.\n";
+        s += "If the grid was loaded from a file, the file is updated as well.\n";
         s += "No arguments.\n";
         return s;
     }
@@ -5,15 +5,18 @@
 #include "shell_display_command.hpp"
 #include "picross_shell_state.hpp"
 
+#include <memory>
 #include <vector>
 #include <string>
 #include "../tools/string_tools.hpp"
+#include "../io/ansi_grid_display.hpp"
 #include "../io/text_grid_formatter.hpp"
 
 namespace Picross
 {
     ShellDisplayCommand::ShellDisplayCommand() :
-        MicroShellCommand<PicrossShellState>()
+        MicroShellCommand<PicrossShellState>(),
+        _formatter()
     {
 
     }
@@ -30,7 +33,25 @@ namespace Picross
         // Parse arguments.
         std::vector<std::string> tokens = StringTools::tokenizeString(command, ' ', true);
 
-        TextGridFormatter tgf = TextGridFormatter();
+        if (tokens.size() >= 2 && tokens[1] == "live")
+        {
+            if (tokens.size() > 3)
+            {
+                streams.out() << "display: too many arguments." << std::endl;
+                return SHELL_COMMAND_BAD_ARGUMENTS;
+            }
+            if (tokens.size() == 3 && tokens[2] != "nohints")
+            {
+                streams.out() << "display: unknown argument \"" << tokens[2] << "\"." << std::endl;
+                return SHELL_COMMAND_BAD_ARGUMENTS;
+            }
+
+            // Replace any live display, the new one is drawn from scratch.
+            state.stopLiveDisplay(streams);
+            state.setLiveDisplay(std::make_shared<AnsiGridDisplay>(tokens.size() < 3));
+            state.refreshLiveDisplay(streams);
+            return SHELL_COMMAND_SUCCESS;
+        }
 
         if (tokens.size() > 2)          // Too many arguments.
         {
@@ -39,11 +60,29 @@ namespace Picross
         }
         else if (tokens.size() < 2)     // No arguments (apart from the command name).
         {
-            streams.out() << tgf.renderGridWithHints(state.workingGrid());
+            _formatter.renderGridWithHints(streams.out(), state.workingGrid());
             return SHELL_COMMAND_SUCCESS;
         }
         else // if (tokens.size() == 2)
         {
+            if (tokens[1] == "refresh")
+            {
+                if (!state.liveDisplay())
+                {
+                    streams.out() << "display: no live display to refresh." << std::endl;
+                    return SHELL_COMMAND_FAILURE;
+                }
+
+                state.liveDisplay()->redraw(streams.out(), state.workingGrid());
+                return SHELL_COMMAND_SUCCESS;
+            }
+
+            if (tokens[1] == "off")
+            {
+                state.stopLiveDisplay(streams);
+                return SHELL_COMMAND_SUCCESS;
+            }
+
             if (tokens[1] != "nohints")
             {
                 streams.out() << "display: unknown argument \"" << tokens[1] << "\"." << std::endl;
@@ -51,7 +90,7 @@ namespace Picross
             }
 
             // else if (tokens[1] == "nohints")
-            streams.out() << tgf.renderGrid(state.workingGrid());
+            _formatter.renderGrid(streams.out(), state.workingGrid());
             return SHELL_COMMAND_SUCCESS;
         }
     }
@@ -71,7 +110,12 @@ namespace Picross
         std::string s;
         s += "display - print a representation of the current state of the working grid.\n";
         s += "Syntax: display [nohints]\n";
-        s += " - `nohints`: when specified, hints are not printed on the side of the grid.";
+        s += "        display live [nohints]\n";
+        s += "        display refresh|off\n";
+        s += " - `nohints`: when specified, hints are not printed on the side of the grid.\n";
+        s += " - `live`: keep the grid at the top of the terminal and update the cells which changed after each command.\n";
+        s += " - `refresh`: draw the live display again from scratch, after the terminal was resized for instance.\n";
+        s += " - `off`: stop updating the live display.";
         return s;
     }
 
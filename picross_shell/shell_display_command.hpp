@@ -7,11 +7,16 @@
 #include "picross_shell_state.hpp"
 
 #include <string>
+#include "../io/text_grid_formatter.hpp"
 
 namespace Picross
 {
     class ShellDisplayCommand : public MicroShellCommand<PicrossShellState>
     {
+        private:    // Attributes
+            // Kept across calls, so that hints are only rendered again when they change.
+            TextGridFormatter _formatter;
+
         public:     // Public methods
             ShellDisplayCommand();
             virtual ~ShellDisplayCommand();
@@ -10,6 +10,8 @@
 #include <algorithm>
 #include "../tools/string_tools.hpp"
 #include "../tools/lambda_maker.hpp"
+#include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
 
 namespace Picross
 {
@@ -36,23 +38,52 @@ namespace Picross
             streams.out() << "hints: too few arguments." << std::endl;
             return SHELL_COMMAND_BAD_ARGUMENTS;
         }
-        else if (tokens[1] == "generate")   // Handle `hints generate ...` commands.
+
+        // Keep the current hints, so that whatever the subroutine changes can be journaled.
+        std::vector<std::vector<int>> oldRowHints = state.workingGrid().getAllRowHints();
+        std::vector<std::vector<int>> oldColHints = state.workingGrid().getAllColHints();
+        int result;
+
+        if (tokens[1] == "generate")        // Handle `hints generate ...` commands.
         {
-            return generateSubroutine(tokens, state, streams);
+            result = generateSubroutine(tokens, state, streams);
         }
         else if (tokens[1] == "clear")      // Handle `hints clear ...` commands.
         {
-            return clearSubroutine(tokens, state, streams);
+            result = clearSubroutine(tokens, state, streams);
         }
         else if (tokens[1] == "row" || tokens[1] == "col")  // Handle `hints <row|col> ...` commands.
         {
-            return directionSubroutine(tokens, state, streams);
+            result = directionSubroutine(tokens, state, streams);
         }
         else    // Unknown argument.
         {
             streams.out() << "hints: unknown argument \"" << tokens[1] << "\"." << std::endl;
             return SHELL_COMMAND_BAD_ARGUMENTS;
         }
+
+        if (result == SHELL_COMMAND_SUCCESS)
+        {
+            state.recordEdit(hintDelta(oldRowHints, oldColHints, state.workingGrid()));
+        }
+        return result;
+    }
+
+    GridDelta ShellHintsCommand::hintDelta(const std::vector<std::vector<int>>& oldRowHints, const std::vector<std::vector<int>>& oldColHints, const Grid& grid)
+    {
+        GridDelta delta = GridDelta(grid.getWidth(), grid.getHeight());
+        for (int i = 0; i < grid.getHeight(); i++)
+        {
+            std::vector<int> newHints = grid.getRowHints(i);
+            if (newHints != oldRowHints[i]) delta.addRowHintChange(i, oldRowHints[i], newHints);
+        }
+        for (int j = 0; j < grid.getWidth(); j++)
+        {
+            std::vector<int> newHints = grid.getColHints(j);
+            if (newHints != oldColHints[j]) delta.addColHintChange(j, oldColHints[j], newHints);
+        }
+
+        return delta;
     }
 
     int ShellHintsCommand::generateSubroutine(const std::vector<std::string>& tokens, PicrossShellState& state, CLIStreams& streams)
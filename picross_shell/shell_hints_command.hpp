@@ -5,6 +5,8 @@
 #include "../tools/cli/cli_input.hpp"
 #include "../tools/cli/cli_streams.hpp"
 #include "picross_shell_state.hpp"
+#include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
 
 #include <vector>
 #include <string>
@@ -36,6 +38,8 @@ namespace Picross
             int directionSubroutine(const std::vector<std::string>& tokens, PicrossShellState& state, CLIStreams& streams);
             // Handle `hints <row|col> clear` commands
             int clearDirectionSubroutine(const std::vector<std::string>& tokens, PicrossShellState& state, CLIStreams& streams);
+            // Build the delta between previous hints and the current hints of a grid.
+            GridDelta hintDelta(const std::vector<std::vector<int>>& oldRowHints, const std::vector<std::vector<int>>& oldColHints, const Grid& grid);
     };
 }
 
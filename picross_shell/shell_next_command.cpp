@@ -0,0 +1,171 @@
+#include "../tools/micro_shell/micro_shell_command.hpp"
+#include "../tools/micro_shell/micro_shell_codes.hpp"
+#include "../tools/cli/cli_input.hpp"
+#include "../tools/cli/cli_streams.hpp"
+#include "shell_next_command.hpp"
+#include "picross_shell_state.hpp"
+
+#include <vector>
+#include <string>
+#include "../tools/string_tools.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+#include "../core/grid_delta.hpp"
+#include "../solving/step_solver.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        std::string lineName(const StepSolver::Step& step)
+        {
+            std::string s = (step.isRow ? "Row " : "Column ") + std::to_string(step.index) + " (";
+            for (std::size_t k = 0; k < step.hints.size(); k++)
+            {
+                if (k > 0) s += " ";
+                s += std::to_string(step.hints[k]);
+            }
+            return s + (step.hints.empty() ? "0)" : ")");
+        }
+
+        // Positions of consecutive cells, written as ranges the cell commands accept (e.g: `2:4, 7`).
+        std::string positionList(const std::vector<int>& positions)
+        {
+            std::string s;
+            for (std::size_t k = 0; k < positions.size(); )
+            {
+                std::size_t end = k;
+                while (end + 1 < positions.size() && positions[end + 1] == positions[end] + 1) end++;
+
+                if (!s.empty()) s += ", ";
+                s += std::to_string(positions[k]);
+                if (end > k) s += ":" + std::to_string(positions[end]);
+                k = end + 1;
+            }
+            return s;
+        }
+
+        std::string reasonText(const StepSolver::CellDeduction& cell, const std::vector<int>& hints, bool plural)
+        {
+            std::string them = plural ? "them" : "it";
+            switch (cell.reason)
+            {
+                case StepSolver::Reason::Overlap:
+                    return "every placement of block " + std::to_string(cell.block + 1) + " (length " + std::to_string(hints[cell.block]) + ") covers " + them;
+                case StepSolver::Reason::Unreachable:
+                    return "no block can reach " + them;
+                case StepSolver::Reason::Arrangements:
+                    break;
+            }
+            return cell.value == CELL_CHECKED ? "every arrangement of the hints fills " + them : "no arrangement of the hints fills " + them;
+        }
+    }
+
+    ShellNextCommand::ShellNextCommand() :
+        MicroShellCommand<PicrossShellState>()
+    {
+
+    }
+
+    ShellNextCommand::~ShellNextCommand()
+    {
+
+    }
+
+    int ShellNextCommand::processInput(const std::string& command, PicrossShellState& state, CLIStreams& streams)
+    {
+        // Expected syntax: see docstring in help().
+
+        // Parse arguments.
+        std::vector<std::string> tokens = StringTools::tokenizeString(command, ' ', true);
+
+        if (tokens.size() > 2)          // Too many arguments.
+        {
+            streams.out() << "next: too many arguments." << std::endl;
+            return SHELL_COMMAND_BAD_ARGUMENTS;
+        }
+        else if (tokens.size() == 2 && tokens[1] != "apply")    // Unknown argument.
+        {
+            streams.out() << "next: unknown argument \"" << tokens[1] << "\"." << std::endl;
+            return SHELL_COMMAND_BAD_ARGUMENTS;
+        }
+
+        StepSolver::Step step = state.stepSolver().next(state.workingGrid());
+        streams.out() << explain(step);
+
+        if (tokens.size() == 2 && step.status == StepSolver::Status::Deduced)
+        {
+            // Record the cells about to change, for the journal.
+            Grid& grid = state.workingGrid();
+            GridDelta delta = GridDelta(grid.getWidth(), grid.getHeight());
+            for (const StepSolver::CellDeduction& cell : step.cells)
+            {
+                int i = step.isRow ? step.index : cell.position;
+                int j = step.isRow ? cell.position : step.index;
+                delta.addCellChange(i, j, grid.getCell(i, j), cell.value);
+            }
+
+            StepSolver::apply(step, grid);
+            state.recordEdit(delta);
+        }
+
+        return SHELL_COMMAND_SUCCESS;
+    }
+
+    std::string ShellNextCommand::explain(const StepSolver::Step& step)
+    {
+        switch (step.status)
+        {
+            case StepSolver::Status::Contradiction:
+                return lineName(step) + ": the cells already set do not fit the hints.\n";
+            case StepSolver::Status::Stuck:
+                return "No single line allows any deduction, a guess is needed.\n";
+            case StepSolver::Status::Solved:
+                return "Every cell is known, the grid is solved.\n";
+            case StepSolver::Status::Deduced:
+                break;
+        }
+
+        // Cells come in line order, group consecutive cells set to the same value for the same reason.
+        std::string s = lineName(step) + ":\n";
+        std::string cellKind = step.isRow ? "column" : "row";
+        for (std::size_t k = 0; k < step.cells.size(); )
+        {
+            const StepSolver::CellDeduction& cell = step.cells[k];
+            std::vector<int> positions;
+            for (; k < step.cells.size(); k++)
+            {
+                const StepSolver::CellDeduction& other = step.cells[k];
+                if (other.value != cell.value || other.reason != cell.reason || other.block != cell.block) break;
+                positions.push_back(other.position);
+            }
+
+            bool plural = positions.size() > 1;
+            s += std::string(" - ") + (cell.value == CELL_CHECKED ? "check " : "cross ") + cellKind + (plural ? "s " : " ") + positionList(positions);
+            s += ", " + reasonText(cell, step.hints, plural) + ".\n";
+        }
+        return s;
+    }
+
+    std::string ShellNextCommand::name()
+    {
+        return "next";
+    }
+
+    std::string ShellNextCommand::description()
+    {
+        return "Explain the next logical deduction";
+    }
+
+    std::string ShellNextCommand::help()
+    {
+        std::string s;
+        s += "next - find a line of the working grid which allows to check or cross cells, and explain why.\n";
+        s += "Syntax: next [apply]\n";
+        s += " - `apply`: also set the cells deduced in the working grid.\n";
+        s += "Blocks are numbered from 1, in the order of the hints of the line.\n";
+        s += "Lines are only looked at again once cells crossing them change, so that asking is quick on large grids.\n";
+        return s;
+    }
+
+}
\ No newline at end of file
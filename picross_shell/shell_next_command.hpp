@@ -0,0 +1,30 @@
+#ifndef PICROSS_SHELL__SHELL_NEXT_COMMAND_HPP
+#define PICROSS_SHELL__SHELL_NEXT_COMMAND_HPP
+
+#include "../tools/micro_shell/micro_shell_command.hpp"
+#include "../tools/cli/cli_input.hpp"
+#include "../tools/cli/cli_streams.hpp"
+#include "picross_shell_state.hpp"
+#include "../solving/step_solver.hpp"
+
+#include <string>
+
+namespace Picross
+{
+    class ShellNextCommand : public MicroShellCommand<PicrossShellState>
+    {
+        public:     // Public methods
+            ShellNextCommand();
+            virtual ~ShellNextCommand();
+
+            virtual int processInput(const std::string& command, PicrossShellState& state, CLIStreams& streams = CLIInput::defaultStreams);
+            virtual std::string name();
+            virtual std::string description();
+            virtual std::string help();
+
+            // Explain a step in words, one line for each group of cells set for the same reason.
+            static std::string explain(const StepSolver::Step& step);
+    };
+}
+
+#endif//PICROSS_SHELL__SHELL_NEXT_COMMAND_HPP
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <vector>
 #include <string>
 #include "../tools/string_tools.hpp"
+#include "../core/grid_delta.hpp"
 
 namespace Picross
 {
@@ -32,7 +33,11 @@ namespace Picross
             return SHELL_COMMAND_BAD_ARGUMENTS;
         }
 
-        // Revert changes on the working grid.
+        // Revert changes on the working grid, journaling the revert like any other edit.
+        if (state.journal())
+        {
+            state.recordEdit(diff(state.workingGrid(), state.mainGrid()));
+        }
         state.workingGrid() = state.mainGrid();
         return SHELL_COMMAND_SUCCESS;
     }
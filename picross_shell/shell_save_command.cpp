@@ -0,0 +1,68 @@
+#include "../tools/micro_shell/micro_shell_command.hpp"
+#include "../tools/micro_shell/micro_shell_codes.hpp"
+#include "../tools/cli/cli_input.hpp"
+#include "../tools/cli/cli_streams.hpp"
+#include "shell_save_command.hpp"
+#include "picross_shell_state.hpp"
+
+#include <vector>
+#include <string>
+#include "../tools/string_tools.hpp"
+#include "../io/async_grid_saver.hpp"
+
+namespace Picross
+{
+    ShellSaveCommand::ShellSaveCommand() :
+        MicroShellCommand<PicrossShellState>()
+    {
+
+    }
+
+    ShellSaveCommand::~ShellSaveCommand()
+    {
+
+    }
+
+    int ShellSaveCommand::processInput(const std::string& command, PicrossShellState& state, CLIStreams& streams)
+    {
+        // Expected syntax: see docstring in help().
+        
+        // Parse arguments.
+        std::vector<std::string> tokens = StringTools::tokenizeString(command, ' ', true);
+
+        if (tokens.size() < 2)          // Too few arguments.
+        {
+            streams.out() << "save: too few arguments." << std::endl;
+            return SHELL_COMMAND_BAD_ARGUMENTS;
+        }
+        else if (tokens.size() > 2)     // Too many arguments.
+        {
+            streams.out() << "save: too many arguments." << std::endl;
+            return SHELL_COMMAND_BAD_ARGUMENTS;
+        }
+
+        // Only committed changes are saved, in the background.
+        state.saver()->save(state.mainGrid(), tokens[1]);
+        return SHELL_COMMAND_SUCCESS;
+    }
+
+    std::string ShellSaveCommand::name()
+    {
+        return "save";
+    }
+
+    std::string ShellSaveCommand::description()
+    {
+        return "Save the grid to disk";
+    }
+
+    std::string ShellSaveCommand::help()
+    {
+        std::string s;
+        s += "save <path> - save the main grid (committed changes only) to a file, in the background.\n";
+        s += "The format is picked from the extension: .non for clues only, .pxgb for binary, XML otherwise.\n";
+        s += "Whether the save succeeded is reported at the next prompt.\n";
+        return s;
+    }
+
+}
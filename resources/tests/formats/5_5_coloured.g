@@ -0,0 +1,10 @@
+#d
+   0:   0   white
+   1:   1   black
+   a:   %   red
+: rows
+2 1a
+3
+: columns
+1
+1a
@@ -0,0 +1,14 @@
+# Small house
+# Picross test set
+: rows
+2 1
+3
+1 1
+0
+5
+: columns
+1 1 1
+2 1
+1 1
+2 1
+1 1
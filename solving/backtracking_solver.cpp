@@ -0,0 +1,146 @@
+#include "backtracking_solver.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "solver.hpp"
+#include "line_propagator.hpp"
+#include "exceptions/unsolvable_grid_error.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    BacktrackingSolver::BacktrackingSolver() :
+        Solver(),
+        _propagator(),
+        _guessCount(0),
+        _backtrackCount(0),
+        _maxDepth(0)
+    {
+
+    }
+
+    BacktrackingSolver::~BacktrackingSolver()
+    {
+
+    }
+
+    std::string BacktrackingSolver::name()
+    {
+        return "Backtracking solver";
+    }
+
+    std::shared_ptr<Solver> BacktrackingSolver::clone()
+    {
+        std::shared_ptr<Solver> solver = std::make_shared<BacktrackingSolver>();
+        copySettingsTo(*solver);
+        return solver;
+    }
+
+    void BacktrackingSolver::solve(Grid& grid)
+    {
+        startTimer();
+        _propagator.reset(grid);
+        _guessCount = 0;
+        _backtrackCount = 0;
+        _maxDepth = 0;
+
+        if (!search(0))
+        {
+            throw UnsolvableGridError("No cell layout satisfies the hints of the grid.");
+        }
+
+        _propagator.copyCellsTo(grid);
+    }
+
+    std::size_t BacktrackingSolver::countSolutions(const Grid& grid, std::size_t limit)
+    {
+        startTimer();
+        _propagator.reset(grid);
+        _guessCount = 0;
+        _backtrackCount = 0;
+        _maxDepth = 0;
+
+        std::size_t found = 0;
+        if (limit > 0) count(limit, found, 0);
+        return found;
+    }
+
+    Solver::Stats BacktrackingSolver::stats()
+    {
+        return {
+            {"lines", _propagator.lineCount()},
+            {"guesses", _guessCount},
+            {"backtracks", _backtrackCount},
+            {"rounds", _propagator.roundCount()},
+            {"depth", _maxDepth}
+        };
+    }
+
+    bool BacktrackingSolver::search(int depth)
+    {
+        if (!_propagator.propagate([this] () { checkInterruption(); }))
+        {
+            return false;
+        }
+
+        int cell = _propagator.firstUnknownCell();
+        if (cell < 0)
+        {
+            return true;
+        }
+
+        checkInterruption();
+        _guessCount++;
+        _maxDepth = std::max<std::int64_t>(_maxDepth, depth + 1);
+        std::size_t trailSize = _propagator.trailSize();
+
+        for (cell_t guess : {CELL_CHECKED, CELL_CROSSED})
+        {
+            _propagator.setCell(cell, guess);
+            if (search(depth + 1))
+            {
+                return true;
+            }
+
+            _propagator.undo(trailSize);
+            _backtrackCount++;
+        }
+
+        return false;
+    }
+
+    void BacktrackingSolver::count(std::size_t limit, std::size_t& found, int depth)
+    {
+        if (!_propagator.propagate([this] () { checkInterruption(); }))
+        {
+            return;
+        }
+
+        int cell = _propagator.firstUnknownCell();
+        if (cell < 0)
+        {
+            found++;
+            return;
+        }
+
+        checkInterruption();
+        _guessCount++;
+        _maxDepth = std::max<std::int64_t>(_maxDepth, depth + 1);
+        std::size_t trailSize = _propagator.trailSize();
+
+        for (cell_t guess : {CELL_CHECKED, CELL_CROSSED})
+        {
+            _propagator.setCell(cell, guess);
+            count(limit, found, depth + 1);
+            _propagator.undo(trailSize);
+
+            if (found >= limit) return;
+            _backtrackCount++;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#ifndef SOLVING__BACKTRACKING_SOLVER_HPP
+#define SOLVING__BACKTRACKING_SOLVER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "solver.hpp"
+#include "line_propagator.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Solves any satisfiable grid: line deductions are run until they make no more progress, then
+    // an unknown cell is guessed checked, and crossed if that leads to a contradiction. Guesses are
+    // undone through the trail of the propagator. The first solution found is kept. Solutions can be
+    // counted by carrying on the search past the first one.
+    class BacktrackingSolver : public Solver
+    {
+        private:    // Attributes
+            LinePropagator _propagator;
+            std::int64_t _guessCount;
+            std::int64_t _backtrackCount;
+            // Deepest nesting of guesses reached.
+            std::int64_t _maxDepth;
+
+        public:     // Public methods
+            BacktrackingSolver();
+            virtual ~BacktrackingSolver();
+
+            virtual std::string name();
+            virtual std::shared_ptr<Solver> clone();
+            virtual void solve(Grid& grid);
+            virtual std::size_t countSolutions(const Grid& grid, std::size_t limit);
+            virtual Stats stats();
+
+        private:    // Private methods
+            // Propagate, then guess recursively. Returns false if the current cells lead to no solution.
+            bool search(int depth);
+            // Propagate, then guess both ways recursively, counting solutions until the limit is reached.
+            void count(std::size_t limit, std::size_t& found, int depth);
+    };
+}
+
+#endif//SOLVING__BACKTRACKING_SOLVER_HPP
\ No newline at end of file
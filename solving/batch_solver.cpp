@@ -0,0 +1,150 @@
+#include "batch_solver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "solver.hpp"
+#include "exceptions/solver_cancelled_error.hpp"
+#include "exceptions/solver_timeout_error.hpp"
+#include "exceptions/unsolvable_grid_error.hpp"
+#include "../core/grid.hpp"
+#include "../tools/parallel_tools.hpp"
+#include "../tools/thread_pool.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        // Solve one grid, turning every outcome into a result.
+        void solveOne(Solver& solver, const BatchSolver::GridSource& source, BatchSolver::Result& result)
+        {
+            try
+            {
+                result.grid = source(result.index);
+            }
+            catch(const std::exception& e)
+            {
+                result.status = BatchSolver::Status::Error;
+                result.message = e.what();
+                return;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            try
+            {
+                solver.solve(result.grid);
+                result.status = result.grid.isSolved() ? BatchSolver::Status::Solved : BatchSolver::Status::Unsolved;
+            }
+            catch(const UnsolvableGridError& e)
+            {
+                result.status = BatchSolver::Status::Contradiction;
+            }
+            catch(const SolverTimeoutError& e)
+            {
+                result.status = BatchSolver::Status::Timeout;
+                result.message = e.what();
+            }
+            catch(const SolverCancelledError& e)
+            {
+                result.status = BatchSolver::Status::Cancelled;
+                result.message = e.what();
+            }
+            catch(const std::exception& e)
+            {
+                result.status = BatchSolver::Status::Error;
+                result.message = e.what();
+            }
+            result.solveTime = std::chrono::steady_clock::now() - start;
+            result.stats = solver.stats();
+        }
+    }
+
+    BatchSolver::BatchSolver(std::size_t threadCount, bool ordered, std::size_t queueCapacity) :
+        _threadCount(threadCount > 0 ? threadCount : ThreadPool::defaultThreadCount()),
+        _ordered(ordered),
+        _queueCapacity(queueCapacity)
+    {
+
+    }
+
+    void BatchSolver::solveBatch(Solver& solver, std::size_t count, const GridSource& source, const Consumer& consumer)
+    {
+        // Clones are made on the calling thread, the solver being possibly not thread-safe.
+        std::vector<std::shared_ptr<Solver>> clones;
+        for (std::size_t t = 0; t < std::min(_threadCount, count); t++)
+        {
+            clones.push_back(solver.clone());
+        }
+
+        run([&clones](std::size_t t) { return clones[t]; }, count, source, consumer);
+    }
+
+    void BatchSolver::solveBatch(const SolverFactory& factory, std::size_t count, const GridSource& source, const Consumer& consumer)
+    {
+        run([&factory](std::size_t) { return factory(); }, count, source, consumer);
+    }
+
+    void BatchSolver::run(const std::function<std::shared_ptr<Solver>(std::size_t)>& workerSolver, std::size_t count, const GridSource& source, const Consumer& consumer)
+    {
+        // Each worker makes its solver when it gets its first grid. Without a solver the batch cannot
+        // be completed: a failure to make one stops every worker.
+        std::vector<std::shared_ptr<Solver>> solvers = std::vector<std::shared_ptr<Solver>>(std::min(_threadCount, count));
+        auto solve = [&](std::size_t t, std::size_t i)
+        {
+            if (!solvers[t]) solvers[t] = workerSolver(t);
+
+            Result result;
+            result.index = i;
+            solveOne(*solvers[t], source, result);
+            return result;
+        };
+
+        // Results which came in before their turn, in ordered batches.
+        std::map<std::size_t, Result> pending;
+        std::size_t nextToConsume = 0;
+        auto consume = [&](Result&& result)
+        {
+            if (!_ordered)
+            {
+                consumer(std::move(result));
+                return;
+            }
+
+            pending.emplace(result.index, std::move(result));
+            for (auto it = pending.begin(); it != pending.end() && it->first == nextToConsume; it = pending.begin())
+            {
+                consumer(std::move(it->second));
+                pending.erase(it);
+                nextToConsume++;
+            }
+        };
+
+        ParallelTools::produceAndConsume<Result>(count, _threadCount, _queueCapacity, solve, consume);
+    }
+
+    std::vector<BatchSolver::Result> BatchSolver::solveBatch(Solver& solver, const std::vector<Grid>& grids)
+    {
+        std::vector<Result> results = std::vector<Result>(grids.size());
+        solveBatch(solver, grids.begin(), grids.end(), [&results](Result&& result)
+        {
+            results[result.index] = std::move(result);
+        });
+        return results;
+    }
+
+    std::size_t BatchSolver::getThreadCount() const
+    {
+        return _threadCount;
+    }
+
+    bool BatchSolver::isOrdered() const
+    {
+        return _ordered;
+    }
+}
\ No newline at end of file
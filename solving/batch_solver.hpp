@@ -0,0 +1,83 @@
+#ifndef SOLVING__BATCH_SOLVER_HPP
+#define SOLVING__BATCH_SOLVER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "solver.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Runs a solver over many grids on several threads. Every worker solves with its own clone of the
+    // solver, so that solvers need not be thread-safe and keep their working memory from one grid to
+    // the next. Results are handed over to a consumer on the calling thread through a bounded queue,
+    // either in completion order or in grid order.
+    class BatchSolver
+    {
+        public:     // Types
+            enum class Status
+            {
+                Solved,         // The grid was solved.
+                Unsolved,       // The solver stopped before the grid was solved.
+                Contradiction,  // The hints cannot be satisfied.
+                Timeout,        // The solver ran out of time.
+                Cancelled,      // The cancel flag of the solver was raised.
+                Error           // The grid could not be obtained, or the solver failed.
+            };
+
+            struct Result
+            {
+                std::size_t index;                      // Position of the grid in the batch.
+                Status status;
+                Grid grid = Grid(0, 0);                 // The grid as the solver left it.
+                std::chrono::nanoseconds solveTime = std::chrono::nanoseconds(0);
+                Solver::Stats stats;
+                std::string message;                    // Reason of an error or a timeout.
+            };
+
+            // Provides the grid at a given position of the batch, called from worker threads.
+            using GridSource = std::function<Grid(std::size_t)>;
+            using Consumer = std::function<void(Result&&)>;
+            // Makes the solver of a worker, called from the worker thread.
+            using SolverFactory = std::function<std::shared_ptr<Solver>()>;
+
+        private:    // Attributes
+            std::size_t _threadCount;
+            bool _ordered;
+            std::size_t _queueCapacity;
+
+        public:     // Public methods
+            // A thread count of 0 uses one thread per hardware thread. Ordered batches hold results
+            // back until every result before them has been consumed.
+            BatchSolver(std::size_t threadCount = 0, bool ordered = false, std::size_t queueCapacity = 64);
+
+            // Solve `count` grids taken from the source and pass results to the consumer, on the calling
+            // thread. The solver itself is only used to make clones. If the consumer throws, solving
+            // stops and the exception is propagated once workers are done.
+            void solveBatch(Solver& solver, std::size_t count, const GridSource& source, const Consumer& consumer);
+            // Same as above, for a range of grids which must stay valid until solving is done.
+            template<typename RandomIt>
+            void solveBatch(Solver& solver, RandomIt first, RandomIt last, const Consumer& consumer)
+            {
+                solveBatch(solver, (std::size_t) (last - first), [first](std::size_t i) { return Grid(*(first + i)); }, consumer);
+            }
+            // Same as above, every worker making its own solver with the factory.
+            void solveBatch(const SolverFactory& factory, std::size_t count, const GridSource& source, const Consumer& consumer);
+            // Solve every grid of a vector and return results in grid order, whatever the batch order is.
+            std::vector<Result> solveBatch(Solver& solver, const std::vector<Grid>& grids);
+
+            std::size_t getThreadCount() const;
+            bool isOrdered() const;
+
+        private:    // Private methods
+            // Run the workers, each of them getting its solver from the function given, called with the worker index.
+            void run(const std::function<std::shared_ptr<Solver>(std::size_t)>& workerSolver, std::size_t count, const GridSource& source, const Consumer& consumer);
+    };
+}
+
+#endif//SOLVING__BATCH_SOLVER_HPP
\ No newline at end of file
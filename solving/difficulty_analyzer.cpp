@@ -0,0 +1,100 @@
+#include "difficulty_analyzer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include "solver.hpp"
+#include "backtracking_solver.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        // Puzzles line deductions solve always score below those needing guesses.
+        const double LINE_SCORE_MAX = 49;
+        const double ROUND_WEIGHT = 1;
+        const double REVISIT_WEIGHT = 4;
+
+        const double SEARCH_SCORE_MIN = 50;
+        const double SEARCH_SCORE_MAX = 100;
+        const double GUESS_WEIGHT = 10;
+        const double DEPTH_WEIGHT = 5;
+
+        // Upper score bounds of the categories below Expert.
+        const double EASY_SCORE = 10;
+        const double MEDIUM_SCORE = 25;
+
+        std::int64_t statValue(const Solver::Stats& stats, const std::string& name)
+        {
+            for (const auto& stat : stats)
+            {
+                if (stat.first == name) return stat.second;
+            }
+            return 0;
+        }
+    }
+
+    DifficultyAnalyzer::DifficultyAnalyzer() :
+        _solver()
+    {
+
+    }
+
+    DifficultyAnalyzer::Report DifficultyAnalyzer::analyze(const Grid& grid)
+    {
+        Grid puzzle = Grid(grid.getWidth(), grid.getHeight(), grid.getAllRowHints(), grid.getAllColHints());
+        _solver.solve(puzzle);
+        return assess(grid.getWidth(), grid.getHeight(), _solver.stats());
+    }
+
+    DifficultyAnalyzer::Report DifficultyAnalyzer::assess(int width, int height, const Solver::Stats& stats)
+    {
+        Report report;
+        report.lines = statValue(stats, "lines");
+        report.rounds = statValue(stats, "rounds");
+        report.guesses = statValue(stats, "guesses");
+        report.backtracks = statValue(stats, "backtracks");
+        report.depth = statValue(stats, "depth");
+        report.lineSolvable = report.guesses == 0;
+
+        if (report.lineSolvable)
+        {
+            // Every line is solved at least once, count how many more times lines were solved on average.
+            int lineTotal = width + height;
+            double revisits = lineTotal > 0 ? std::max(0.0, (double) report.lines / lineTotal - 1) : 0;
+            double chain = std::max<std::int64_t>(0, report.rounds - 1);
+            report.score = std::min(LINE_SCORE_MAX, ROUND_WEIGHT * chain + REVISIT_WEIGHT * revisits);
+        }
+        else
+        {
+            double search = GUESS_WEIGHT * std::log2(1 + (double) report.guesses) + DEPTH_WEIGHT * (double) (report.depth - 1);
+            report.score = std::min(SEARCH_SCORE_MAX, SEARCH_SCORE_MIN + search);
+        }
+
+        report.category = categorize(report.score);
+        return report;
+    }
+
+    DifficultyAnalyzer::Category DifficultyAnalyzer::categorize(double score)
+    {
+        if (score < EASY_SCORE) return Category::Easy;
+        if (score < MEDIUM_SCORE) return Category::Medium;
+        if (score < SEARCH_SCORE_MIN) return Category::Hard;
+        return Category::Expert;
+    }
+
+    std::string DifficultyAnalyzer::categoryName(Category category)
+    {
+        switch (category)
+        {
+            case Category::Easy:    return "easy";
+            case Category::Medium:  return "medium";
+            case Category::Hard:    return "hard";
+            case Category::Expert:  return "expert";
+        }
+        return "unknown";
+    }
+}
\ No newline at end of file
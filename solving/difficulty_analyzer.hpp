@@ -0,0 +1,62 @@
+#ifndef SOLVING__DIFFICULTY_ANALYZER_HPP
+#define SOLVING__DIFFICULTY_ANALYZER_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "solver.hpp"
+#include "backtracking_solver.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Rates how hard a puzzle is from the way the backtracking solver gets through it, rather than from
+    // how long it takes, so that ratings do not depend on the machine nor on its load. Puzzles which line
+    // deductions alone solve score below 50: the longer the chain of deductions (propagation rounds) and
+    // the more often lines must be looked at again, the higher. Puzzles which need guesses score 50 and
+    // above, growing with the number of guesses and how deeply they nest.
+    //
+    // Ratings can be made from the stats of a solve already done, such as those of a batch solve, so
+    // that rating an archive costs no more than solving it once.
+    class DifficultyAnalyzer
+    {
+        public:     // Types
+            enum class Category
+            {
+                Easy,           // Short chains of deductions.
+                Medium,
+                Hard,           // Long chains of deductions, lines revisited many times.
+                Expert          // Line deductions are not enough, guesses are needed.
+            };
+
+            struct Report
+            {
+                bool lineSolvable;          // Whether line deductions alone solve the puzzle.
+                std::int64_t lines;         // Lines solved, guesses included.
+                std::int64_t rounds;        // Propagation rounds, guesses included.
+                std::int64_t guesses;
+                std::int64_t backtracks;
+                std::int64_t depth;         // Deepest nesting of guesses.
+                double score;               // From 0 to 100.
+                Category category;
+            };
+
+        private:    // Attributes
+            BacktrackingSolver _solver;
+
+        public:     // Public methods
+            DifficultyAnalyzer();
+
+            // Solve the puzzle from its hints alone and rate it. Throws UnsolvableGridError if the hints
+            // cannot be satisfied.
+            Report analyze(const Grid& grid);
+
+            // Rate a puzzle of the given dimensions from the stats the backtracking solver gave after
+            // solving it from its hints alone.
+            static Report assess(int width, int height, const Solver::Stats& stats);
+            static Category categorize(double score);
+            static std::string categoryName(Category category);
+    };
+}
+
+#endif//SOLVING__DIFFICULTY_ANALYZER_HPP
\ No newline at end of file
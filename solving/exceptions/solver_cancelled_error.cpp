@@ -0,0 +1,7 @@
+#include "solver_cancelled_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(SolverCancelledError)
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "solver_registry_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(SolverRegistryError)
+}
\ No newline at end of file
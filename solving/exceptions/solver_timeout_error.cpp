@@ -0,0 +1,7 @@
+#include "solver_timeout_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(SolverTimeoutError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef SOLVING__EXCEPTIONS__SOLVER_TIMEOUT_ERROR_HPP
+#define SOLVING__EXCEPTIONS__SOLVER_TIMEOUT_ERROR_HPP
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(SolverTimeoutError)
+}
+
+#endif//SOLVING__EXCEPTIONS__SOLVER_TIMEOUT_ERROR_HPP
\ No newline at end of file
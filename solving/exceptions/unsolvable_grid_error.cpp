@@ -0,0 +1,7 @@
+#include "unsolvable_grid_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(UnsolvableGridError)
+}
\ No newline at end of file
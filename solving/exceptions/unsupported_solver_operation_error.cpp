@@ -0,0 +1,7 @@
+#include "unsupported_solver_operation_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DEFINE_BASIC_EXCEPTION(UnsupportedSolverOperationError)
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef SOLVING__EXCEPTIONS__UNSUPPORTED_SOLVER_OPERATION_ERROR_HPP
+#define SOLVING__EXCEPTIONS__UNSUPPORTED_SOLVER_OPERATION_ERROR_HPP
+
+#include "../../tools/make_basic_exception.hpp"
+
+namespace Picross
+{
+    DECLARE_BASIC_EXCEPTION(UnsupportedSolverOperationError)
+}
+
+#endif//SOLVING__EXCEPTIONS__UNSUPPORTED_SOLVER_OPERATION_ERROR_HPP
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "grid_generator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "line_solver.hpp"
+#include "backtracking_solver.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+#include "../tools/parallel_tools.hpp"
+#include "../tools/thread_pool.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        struct GeneratedGrid
+        {
+            std::size_t index;
+            Grid grid = Grid(0, 0);
+        };
+
+        // What a worker keeps from one puzzle to the next.
+        struct GeneratorWorker
+        {
+            LineSolver lineSolver;
+            BacktrackingSolver backtrackingSolver;
+            GridGenerator::Stats stats = {0, 0, 0, 0, 0, std::chrono::nanoseconds(0)};
+        };
+
+        // Random engine of the puzzle of a given index.
+        std::mt19937_64 makeEngine(std::uint64_t seed, std::size_t index)
+        {
+            std::seed_seq sequence = {
+                (std::uint32_t) seed, (std::uint32_t) (seed >> 32),
+                (std::uint32_t) index, (std::uint32_t) ((std::uint64_t) index >> 32)
+            };
+            return std::mt19937_64(sequence);
+        }
+
+        void addStats(GridGenerator::Stats& total, const GridGenerator::Stats& stats)
+        {
+            total.generated += stats.generated;
+            total.candidates += stats.candidates;
+            total.repairs += stats.repairs;
+            total.exhaustiveChecks += stats.exhaustiveChecks;
+            total.rejected += stats.rejected;
+        }
+    }
+
+    double GridGenerator::Stats::puzzlesPerSecond() const
+    {
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        return seconds > 0 ? generated / seconds : 0;
+    }
+
+    GridGenerator::GridGenerator(Options options, std::size_t threadCount) :
+        _options(options),
+        _threadCount(threadCount > 0 ? threadCount : ThreadPool::defaultThreadCount())
+    {
+        if (options.width < 1 || options.height < 1 || !(options.density >= 0 && options.density <= 1) || options.maxRepairs < 0)
+        {
+            throw std::invalid_argument("Cannot generate " + std::to_string(options.width) + "x" + std::to_string(options.height)
+                                      + " grids with a density of " + std::to_string(options.density) + ".");
+        }
+    }
+
+    GridGenerator::Stats GridGenerator::generate(std::size_t count, const Consumer& consumer)
+    {
+        Stats total = {0, 0, 0, 0, 0, std::chrono::nanoseconds(0)};
+        auto start = std::chrono::steady_clock::now();
+        if (count == 0) return total;
+
+        // Each worker keeps its own solvers and statistics.
+        std::vector<GeneratorWorker> workers = std::vector<GeneratorWorker>(std::min(_threadCount, count));
+        auto generatePuzzle = [&](std::size_t t, std::size_t i)
+        {
+            GeneratorWorker& worker = workers[t];
+            return GeneratedGrid{i, generateWith(i, worker.lineSolver, worker.backtrackingSolver, worker.stats)};
+        };
+
+        ParallelTools::produceAndConsume<GeneratedGrid>(count, _threadCount, 64, generatePuzzle, [&consumer](GeneratedGrid&& generated)
+        {
+            consumer(generated.index, std::move(generated.grid));
+        });
+
+        for (const GeneratorWorker& worker : workers)
+        {
+            addStats(total, worker.stats);
+        }
+
+        total.elapsed = std::chrono::steady_clock::now() - start;
+        return total;
+    }
+
+    std::vector<Grid> GridGenerator::generate(std::size_t count)
+    {
+        std::vector<Grid> grids = std::vector<Grid>(count, Grid(0, 0));
+        generate(count, [&grids](std::size_t index, Grid&& grid)
+        {
+            grids[index] = std::move(grid);
+        });
+        return grids;
+    }
+
+    Grid GridGenerator::generateOne(std::size_t index)
+    {
+        LineSolver lineSolver = LineSolver();
+        BacktrackingSolver backtrackingSolver = BacktrackingSolver();
+        Stats stats = {0, 0, 0, 0, 0, std::chrono::nanoseconds(0)};
+        return generateWith(index, lineSolver, backtrackingSolver, stats);
+    }
+
+    const GridGenerator::Options& GridGenerator::getOptions() const
+    {
+        return _options;
+    }
+
+    Grid GridGenerator::generateWith(std::size_t index, LineSolver& lineSolver, BacktrackingSolver& backtrackingSolver, Stats& stats) const
+    {
+        int width = _options.width;
+        int height = _options.height;
+        std::mt19937_64 engine = makeEngine(_options.seed, index);
+        std::bernoulli_distribution checked = std::bernoulli_distribution(_options.density);
+        std::vector<int> undetermined;
+
+        while (true)
+        {
+            stats.candidates++;
+            Grid candidate = Grid(width, height);
+            for (int i = 0; i < height; i++)
+            {
+                for (int j = 0; j < width; j++)
+                {
+                    if (checked(engine)) candidate.setCell(i, j, CELL_CHECKED);
+                }
+            }
+
+            for (int repair = 0; ; repair++)
+            {
+                candidate.setHintsFromState();
+                Grid puzzle = Grid(width, height, candidate.getAllRowHints(), candidate.getAllColHints());
+                lineSolver.solve(puzzle);
+
+                // Line deductions are sound: if they determine every cell, there is no other solution.
+                if (puzzle.getCellCount(CELL_CLEARED) == 0)
+                {
+                    stats.generated++;
+                    return candidate;
+                }
+
+                if (repair == _options.maxRepairs)
+                {
+                    stats.exhaustiveChecks++;
+                    if (backtrackingSolver.countSolutions(puzzle, 2) == 1)
+                    {
+                        stats.generated++;
+                        return candidate;
+                    }
+
+                    stats.rejected++;
+                    break;
+                }
+
+                // Flip one of the cells line deductions could not tell, at random.
+                undetermined.clear();
+                for (int i = 0; i < height; i++)
+                {
+                    for (int j = 0; j < width; j++)
+                    {
+                        if (puzzle.getCell(i, j) == CELL_CLEARED) undetermined.push_back(i * width + j);
+                    }
+                }
+
+                int cell = undetermined[std::uniform_int_distribution<std::size_t>(0, undetermined.size() - 1)(engine)];
+                int row = cell / width;
+                int col = cell % width;
+                candidate.setCell(row, col, candidate.getCell(row, col) == CELL_CHECKED ? CELL_CLEARED : CELL_CHECKED);
+                stats.repairs++;
+            }
+        }
+    }
+}
\ No newline at end of file
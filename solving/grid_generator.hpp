@@ -0,0 +1,78 @@
+#ifndef SOLVING__GRID_GENERATOR_HPP
+#define SOLVING__GRID_GENERATOR_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "line_solver.hpp"
+#include "backtracking_solver.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Generates random puzzles which have exactly one solution. Cells of a candidate grid are checked
+    // at random, and its hints derived from them. Uniqueness is checked with the line solver first,
+    // since a grid solved by line deductions alone has a single solution. While some cells remain
+    // undetermined, one of them is flipped in the candidate and hints are derived again, which most
+    // often removes the ambiguity. Once repairs run out, solutions are counted with the backtracking
+    // solver, and the candidate is rejected if there is more than one.
+    //
+    // Puzzles are generated on several threads. The puzzle of a given index only depends on the seed,
+    // so that the same corpus is generated whatever the thread count.
+    class GridGenerator
+    {
+        public:     // Types
+            struct Options
+            {
+                int width;
+                int height;
+                double density = 0.55;      // Probability for a cell to be checked.
+                int maxRepairs = 100;       // Cells flipped in a candidate before it is checked exhaustively.
+                std::uint64_t seed = 0;
+            };
+
+            struct Stats
+            {
+                std::size_t generated;
+                std::size_t candidates;                 // Random grids drawn, including rejected ones.
+                std::size_t repairs;                    // Cells flipped to remove ambiguities.
+                std::size_t exhaustiveChecks;           // Candidates whose solutions had to be counted.
+                std::size_t rejected;
+                std::chrono::nanoseconds elapsed;
+
+                // Generation throughput, in valid puzzles per second.
+                double puzzlesPerSecond() const;
+            };
+
+            // Receives generated puzzles on the calling thread, in completion order.
+            using Consumer = std::function<void(std::size_t index, Grid&& grid)>;
+
+        private:    // Attributes
+            Options _options;
+            std::size_t _threadCount;
+
+        public:     // Public methods
+            // A thread count of 0 uses one thread per hardware thread. Throws std::invalid_argument if
+            // dimensions are not positive, or if the density is not between 0 and 1.
+            GridGenerator(Options options, std::size_t threadCount = 0);
+
+            // Generate puzzles of the given indices, from 0 to count - 1. Grids come with their hints and
+            // their solution (checked cells, others cleared).
+            Stats generate(std::size_t count, const Consumer& consumer);
+            // Generate puzzles and return them in index order.
+            std::vector<Grid> generate(std::size_t count);
+            // Generate the puzzle of a given index on the calling thread.
+            Grid generateOne(std::size_t index);
+
+            const Options& getOptions() const;
+
+        private:    // Private methods
+            // Draw candidates until one has a single solution, counting attempts into the stats.
+            Grid generateWith(std::size_t index, LineSolver& lineSolver, BacktrackingSolver& backtrackingSolver, Stats& stats) const;
+    };
+}
+
+#endif//SOLVING__GRID_GENERATOR_HPP
\ No newline at end of file
@@ -0,0 +1,388 @@
+#include "line_propagator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        // Number of lines solved between two calls to the checkpoint.
+        const std::int64_t CHECKPOINT_INTERVAL = 64;
+
+        // Copy hints without their zero entries, reusing the memory of the destination.
+        void copyNonZeroHints(const std::vector<int>& hints, std::vector<int>& destination)
+        {
+            destination.clear();
+            for (int hint : hints)
+            {
+                if (hint > 0) destination.push_back(hint);
+            }
+        }
+    }
+
+    LinePropagator::LinePropagator() :
+        _width(0),
+        _height(0),
+        _hints(),
+        _cells(),
+        _unknownCount(0),
+        _trail(),
+        _queue(),
+        _queued(),
+        _queueHead(0),
+        _queueSize(0),
+        _lineCount(0),
+        _roundCount(0),
+        _roundRemaining(0)
+    {
+
+    }
+
+    void LinePropagator::reset(const Grid& grid)
+    {
+        _width = grid.getWidth();
+        _height = grid.getHeight();
+
+        // Buffers only grow, so that solving grids of similar sizes one after the other does not allocate.
+        _hints.resize(_height + _width);
+        for (int i = 0; i < _height; i++)
+        {
+            copyNonZeroHints(grid.getRowHints(i), _hints[i]);
+        }
+        for (int j = 0; j < _width; j++)
+        {
+            copyNonZeroHints(grid.getColHints(j), _hints[_height + j]);
+        }
+
+        _cells.resize(_width * _height);
+        for (int i = 0; i < _height; i++)
+        {
+            for (int j = 0; j < _width; j++)
+            {
+                _cells[i * _width + j] = grid.getCell(i, j);
+            }
+        }
+        _unknownCount = (int) std::count(_cells.begin(), _cells.end(), CELL_CLEARED);
+
+        _trail.clear();
+        _lineCount = 0;
+        _roundCount = 0;
+        _roundRemaining = 0;
+
+        int lineTotal = _width + _height;
+        _queue.assign(lineTotal, 0);
+        _queued.assign(lineTotal, 0);
+        _queueHead = 0;
+        _queueSize = 0;
+        for (int line = 0; line < lineTotal; line++)
+        {
+            queueLine(line);
+        }
+    }
+
+    bool LinePropagator::propagate(const std::function<void()>& checkpoint)
+    {
+        while (_queueSize > 0)
+        {
+            if (_roundRemaining == 0)
+            {
+                _roundCount++;
+                _roundRemaining = _queueSize;
+            }
+            _roundRemaining--;
+            int line = popLine();
+
+            if (checkpoint && (_lineCount % CHECKPOINT_INTERVAL) == 0)
+            {
+                checkpoint();
+            }
+            _lineCount++;
+
+            int stride;
+            int start = loadLine(line, stride);
+            int length = (int) _line.size();
+            bool isRow = line < _height;
+
+            if (!solveLine(_hints[line]))
+            {
+                while (_queueSize > 0)
+                {
+                    popLine();
+                }
+                _roundRemaining = 0;
+                return false;
+            }
+
+            for (int k = 0; k < length; k++)
+            {
+                int index = start + k * stride;
+                if (_line[k] == _cells[index]) continue;
+
+                _trail.push_back({index, _cells[index]});
+                _cells[index] = _line[k];
+                _unknownCount--;
+                queueLine(isRow ? _height + k : k);
+            }
+        }
+
+        return true;
+    }
+
+    bool LinePropagator::findDeduction(LineDeduction& deduction)
+    {
+        deduction.line = -1;
+        while (_queueSize > 0)
+        {
+            int line = popLine();
+            int stride;
+            int start = loadLine(line, stride);
+            _lineCount++;
+
+            bool satisfiable = solveLine(_hints[line]);
+            bool changed = false;
+            for (std::size_t k = 0; satisfiable && !changed && k < _line.size(); k++)
+            {
+                changed = _line[k] != _cells[start + k * stride];
+            }
+
+            if (satisfiable && !changed) continue;
+
+            requeueLine(line);
+            deduction.line = line;
+            deduction.cells = _line;
+            deduction.firstStarts = _firstStarts;
+            deduction.lastStarts = _lastStarts;
+            return satisfiable;
+        }
+
+        return true;
+    }
+
+    void LinePropagator::setCell(int index, cell_t value)
+    {
+        cell_t previous = _cells[index];
+        if (previous == value) return;
+
+        _trail.push_back({index, previous});
+        _cells[index] = value;
+        if (previous == CELL_CLEARED) _unknownCount--;
+        if (value == CELL_CLEARED) _unknownCount++;
+
+        queueLine(index / _width);
+        queueLine(_height + index % _width);
+    }
+
+    void LinePropagator::undo(std::size_t trailSize)
+    {
+        while (_trail.size() > trailSize)
+        {
+            TrailEntry entry = _trail.back();
+            _trail.pop_back();
+
+            if (_cells[entry.index] == CELL_CLEARED) _unknownCount--;
+            if (entry.previous == CELL_CLEARED) _unknownCount++;
+            _cells[entry.index] = entry.previous;
+        }
+    }
+
+    std::size_t LinePropagator::trailSize() const
+    {
+        return _trail.size();
+    }
+
+    void LinePropagator::clearTrail()
+    {
+        _trail.clear();
+    }
+
+    int LinePropagator::firstUnknownCell() const
+    {
+        auto it = std::find(_cells.begin(), _cells.end(), CELL_CLEARED);
+        return it == _cells.end() ? -1 : (int) (it - _cells.begin());
+    }
+
+    int LinePropagator::unknownCount() const
+    {
+        return _unknownCount;
+    }
+
+    cell_t LinePropagator::getCell(int index) const
+    {
+        return _cells[index];
+    }
+
+    const std::vector<int>& LinePropagator::getLineHints(int line) const
+    {
+        return _hints[line];
+    }
+
+    std::int64_t LinePropagator::lineCount() const
+    {
+        return _lineCount;
+    }
+
+    std::int64_t LinePropagator::roundCount() const
+    {
+        return _roundCount;
+    }
+
+    void LinePropagator::copyCellsTo(Grid& grid) const
+    {
+        std::vector<cell_t> row;
+        for (int i = 0; i < _height; i++)
+        {
+            row.assign(_cells.begin() + i * _width, _cells.begin() + (i + 1) * _width);
+            grid.setRow(i, row);
+        }
+    }
+
+    void LinePropagator::queueLine(int line)
+    {
+        if (_queued[line]) return;
+
+        _queued[line] = 1;
+        _queue[(_queueHead + _queueSize) % _queue.size()] = line;
+        _queueSize++;
+    }
+
+    int LinePropagator::popLine()
+    {
+        int line = _queue[_queueHead];
+        _queueHead = (_queueHead + 1) % _queue.size();
+        _queueSize--;
+        _queued[line] = 0;
+        return line;
+    }
+
+    void LinePropagator::requeueLine(int line)
+    {
+        if (_queued[line]) return;
+
+        _queued[line] = 1;
+        _queueHead = (_queueHead + _queue.size() - 1) % _queue.size();
+        _queue[_queueHead] = line;
+        _queueSize++;
+    }
+
+    int LinePropagator::loadLine(int line, int& stride)
+    {
+        // Rows are laid out contiguously, columns are strided.
+        bool isRow = line < _height;
+        int length = isRow ? _width : _height;
+        int start = isRow ? line * _width : line - _height;
+        stride = isRow ? 1 : _width;
+
+        _line.resize(length);
+        for (int k = 0; k < length; k++)
+        {
+            _line[k] = _cells[start + k * stride];
+        }
+
+        return start;
+    }
+
+    bool LinePropagator::solveLine(const std::vector<int>& hints)
+    {
+        int n = (int) _line.size();
+        int k = (int) hints.size();
+        int stride = k + 1;
+
+        // Number of crossed cells before each position, to tell in constant time whether a block fits.
+        _crossedPrefix.resize(n + 1);
+        _crossedPrefix[0] = 0;
+        for (int i = 0; i < n; i++)
+        {
+            _crossedPrefix[i + 1] = _crossedPrefix[i] + (_line[i] == CELL_CROSSED);
+        }
+
+        // A block of the given length can start at i if no cell it covers is crossed, and if the cell
+        // following it, if any, can be empty.
+        auto blockFits = [&](int i, int length)
+        {
+            int end = i + length;
+            if (end > n || _crossedPrefix[end] != _crossedPrefix[i]) return false;
+            return end == n || _line[end] != CELL_CHECKED;
+        };
+        // Position following a block starting at i and the empty cell after it.
+        auto afterBlock = [&](int i, int length)
+        {
+            return std::min(i + length + 1, n);
+        };
+
+        // _forward[i][j]: the first i cells can hold the first j blocks, position i starting free.
+        _forward.assign((n + 1) * stride, 0);
+        _forward[0] = 1;
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = 0; j <= k; j++)
+            {
+                if (!_forward[i * stride + j]) continue;
+
+                if (_line[i] != CELL_CHECKED) _forward[(i + 1) * stride + j] = 1;
+                if (j < k && blockFits(i, hints[j])) _forward[afterBlock(i, hints[j]) * stride + j + 1] = 1;
+            }
+        }
+
+        if (!_forward[n * stride + k]) return false;
+
+        // _backward[i][j]: cells from i onwards can hold blocks from j onwards, position i starting free.
+        _backward.assign((n + 1) * stride, 0);
+        _backward[n * stride + k] = 1;
+        for (int i = n - 1; i >= 0; i--)
+        {
+            for (int j = k; j >= 0; j--)
+            {
+                bool empty = _line[i] != CELL_CHECKED && _backward[(i + 1) * stride + j];
+                bool block = j < k && blockFits(i, hints[j]) && _backward[afterBlock(i, hints[j]) * stride + j + 1];
+                _backward[i * stride + j] = empty || block;
+            }
+        }
+
+        // Go through every placement of every block which both halves agree on.
+        _fillCoverage.assign(n + 1, 0);
+        _canBeEmpty.assign(n, 0);
+        _firstStarts.assign(k, n);
+        _lastStarts.assign(k, -1);
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = 0; j <= k; j++)
+            {
+                if (!_forward[i * stride + j]) continue;
+
+                if (_line[i] != CELL_CHECKED && _backward[(i + 1) * stride + j])
+                {
+                    _canBeEmpty[i] = 1;
+                }
+
+                if (j < k && blockFits(i, hints[j]) && _backward[afterBlock(i, hints[j]) * stride + j + 1])
+                {
+                    int end = i + hints[j];
+                    _firstStarts[j] = std::min(_firstStarts[j], i);
+                    _lastStarts[j] = i;
+                    _fillCoverage[i]++;
+                    _fillCoverage[end]--;
+                    if (end < n) _canBeEmpty[end] = 1;
+                }
+            }
+        }
+
+        int coverage = 0;
+        for (int i = 0; i < n; i++)
+        {
+            coverage += _fillCoverage[i];
+            bool canBeFilled = coverage > 0;
+
+            if (canBeFilled && !_canBeEmpty[i]) _line[i] = CELL_CHECKED;
+            else if (!canBeFilled && _canBeEmpty[i]) _line[i] = CELL_CROSSED;
+        }
+
+        return true;
+    }
+}
\ No newline at end of file
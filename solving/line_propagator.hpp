@@ -0,0 +1,122 @@
+#ifndef SOLVING__LINE_PROPAGATOR_HPP
+#define SOLVING__LINE_PROPAGATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Working copy of a grid on which line deductions are run until no line can make progress.
+    // Each line is solved exactly: a dynamic programming pass over the line tells, for every cell,
+    // whether some placement of the hints consistent with the known cells checks it, and whether
+    // some placement leaves it empty. Cells which only one kind of placement allows are set.
+    // Cleared cells stand for unknown cells, crossed cells for known empty cells.
+    //
+    // Every cell change is recorded on a trail so that changes can be undone past a given point,
+    // which lets searching solvers take guesses back. Buffers are kept across lines and grids.
+    class LinePropagator
+    {
+        public:     // Types
+            // What solving a line tells, before any of its cells is set.
+            struct LineDeduction
+            {
+                int line;                           // Rows first, then columns, -1 if no line can set cells.
+                std::vector<cell_t> cells;          // Cells of the line once solved.
+                std::vector<int> firstStarts;       // First position each block can start at.
+                std::vector<int> lastStarts;        // Last position each block can start at.
+            };
+
+        private:    // Types
+            // A cell changed since the trail started, with the value it had before.
+            struct TrailEntry
+            {
+                int index;
+                cell_t previous;
+            };
+
+        private:    // Attributes
+            int _width;
+            int _height;
+            // Hints of every row, then every column, without zero entries.
+            std::vector<std::vector<int>> _hints;
+            std::vector<cell_t> _cells;
+            int _unknownCount;
+            std::vector<TrailEntry> _trail;
+            // Lines waiting to be solved (rows first, then columns), as a ring buffer.
+            std::vector<int> _queue;
+            std::vector<char> _queued;
+            std::size_t _queueHead;
+            std::size_t _queueSize;
+            std::int64_t _lineCount;
+            // Rounds of propagation: lines queued while a round runs are solved in the next one.
+            std::int64_t _roundCount;
+            std::size_t _roundRemaining;
+
+            // Line solving buffers.
+            std::vector<cell_t> _line;
+            std::vector<int> _crossedPrefix;
+            std::vector<char> _forward;
+            std::vector<char> _backward;
+            std::vector<int> _fillCoverage;
+            std::vector<char> _canBeEmpty;
+            std::vector<int> _firstStarts;
+            std::vector<int> _lastStarts;
+
+        public:     // Public methods
+            LinePropagator();
+
+            // Take the hints and cells of a grid, queue every line and clear the trail.
+            void reset(const Grid& grid);
+            // Solve queued lines until none is left, queueing crossing lines whenever cells change.
+            // Returns false if a line cannot be satisfied, in which case the queue is emptied. The
+            // checkpoint, if any, is called every few lines and may throw to abort.
+            bool propagate(const std::function<void()>& checkpoint = nullptr);
+            // Solve queued lines until one of them can set cells, and describe it without setting any cell.
+            // The line is put back at the front of the queue, so that it comes first again as long as cells
+            // do not change. Returns false if a line cannot be satisfied, in which case the deduction holds
+            // that line, also put back at the front of the queue.
+            bool findDeduction(LineDeduction& deduction);
+
+            // Set a cell, recording its previous value on the trail, and queue its row and column.
+            void setCell(int index, cell_t value);
+            // Undo every change recorded past the given trail size.
+            void undo(std::size_t trailSize);
+            std::size_t trailSize() const;
+            // Forget the changes recorded on the trail, which can then no longer be undone.
+            void clearTrail();
+
+            // Index of the first unknown cell in row-major order, -1 if every cell is known.
+            int firstUnknownCell() const;
+            int unknownCount() const;
+            cell_t getCell(int index) const;
+            // Hints of a line (rows first, then columns), without zero entries.
+            const std::vector<int>& getLineHints(int line) const;
+            // Number of lines solved since the last reset.
+            std::int64_t lineCount() const;
+            // Number of propagation rounds run since the last reset, which is the length of the longest
+            // chain of line deductions each depending on the previous one.
+            std::int64_t roundCount() const;
+
+            // Copy the cells into a grid of the same dimensions.
+            void copyCellsTo(Grid& grid) const;
+
+        private:    // Private methods
+            void queueLine(int line);
+            // Take the line at the front of the queue out of it.
+            int popLine();
+            // Put a line back at the front of the queue.
+            void requeueLine(int line);
+            // Copy the cells of a line into _line. Returns the index of its first cell, and the stride between cells.
+            int loadLine(int line, int& stride);
+            // Solve one line in place in _line, keeping the first and last start of each block. Returns
+            // false if the hints cannot be placed.
+            bool solveLine(const std::vector<int>& hints);
+    };
+}
+
+#endif//SOLVING__LINE_PROPAGATOR_HPP
\ No newline at end of file
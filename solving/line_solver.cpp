@@ -0,0 +1,57 @@
+#include "line_solver.hpp"
+
+#include <memory>
+#include <string>
+
+#include "solver.hpp"
+#include "line_propagator.hpp"
+#include "exceptions/unsolvable_grid_error.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    LineSolver::LineSolver() :
+        Solver(),
+        _propagator()
+    {
+
+    }
+
+    LineSolver::~LineSolver()
+    {
+
+    }
+
+    std::string LineSolver::name()
+    {
+        return "Line solver";
+    }
+
+    std::shared_ptr<Solver> LineSolver::clone()
+    {
+        std::shared_ptr<Solver> solver = std::make_shared<LineSolver>();
+        copySettingsTo(*solver);
+        return solver;
+    }
+
+    void LineSolver::solve(Grid& grid)
+    {
+        startTimer();
+        _propagator.reset(grid);
+
+        if (!_propagator.propagate([this] () { checkInterruption(); }))
+        {
+            throw UnsolvableGridError("No cell layout satisfies the hints of the grid.");
+        }
+
+        _propagator.copyCellsTo(grid);
+    }
+
+    Solver::Stats LineSolver::stats()
+    {
+        return {
+            {"lines", _propagator.lineCount()},
+            {"rounds", _propagator.roundCount()}
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef SOLVING__LINE_SOLVER_HPP
+#define SOLVING__LINE_SOLVER_HPP
+
+#include <memory>
+#include <string>
+
+#include "solver.hpp"
+#include "line_propagator.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Solves grids by line deductions only, as a human would without guessing. Grids which need
+    // guesses are left partially solved.
+    class LineSolver : public Solver
+    {
+        private:    // Attributes
+            LinePropagator _propagator;
+
+        public:     // Public methods
+            LineSolver();
+            virtual ~LineSolver();
+
+            virtual std::string name();
+            virtual std::shared_ptr<Solver> clone();
+            virtual void solve(Grid& grid);
+            virtual Stats stats();
+    };
+}
+
+#endif//SOLVING__LINE_SOLVER_HPP
\ No newline at end of file
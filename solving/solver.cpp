@@ -1,9 +1,76 @@
 #include "solver.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "exceptions/solver_cancelled_error.hpp"
+#include "exceptions/solver_timeout_error.hpp"
+#include "exceptions/unsupported_solver_operation_error.hpp"
+
 namespace Picross
 {
+    Solver::Solver() :
+        _timeout(0),
+        _deadline(),
+        _cancelFlag()
+    {
+
+    }
+
     Solver::~Solver()
     {
         
     }
+
+    std::size_t Solver::countSolutions(const Grid&, std::size_t)
+    {
+        throw UnsupportedSolverOperationError(name() + " cannot count solutions.");
+    }
+
+    Solver::Stats Solver::stats()
+    {
+        return {};
+    }
+
+    void Solver::setTimeout(std::chrono::milliseconds timeout)
+    {
+        _timeout = timeout;
+    }
+
+    std::chrono::milliseconds Solver::getTimeout() const
+    {
+        return _timeout;
+    }
+
+    void Solver::setCancelFlag(std::shared_ptr<const std::atomic<bool>> flag)
+    {
+        _cancelFlag = flag;
+    }
+
+    void Solver::startTimer()
+    {
+        _deadline = std::chrono::steady_clock::now() + _timeout;
+    }
+
+    void Solver::checkInterruption() const
+    {
+        if (_cancelFlag && _cancelFlag->load(std::memory_order_relaxed))
+        {
+            throw SolverCancelledError("Solving was cancelled.");
+        }
+
+        if (_timeout.count() > 0 && std::chrono::steady_clock::now() > _deadline)
+        {
+            throw SolverTimeoutError("Solving took longer than " + std::to_string(_timeout.count()) + " ms.");
+        }
+    }
+
+    void Solver::copySettingsTo(Solver& other) const
+    {
+        other._timeout = _timeout;
+        other._cancelFlag = _cancelFlag;
+    }
 }
\ No newline at end of file
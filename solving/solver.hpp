@@ -1,7 +1,14 @@
 #ifndef SOLVING__SOLVER_HPP
 #define SOLVING__SOLVER_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../core/grid.hpp"
 
@@ -9,10 +16,47 @@ namespace Picross
 {
     class Solver
     {
+        public:     // Types
+            // Named counters describing a solve.
+            using Stats = std::vector<std::pair<std::string, std::int64_t>>;
+
+        private:    // Attributes
+            std::chrono::milliseconds _timeout;
+            std::chrono::steady_clock::time_point _deadline;
+            std::shared_ptr<const std::atomic<bool>> _cancelFlag;
+
         public:
+            Solver();
             virtual ~Solver();
             virtual std::string name() = 0;
+            // New solver of the same kind and with the same settings, but with its own working memory,
+            // so that it can be used on another thread.
+            virtual std::shared_ptr<Solver> clone() = 0;
+            // Solve the grid in place, starting from the cells already checked or crossed. Cells which
+            // could not be determined are left cleared. Throws UnsolvableGridError if the hints and cells
+            // cannot be satisfied, SolverTimeoutError if the timeout is exceeded, SolverCancelledError if
+            // the cancel flag is raised.
             virtual void solve(Grid& grid) = 0;
+            // Count the solutions of a grid, stopping at the limit. Only solvers registered as able to
+            // count implement it, others throw UnsupportedSolverOperationError.
+            virtual std::size_t countSolutions(const Grid& grid, std::size_t limit);
+            // Counters describing the last call to solve.
+            virtual Stats stats();
+
+            // A timeout of 0 lets solving run for as long as it takes.
+            void setTimeout(std::chrono::milliseconds timeout);
+            std::chrono::milliseconds getTimeout() const;
+            // Flag which stops solving once raised, from any thread. Clones share the flag, so that
+            // raising it stops every clone.
+            void setCancelFlag(std::shared_ptr<const std::atomic<bool>> flag);
+
+        protected:
+            // Start counting time against the timeout, to be called when solving starts.
+            void startTimer();
+            // Throw SolverTimeoutError if the timeout is exceeded, SolverCancelledError if the cancel flag is raised.
+            void checkInterruption() const;
+            // Give a clone the timeout and cancel flag of this solver.
+            void copySettingsTo(Solver& other) const;
     };
 }
 
@@ -0,0 +1,92 @@
+#include "solver_registry.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "solver.hpp"
+#include "line_solver.hpp"
+#include "backtracking_solver.hpp"
+#include "exceptions/solver_registry_error.hpp"
+
+namespace Picross
+{
+    namespace
+    {
+        SolverRegistry makeBuiltinRegistry()
+        {
+            SolverRegistry registry = SolverRegistry();
+            registry.add({"line", "Line solver", [] () { return std::make_shared<LineSolver>(); }, {false, false, false, true, 0}});
+            registry.add({"backtracking", "Backtracking solver", [] () { return std::make_shared<BacktrackingSolver>(); }, {true, false, true, true, 0}});
+            return registry;
+        }
+    }
+
+    SolverRegistry::SolverRegistry() :
+        _entries()
+    {
+
+    }
+
+    const SolverRegistry& SolverRegistry::builtin()
+    {
+        static const SolverRegistry registry = makeBuiltinRegistry();
+        return registry;
+    }
+
+    void SolverRegistry::add(Entry entry)
+    {
+        if (find(entry.key))
+        {
+            throw SolverRegistryError("A solver is already registered as \"" + entry.key + "\".");
+        }
+
+        _entries.push_back(std::move(entry));
+    }
+
+    const std::vector<SolverRegistry::Entry>& SolverRegistry::entries() const
+    {
+        return _entries;
+    }
+
+    std::size_t SolverRegistry::size() const
+    {
+        return _entries.size();
+    }
+
+    const SolverRegistry::Entry* SolverRegistry::find(const std::string& key) const
+    {
+        for (const Entry& entry : _entries)
+        {
+            if (entry.key == key) return &entry;
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<Solver> SolverRegistry::create(const std::string& key) const
+    {
+        const Entry* entry = find(key);
+        if (!entry)
+        {
+            throw SolverRegistryError("No solver is registered as \"" + key + "\".");
+        }
+
+        return entry->factory();
+    }
+
+    const SolverRegistry::Entry* SolverRegistry::pick(int width, int height, const Requirements& requirements) const
+    {
+        for (const Entry& entry : _entries)
+        {
+            const Capabilities& c = entry.capabilities;
+            if (requirements.complete && !c.complete) continue;
+            if (requirements.counting && !c.supportsCounting) continue;
+            if (requirements.cancellation && !c.supportsCancellation) continue;
+            if (c.maxGridSize > 0 && (width > c.maxGridSize || height > c.maxGridSize)) continue;
+
+            return &entry;
+        }
+        return nullptr;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef SOLVING__SOLVER_REGISTRY_HPP
+#define SOLVING__SOLVER_REGISTRY_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "solver.hpp"
+
+namespace Picross
+{
+    // Named solver factories, along with what the solvers they make are capable of. Solvers are only
+    // built when asked for, so that each thread can build its own.
+    class SolverRegistry
+    {
+        public:     // Types
+            using Factory = std::function<std::shared_ptr<Solver>()>;
+
+            struct Capabilities
+            {
+                bool complete;              // Whether every satisfiable grid gets solved.
+                bool threadSafe;            // Whether one instance may solve several grids at once.
+                bool supportsCounting;      // Whether countSolutions is implemented.
+                bool supportsCancellation;  // Whether timeouts and the cancel flag are honoured.
+                int maxGridSize;            // Largest width or height handled, 0 for no limit.
+            };
+
+            // Capabilities a solver must have to be picked.
+            struct Requirements
+            {
+                bool complete;
+                bool counting;
+                bool cancellation;
+            };
+
+            struct Entry
+            {
+                std::string key;            // Short name, as typed on the command line.
+                std::string name;           // Display name, same as the one of the solvers made.
+                Factory factory;
+                Capabilities capabilities;
+            };
+
+        private:    // Attributes
+            // In registration order, which is meant to be from the fastest solver to the slowest.
+            std::vector<Entry> _entries;
+
+        public:     // Public methods
+            SolverRegistry();
+
+            // Registry of the solvers of the engine.
+            static const SolverRegistry& builtin();
+
+            // Register a solver, auto-throw if its key is taken.
+            void add(Entry entry);
+
+            const std::vector<Entry>& entries() const;
+            std::size_t size() const;
+            // Entry of the given key, null if there is none.
+            const Entry* find(const std::string& key) const;
+            // Make a solver of the given key, auto-throw if there is none.
+            std::shared_ptr<Solver> create(const std::string& key) const;
+            // First entry which meets the requirements and handles grids of the given size, null if none does.
+            const Entry* pick(int width, int height, const Requirements& requirements) const;
+    };
+}
+
+#endif//SOLVING__SOLVER_REGISTRY_HPP
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "step_solver.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "line_propagator.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    StepSolver::StepSolver() :
+        _propagator(),
+        _hasState(false),
+        _width(0),
+        _height(0),
+        _hintVersion(0),
+        _deduction()
+    {
+
+    }
+
+    StepSolver::Step StepSolver::next(const Grid& grid)
+    {
+        synchronize(grid);
+
+        bool satisfiable = _propagator.findDeduction(_deduction);
+        int line = _deduction.line;
+
+        Step step;
+        step.isRow = line >= 0 && line < _height;
+        step.index = line < 0 ? -1 : (step.isRow ? line : line - _height);
+        if (line >= 0) step.hints = _propagator.getLineHints(line);
+
+        if (!satisfiable)
+        {
+            step.status = Status::Contradiction;
+            return step;
+        }
+
+        if (line < 0)
+        {
+            step.status = _propagator.unknownCount() == 0 ? Status::Solved : Status::Stuck;
+            return step;
+        }
+
+        step.status = Status::Deduced;
+        int start = step.isRow ? line * _width : step.index;
+        int stride = step.isRow ? 1 : _width;
+        for (int k = 0; k < (int) _deduction.cells.size(); k++)
+        {
+            cell_t value = _deduction.cells[k];
+            if (value == _propagator.getCell(start + k * stride)) continue;
+
+            CellDeduction cell = {k, value, Reason::Arrangements, -1};
+            bool reached = false;
+            for (int b = 0; b < (int) step.hints.size(); b++)
+            {
+                int first = _deduction.firstStarts[b];
+                int last = _deduction.lastStarts[b];
+                if (value == CELL_CHECKED && last <= k && k < first + step.hints[b])
+                {
+                    cell.reason = Reason::Overlap;
+                    cell.block = b;
+                    break;
+                }
+                reached = reached || (first <= k && k < last + step.hints[b]);
+            }
+            if (value == CELL_CROSSED && !reached) cell.reason = Reason::Unreachable;
+
+            step.cells.push_back(cell);
+        }
+
+        return step;
+    }
+
+    void StepSolver::apply(const Step& step, Grid& grid)
+    {
+        for (const CellDeduction& cell : step.cells)
+        {
+            if (step.isRow) grid.setCell(step.index, cell.position, cell.value);
+            else grid.setCell(cell.position, step.index, cell.value);
+        }
+    }
+
+    std::int64_t StepSolver::lineCount() const
+    {
+        return _propagator.lineCount();
+    }
+
+    std::size_t StepSolver::trailSize() const
+    {
+        return _propagator.trailSize();
+    }
+
+    void StepSolver::synchronize(const Grid& grid)
+    {
+        if (!_hasState || grid.getWidth() != _width || grid.getHeight() != _height || grid.hintVersion() != _hintVersion)
+        {
+            _propagator.reset(grid);
+            _hasState = true;
+            _width = grid.getWidth();
+            _height = grid.getHeight();
+            _hintVersion = grid.hintVersion();
+            return;
+        }
+
+        // Setting a cell queues its row and column again, lines which no cell changed in still allow no deduction.
+        for (int i = 0; i < _height; i++)
+        {
+            for (int j = 0; j < _width; j++)
+            {
+                cell_t value = grid.getCell(i, j);
+                if (value != _propagator.getCell(i * _width + j)) _propagator.setCell(i * _width + j, value);
+            }
+        }
+
+        // Changes are never taken back, the trail would only grow over an editing session.
+        _propagator.clearTrail();
+    }
+}
\ No newline at end of file
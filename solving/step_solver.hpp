@@ -0,0 +1,81 @@
+#ifndef SOLVING__STEP_SOLVER_HPP
+#define SOLVING__STEP_SOLVER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "line_propagator.hpp"
+#include "../core/cell_t.hpp"
+#include "../core/grid.hpp"
+
+namespace Picross
+{
+    // Walks a grid being solved by hand one line deduction at a time, telling which cells a single line
+    // allows to set and why. Its state is kept from one step to the next: lines found to allow no
+    // deduction are only solved again once a cell crossing them changes, so that asking for the next
+    // step after a few cells changed only costs a few lines, whatever the size of the grid. The whole
+    // state is rebuilt when the dimensions or the hints of the grid change.
+    class StepSolver
+    {
+        public:     // Types
+            enum class Status
+            {
+                Deduced,        // A line allows to set cells.
+                Contradiction,  // A line cannot be satisfied with the cells already set.
+                Stuck,          // No line allows any deduction, some cells are still unknown.
+                Solved          // Every cell is known and satisfies the hints.
+            };
+
+            enum class Reason
+            {
+                Overlap,        // Every placement of one block covers the cell.
+                Unreachable,    // No block can reach the cell.
+                Arrangements    // Every arrangement of the blocks agrees on the cell, though no single block tells.
+            };
+
+            struct CellDeduction
+            {
+                int position;       // Position of the cell along the line.
+                cell_t value;
+                Reason reason;
+                int block;          // Block which covers the cell for overlaps, -1 otherwise.
+            };
+
+            struct Step
+            {
+                Status status;
+                bool isRow;
+                int index;                          // Row or column of the line, -1 if no line is concerned.
+                std::vector<int> hints;             // Hints of the line, without zero entries.
+                std::vector<CellDeduction> cells;
+            };
+
+        private:    // Attributes
+            LinePropagator _propagator;
+            bool _hasState;
+            int _width;
+            int _height;
+            std::uint64_t _hintVersion;
+            LinePropagator::LineDeduction _deduction;
+
+        public:     // Public methods
+            StepSolver();
+
+            // Find the next deduction the cells of the grid allow, without changing the grid.
+            Step next(const Grid& grid);
+            // Set the cells a step deduced in the grid.
+            static void apply(const Step& step, Grid& grid);
+
+            // Number of lines solved since the state was last rebuilt.
+            std::int64_t lineCount() const;
+            // Number of cell changes held by the propagation state, which stays bounded however many steps are taken.
+            std::size_t trailSize() const;
+
+        private:    // Private methods
+            // Bring the state up to date with the cells and hints of the grid.
+            void synchronize(const Grid& grid);
+    };
+}
+
+#endif//SOLVING__STEP_SOLVER_HPP
\ No newline at end of file
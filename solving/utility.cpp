@@ -1,14 +0,0 @@
-#include "utility.hpp"
-
-#include <vector>
-#include <memory>
-
-#include "solver.hpp"
-
-namespace Picross
-{
-    std::vector<std::shared_ptr<Solver>> instantiateAllSolvers()
-    {
-        return {};
-    }
-}
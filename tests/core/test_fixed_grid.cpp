@@ -0,0 +1,121 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <vector>
+
+#include "../../core/cell_t.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/fixed_grid.hpp"
+#include "../../core/exceptions/invalid_cell_value_error.hpp"
+#include "../../core/exceptions/invalid_grid_hints_error.hpp"
+#include "../../core/exceptions/grid_dimension_mismatch_error.hpp"
+#include "../../tools/exceptions/index_out_of_bounds_error.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+
+#define TAGS "[core][grid][fixed_grid]"
+
+namespace Picross
+{
+    // Build a 5x5 cross pattern entirely at compile time.
+    constexpr FixedGrid5x5 makeCrossGrid()
+    {
+        FixedGrid5x5 grid;
+        for (int i = 0; i < 5; i++)
+        {
+            grid.setCell(2, i, CELL_CHECKED);
+            grid.setCell(i, 2, CELL_CHECKED);
+        }
+        grid.setHintsFromState();
+        return grid;
+    }
+
+    static_assert(makeCrossGrid().isSolved(), "Compile-time cross grid should be solved.");
+    static_assert(makeCrossGrid().hintsAreConsistent(), "Compile-time cross grid should have consistent hints.");
+    static_assert(makeCrossGrid().getRowHints(2).sum() == 5, "Middle row of the cross should be fully checked.");
+
+    TEST_CASE("FixedGrid cell and hint accessors", TAGS)
+    {
+        FixedGrid5x5 g;
+        REQUIRE(g.getWidth() == 5);
+        REQUIRE(g.getHeight() == 5);
+        REQUIRE(g.getCell(4, 4) == CELL_CLEARED);
+
+        g.setCell(1, 3, CELL_CHECKED);
+        REQUIRE(g.getCell(1, 3) == CELL_CHECKED);
+
+        FixedGrid5x5::RowHints hints = FixedGrid5x5::RowHints::fromVector({2, 2});
+        REQUIRE_NOTHROW(g.setRowHints(0, hints));
+        REQUIRE(g.getRowHints(0).toVector() == std::vector<int>({2, 2}));
+
+        REQUIRE_THROWS_AS(g.getCell(5, 0), IndexOutOfBoundsError);
+        REQUIRE_THROWS_AS(g.setCell(0, -1, CELL_CHECKED), IndexOutOfBoundsError);
+        REQUIRE_THROWS_AS(g.setCell(0, 0, 3), InvalidCellValueError);
+        REQUIRE(g.getCell(0, 0) == CELL_CLEARED);
+        REQUIRE_THROWS_AS(g.getColHints(5), IndexOutOfBoundsError);
+        REQUIRE_THROWS_AS(FixedGrid5x5::RowHints::fromVector({3, 3}), InvalidGridHintsError);
+        REQUIRE_THROWS_AS(FixedGrid5x5::RowHints::fromVector({1, 1, 1, 1}), InvalidGridHintsError);
+    }
+
+    TEST_CASE("FixedGrid conversion from and to Grid", TAGS)
+    {
+        XMLGridSerialzer xmlReader = XMLGridSerialzer();
+        Grid reference = xmlReader.loadGridFromFile("resources/tests/core/10_10_partial.xml");
+
+        FixedGrid10x10 fixed = FixedGrid10x10(reference);
+        REQUIRE(fixed.isSolved());
+        REQUIRE(fixed.hintsAreConsistent());
+        REQUIRE(fixed.toGrid() == reference);
+
+        fixed.setCell(3, 5, CELL_CHECKED);
+        REQUIRE_FALSE(fixed.isSolved());
+        REQUIRE(fixed.toGrid() != reference);
+
+        REQUIRE_THROWS_AS(FixedGrid5x5(reference), GridDimensionMismatchError);
+    }
+
+    TEST_CASE("FixedGrid hints generation", TAGS)
+    {
+        XMLGridSerialzer xmlReader = XMLGridSerialzer();
+        Grid reference = xmlReader.loadGridFromFile("resources/tests/core/10_10_partial.xml");
+
+        FixedGrid10x10 expected = FixedGrid10x10(reference);
+        Grid noHints = reference;
+        noHints.clearAllHints();
+
+        FixedGrid10x10 test = FixedGrid10x10(noHints);
+        REQUIRE(test != expected);
+
+        test.setHintsFromState();
+        REQUIRE(test == expected);
+    }
+
+    TEST_CASE("FixedGrid vs Grid benchmark", "[.][benchmark]")
+    {
+        XMLGridSerialzer xmlReader = XMLGridSerialzer();
+        Grid reference = xmlReader.loadGridFromFile("resources/tests/core/10_10_partial.xml");
+        FixedGrid10x10 fixed = FixedGrid10x10(reference);
+
+        BENCHMARK("Grid::isSolved")
+        {
+            return reference.isSolved();
+        };
+
+        BENCHMARK("FixedGrid::isSolved")
+        {
+            return fixed.isSolved();
+        };
+
+        BENCHMARK("Grid copy and hint generation")
+        {
+            Grid copy = reference;
+            copy.setHintsFromState();
+            return copy.getWidth();
+        };
+
+        BENCHMARK("FixedGrid copy and hint generation")
+        {
+            FixedGrid10x10 copy = fixed;
+            copy.setHintsFromState();
+            return copy.getWidth();
+        };
+    }
+}
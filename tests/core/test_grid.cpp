@@ -1,5 +1,6 @@
 #include "../../lib/catch2/catch2.hpp"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -130,11 +131,13 @@ namespace Picross
 
             REQUIRE(g.getRow(3) == expectedRow);
             REQUIRE(g.getCol(3) == expectedCol);
+            REQUIRE(std::vector<cell_t>(g.getRowData(3), g.getRowData(3) + 5) == expectedRow);
         }
 
         SECTION("Getters and setters throw when asked impossible stuff")
         {
             REQUIRE_THROWS_AS(g.getCell(10, 0), IndexOutOfBoundsError);
+            REQUIRE_THROWS_AS(g.getRowData(10), IndexOutOfBoundsError);
             REQUIRE_THROWS_AS(g.getCell(0, 10), IndexOutOfBoundsError);
             REQUIRE_THROWS_AS(g.setCell(10, 0, CELL_CHECKED), IndexOutOfBoundsError);
             REQUIRE_THROWS_AS(g.setCell(0, 10, CELL_CHECKED), IndexOutOfBoundsError);
@@ -152,6 +155,23 @@ namespace Picross
                 }
             }
         }
+
+        SECTION("Row setter")
+        {
+            std::vector<cell_t> row = g.getRow(3);
+            row[0] = CELL_CHECKED;
+            row[4] = CELL_CROSSED;
+            REQUIRE_NOTHROW(g.setRow(3, row));
+            REQUIRE(g.getRow(3) == row);
+            REQUIRE(g.getCellCount(CELL_CHECKED) == 1);
+
+            // Nothing is modified when a value is invalid.
+            row[2] = CELL_T_VALUE_COUNT;
+            REQUIRE_THROWS_AS(g.setRow(3, row), InvalidCellValueError);
+            REQUIRE(g.getCell(3, 0) == CELL_CHECKED);
+            REQUIRE_THROWS_AS(g.setRow(5, g.getRow(0)), IndexOutOfBoundsError);
+            REQUIRE_THROWS_AS(g.setRow(0, std::vector<cell_t>(3, CELL_CHECKED)), IndexOutOfBoundsError);
+        }
     }
 
     TEST_CASE("Grid hint getters and setters")
@@ -235,6 +255,40 @@ namespace Picross
         REQUIRE_THROWS_AS(g.areValidRowHints({3, 3}, true), InvalidGridHintsError);
     }
 
+    TEST_CASE("Grid non-throwing hint validation", TAGS)
+    {
+        std::vector<std::vector<int>> hHints = {{2, 2}, {1, 1}, {}};
+        std::vector<std::vector<int>> vHints = {{3}, {}, {1, 1}};
+
+        SECTION("Valid hints")
+        {
+            REQUIRE(Grid::findInvalidHints(5, 3, hHints, vHints).empty());
+        }
+
+        SECTION("Invalid hints")
+        {
+            std::vector<Grid::HintError> errors = Grid::findInvalidHints(3, 3, hHints, vHints);
+            REQUIRE(errors.size() == 1);
+            REQUIRE(errors[0].isRow);
+            REQUIRE(errors[0].index == 0);
+            REQUIRE(errors[0].requiredSpace == 5);
+
+            std::string expected = "Hints (2, 2) require minimum space 5 which exceeds grid width (3), and thus are invalid.\n";
+            REQUIRE(Grid::describeHintErrors(errors, 3, 3, hHints, vHints) == expected);
+
+            // The throwing constructor reports the very same text.
+            try
+            {
+                Grid(3, 3, hHints, vHints);
+                FAIL("Constructor should have thrown.");
+            }
+            catch (const InvalidGridHintsError& e)
+            {
+                REQUIRE(std::string(e.what()) == expected);
+            }
+        }
+    }
+
     TEST_CASE("Grid hint consistency check")
     {
         Grid g = Grid(5, 5);
@@ -252,6 +306,53 @@ namespace Picross
         reference.setRowHints(2, {1, 1});
         // Such a grid is not solvable but its hints are consistent.
         REQUIRE(reference.hintsAreConsistent());
+
+        // Cached hint sums follow every kind of hint modification.
+        reference.clearColHints();
+        REQUIRE_FALSE(reference.hintsAreConsistent());
+        reference.clearRowHints();
+        REQUIRE(reference.hintsAreConsistent());
+        reference.setHintsFromState();
+        REQUIRE(reference.hintsAreConsistent());
+        REQUIRE(reference.isSolved());
+    }
+
+    TEST_CASE("Grid hint version", TAGS)
+    {
+        Grid g = Grid(5, 5);
+        Grid other = Grid(5, 5);
+        REQUIRE(g.hintVersion() != other.hintVersion());
+
+        // Copies share the version of their hints until either of them is modified.
+        Grid copy = g;
+        REQUIRE(copy.hintVersion() == g.hintVersion());
+        copy.setCell(0, 0, CELL_CHECKED);
+        REQUIRE(copy.hintVersion() == g.hintVersion());
+
+        std::uint64_t version = copy.hintVersion();
+        copy.setRowHints(0, {1});
+        REQUIRE(copy.hintVersion() != version);
+        REQUIRE(g.hintVersion() == version);
+
+        // Every kind of hint modification gives a new version.
+        std::vector<std::uint64_t> versions = {copy.hintVersion()};
+        copy.setColHints(0, {1});
+        versions.push_back(copy.hintVersion());
+        copy.setAllRowHints(std::vector<std::vector<int>>(5, {2}));
+        versions.push_back(copy.hintVersion());
+        copy.clearRowHints();
+        versions.push_back(copy.hintVersion());
+        copy.clearColHints();
+        versions.push_back(copy.hintVersion());
+        copy.setHintsFromState();
+        versions.push_back(copy.hintVersion());
+        for (std::size_t i = 1; i < versions.size(); i++)
+        {
+            REQUIRE(versions[i] != versions[i - 1]);
+        }
+
+        g = copy;
+        REQUIRE(g.hintVersion() == copy.hintVersion());
     }
 
     TEST_CASE("Grid hints generation", TAGS)
@@ -300,6 +401,29 @@ namespace Picross
         REQUIRE(g.mostPresentState() == CELL_CHECKED);
     }
 
+    TEST_CASE("Grid cell counts", TAGS)
+    {
+        Grid g = Grid(5, 4);
+        REQUIRE(g.getCellCount(CELL_CLEARED) == 20);
+        REQUIRE(g.getCellCount(CELL_CHECKED) == 0);
+        REQUIRE(g.fillRatio() == 0.);
+
+        g.setCellRange(0, 1, 0, 4, CELL_CHECKED);
+        g.crossCell(3, 3);
+        g.setCell(0, 0, CELL_CROSSED);
+        REQUIRE(g.getCellCount(CELL_CHECKED) == 9);
+        REQUIRE(g.getCellCount(CELL_CROSSED) == 2);
+        REQUIRE(g.getCellCount(CELL_CLEARED) == 9);
+        REQUIRE(g.fillRatio() == Approx(0.45));
+
+        // Overwriting a cell with its own value changes nothing.
+        g.checkCell(0, 1);
+        REQUIRE(g.getCellCount(CELL_CHECKED) == 9);
+
+        REQUIRE_THROWS_AS(g.getCellCount(CELL_T_VALUE_COUNT), InvalidCellValueError);
+        REQUIRE(Grid(0, 0).fillRatio() == 0.);
+    }
+
     TEST_CASE("Grid comparison", TAGS)
     {
         XMLGridSerialzer xmlReader = XMLGridSerialzer();
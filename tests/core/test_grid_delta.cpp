@@ -0,0 +1,127 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <string>
+#include <vector>
+
+#include "../../core/cell_t.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/grid_delta.hpp"
+#include "../../core/exceptions/grid_dimension_mismatch_error.hpp"
+#include "../../core/exceptions/invalid_grid_delta_error.hpp"
+#include "../../core/exceptions/invalid_grid_hints_error.hpp"
+#include "../../tools/exceptions/index_out_of_bounds_error.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+
+#define TAGS "[core][grid][grid_delta]"
+
+namespace Picross
+{
+    TEST_CASE("GridDelta diff and apply", TAGS)
+    {
+        XMLGridSerialzer xmlReader = XMLGridSerialzer();
+        Grid reference = xmlReader.loadGridFromFile("resources/tests/core/10_10_partial.xml");
+        Grid modified = reference;
+        modified.setCellRange(3, 4, 5, 7, CELL_CROSSED);
+        modified.checkCell(9, 9);
+        modified.setRowHints(5, {2, 3});
+
+        SECTION("Identical grids give an empty delta")
+        {
+            GridDelta delta = diff(reference, reference);
+            REQUIRE(delta.empty());
+            REQUIRE(delta.size() == 0);
+        }
+
+        SECTION("Delta only holds differing cells and hints")
+        {
+            GridDelta delta = diff(reference, modified);
+            REQUIRE(delta.getCellChanges().size() == 7);
+            REQUIRE(delta.getHintChanges().size() == 1);
+
+            GridDelta cellsOnly = diff(reference, modified, false);
+            REQUIRE(cellsOnly.getCellChanges().size() == 7);
+            REQUIRE(cellsOnly.getHintChanges().empty());
+        }
+
+        SECTION("Applying a delta gives the target grid")
+        {
+            Grid g = reference;
+            REQUIRE_NOTHROW(apply(g, diff(reference, modified)));
+            REQUIRE(g == modified);
+        }
+
+        SECTION("Applying the inverted delta gives the source grid back")
+        {
+            Grid g = modified;
+            REQUIRE_NOTHROW(apply(g, diff(reference, modified).inverted()));
+            REQUIRE(g == reference);
+        }
+
+        SECTION("Dimension mismatch")
+        {
+            Grid other = Grid(5, 5);
+            REQUIRE_THROWS_AS(diff(reference, other), GridDimensionMismatchError);
+            REQUIRE_THROWS_AS(apply(other, diff(reference, modified)), GridDimensionMismatchError);
+        }
+
+        SECTION("An invalid change leaves the grid untouched")
+        {
+            GridDelta delta = diff(reference, modified);
+            delta.addColHintChange(0, reference.getColHints(0), {11});
+
+            Grid g = reference;
+            REQUIRE_THROWS_AS(apply(g, delta), InvalidGridHintsError);
+            REQUIRE(g == reference);
+        }
+
+        SECTION("Old values are not checked")
+        {
+            Grid g = modified;
+            REQUIRE_NOTHROW(apply(g, diff(reference, modified)));
+            REQUIRE(g == modified);
+        }
+    }
+
+    TEST_CASE("GridDelta manual construction", TAGS)
+    {
+        GridDelta delta = GridDelta(5, 5);
+        REQUIRE_NOTHROW(delta.addCellChange(4, 4, CELL_CLEARED, CELL_CHECKED));
+        REQUIRE_NOTHROW(delta.addColHintChange(4, {}, {1}));
+        REQUIRE_THROWS_AS(delta.addCellChange(5, 0, CELL_CLEARED, CELL_CHECKED), IndexOutOfBoundsError);
+        REQUIRE_THROWS_AS(delta.addRowHintChange(-1, {}, {1}), IndexOutOfBoundsError);
+
+        Grid g = Grid(5, 5);
+        apply(g, delta);
+        REQUIRE(g.getCell(4, 4) == CELL_CHECKED);
+        REQUIRE(g.getColHints(4) == std::vector<int>({1}));
+    }
+
+    TEST_CASE("GridDelta serialization", TAGS)
+    {
+        XMLGridSerialzer xmlReader = XMLGridSerialzer();
+        Grid reference = xmlReader.loadGridFromFile("resources/tests/core/10_10_partial.xml");
+        Grid modified = reference;
+        modified.setCellRange(9, 9, 0, 9, CELL_CROSSED);
+        modified.setRowHints(9, {});
+        modified.setRowHints(0, {1, 1, 1});
+
+        GridDelta delta = diff(reference, modified);
+
+        SECTION("Round trip")
+        {
+            std::string data = delta.serialize();
+            REQUIRE(GridDelta::deserialize(data) == delta);
+
+            // Consecutive cell changes take up one byte each.
+            REQUIRE(data.size() < 32);
+        }
+
+        SECTION("Corrupted input")
+        {
+            std::string data = delta.serialize();
+            REQUIRE_THROWS_AS(GridDelta::deserialize(""), InvalidGridDeltaError);
+            REQUIRE_THROWS_AS(GridDelta::deserialize(data.substr(0, data.size() - 1)), InvalidGridDeltaError);
+            REQUIRE_THROWS_AS(GridDelta::deserialize(data + '\0'), InvalidGridDeltaError);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../../core/cell_t.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/grid_snapshot.hpp"
+#include "../../core/exceptions/invalid_cell_value_error.hpp"
+#include "../../tools/exceptions/index_out_of_bounds_error.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+
+#define TAGS "[core][grid][grid_snapshot]"
+
+namespace Picross
+{
+    TEST_CASE("GridSnapshot reflects the grid it was taken from", TAGS)
+    {
+        XMLGridSerialzer xmlReader = XMLGridSerialzer();
+        Grid reference = xmlReader.loadGridFromFile("resources/tests/core/10_10_partial.xml");
+
+        GridSnapshot snapshot = GridSnapshot(reference);
+        REQUIRE(snapshot.getWidth() == 10);
+        REQUIRE(snapshot.getHeight() == 10);
+        REQUIRE(snapshot.getVersion() == 0);
+        REQUIRE(snapshot.getRow(4) == reference.getRow(4));
+        REQUIRE(snapshot.getCell(3, 7) == reference.getCell(3, 7));
+        REQUIRE(snapshot.getAllRowHints() == reference.getAllRowHints());
+        REQUIRE(snapshot.getAllColHints() == reference.getAllColHints());
+        REQUIRE(snapshot.toGrid() == reference);
+
+        // Snapshot is not affected by later changes to the grid.
+        reference.setCell(3, 7, CELL_CROSSED);
+        REQUIRE(snapshot.toGrid() != reference);
+
+        REQUIRE_THROWS_AS(snapshot.getCell(10, 0), IndexOutOfBoundsError);
+        REQUIRE_THROWS_AS(snapshot.getRow(-1), IndexOutOfBoundsError);
+    }
+
+    TEST_CASE("GridSnapshot versions share unchanged rows", TAGS)
+    {
+        XMLGridSerialzer xmlReader = XMLGridSerialzer();
+        Grid grid = xmlReader.loadGridFromFile("resources/tests/core/10_10_partial.xml");
+        GridSnapshot first = GridSnapshot(grid);
+
+        SECTION("Update from a modified grid")
+        {
+            grid.setCell(2, 5, CELL_CROSSED);
+            GridSnapshot second = first.update(grid);
+            REQUIRE(second.getVersion() == 1);
+            REQUIRE(second.toGrid() == grid);
+            REQUIRE_FALSE(second.sharesRowWith(first, 2));
+            for (int i = 0; i < 10; i++)
+            {
+                if (i != 2) REQUIRE(second.sharesRowWith(first, i));
+            }
+        }
+
+        SECTION("Single cell modification")
+        {
+            GridSnapshot second = first.withCell(6, 1, CELL_CROSSED);
+            REQUIRE(second.getCell(6, 1) == CELL_CROSSED);
+            REQUIRE(first.getCell(6, 1) == grid.getCell(6, 1));
+            REQUIRE_FALSE(second.sharesRowWith(first, 6));
+            REQUIRE(second.sharesRowWith(first, 5));
+
+            REQUIRE_THROWS_AS(first.withCell(0, 10, CELL_CHECKED), IndexOutOfBoundsError);
+            REQUIRE_THROWS_AS(first.withCell(0, 0, 7), InvalidCellValueError);
+        }
+
+        SECTION("Update with different dimensions")
+        {
+            GridSnapshot second = first.update(Grid(4, 3));
+            REQUIRE(second.getWidth() == 4);
+            REQUIRE(second.getHeight() == 3);
+            REQUIRE(second.getVersion() == 1);
+            REQUIRE_FALSE(second.sharesRowWith(first, 0));
+        }
+    }
+
+    TEST_CASE("GridSnapshotPublisher concurrent reads", TAGS)
+    {
+        GridSnapshotPublisher publisher;
+        REQUIRE(publisher.current() == nullptr);
+
+        Grid grid = Grid(8, 8);
+        publisher.publish(grid);
+        REQUIRE(publisher.current()->toGrid() == grid);
+
+        std::atomic<bool> done = false;
+        std::atomic<int> inconsistencies = 0;
+        std::vector<std::thread> readers;
+
+        // Every published version has exactly as many checked cells as its version number:
+        // a reader must never observe a half-written snapshot.
+        for (int t = 0; t < 4; t++)
+        {
+            readers.emplace_back([&]()
+            {
+                while (!done)
+                {
+                    GridSnapshotPtr snapshot = publisher.current();
+                    int checked = 0;
+                    for (int i = 0; i < snapshot->getHeight(); i++)
+                    {
+                        for (cell_t cell : snapshot->getRow(i))
+                        {
+                            if (cell == CELL_CHECKED) checked++;
+                        }
+                    }
+                    if (checked != (int) snapshot->getVersion()) inconsistencies++;
+                }
+            });
+        }
+
+        for (int i = 0; i < 64; i++)
+        {
+            grid.setCell(i / 8, i % 8, CELL_CHECKED);
+            publisher.publish(grid);
+        }
+        done = true;
+
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        REQUIRE(inconsistencies == 0);
+        REQUIRE(publisher.current()->getVersion() == 64);
+        REQUIRE(publisher.current()->toGrid() == grid);
+    }
+}
@@ -1,5 +1,36 @@
 #include "debugging_tools.hpp"
 
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local std::size_t allocationCount = 0;
+}
+
+// Global allocation functions are replaced for the whole test executable, so that tests can count allocations.
+void* operator new(std::size_t size)
+{
+    allocationCount++;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+std::size_t threadAllocationCount()
+{
+    return allocationCount;
+}
+
 void stringDifference(std::string string1, std::string string2)
 {
     Catch::cout() << "String 1 len: " << string1.length() << "; string 2 len: " << string2.length() << std::endl;
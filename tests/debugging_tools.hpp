@@ -3,8 +3,12 @@
 
 #include "../lib/catch2/catch2.hpp"
 
+#include <cstddef>
 #include <string>
 
 void stringDifference(std::string string1, std::string string2);
 
+// Number of heap allocations made by the calling thread so far.
+std::size_t threadAllocationCount();
+
 #endif//TEST__DEBUGGING_TOOLS_HPP
\ No newline at end of file
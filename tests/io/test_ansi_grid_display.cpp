@@ -0,0 +1,93 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "../../io/ansi_grid_display.hpp"
+#include "../../io/text_grid_formatter.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[io][text][grid][ansi]"
+
+namespace Picross
+{
+    TEST_CASE("ANSI grid display", TAGS)
+    {
+        Grid g = Grid(3, 2, {{1}, {2}}, {{1}, {1}, {1}});
+        TextGridFormatter txt = TextGridFormatter();
+        AnsiGridDisplay display = AnsiGridDisplay();
+
+        std::ostringstream first;
+        display.draw(first, g);
+        REQUIRE(display.hasFrame());
+
+        SECTION("First frame is a full render pinned to the top of the screen")
+        {
+            // 1 column hint line, 2 rows and 3 border lines make up 6 lines.
+            std::string expected = "\x1b[r\x1b[H\x1b[2J" + txt.renderGridWithHints(g) + "\x1b[7r\x1b[7;1H";
+            REQUIRE(first.str() == expected);
+        }
+
+        SECTION("Unchanged grid draws nothing")
+        {
+            std::ostringstream os;
+            display.draw(os, g);
+            REQUIRE(os.str().empty());
+        }
+
+        SECTION("Changed cells are written in place")
+        {
+            g.setCell(1, 0, CELL_CHECKED);
+            g.setCell(1, 1, CELL_CROSSED);
+            g.setCell(0, 2, CELL_CHECKED);
+
+            std::ostringstream os;
+            display.draw(os, g);
+            // Row hints are 1 character wide: cell (0, 2) is on line 3, column 7.
+            // Cell (1, 1) comes right after cell (1, 0), only the bar in between is written.
+            REQUIRE(os.str() == "\x1b" "7" "\x1b[3;7H■" "\x1b[5;3H■║×" "\x1b" "8");
+
+            std::ostringstream again;
+            display.draw(again, g);
+            REQUIRE(again.str().empty());
+        }
+
+        SECTION("Layout changes trigger a full redraw")
+        {
+            g.setRowHints(0, {1, 1});
+
+            std::ostringstream os;
+            display.draw(os, g);
+            REQUIRE(os.str().find(txt.renderGridWithHints(g)) != std::string::npos);
+        }
+
+        SECTION("Released display draws from scratch")
+        {
+            std::ostringstream os;
+            display.release(os);
+            REQUIRE(os.str() == "\x1b" "7" "\x1b[r" "\x1b" "8");
+            REQUIRE_FALSE(display.hasFrame());
+
+            std::ostringstream next;
+            display.draw(next, g);
+            REQUIRE(next.str() == first.str());
+        }
+    }
+
+    TEST_CASE("ANSI grid display without hints", TAGS)
+    {
+        Grid g = Grid(3, 2, {{1}, {2}}, {{1}, {1}, {1}});
+        AnsiGridDisplay display = AnsiGridDisplay(false);
+
+        std::ostringstream first;
+        display.draw(first, g);
+
+        // Hints are not displayed, changing them does not change the layout.
+        g.setRowHints(0, {2});
+        g.setCell(0, 0, CELL_CHECKED);
+
+        std::ostringstream os;
+        display.draw(os, g);
+        REQUIRE(os.str() == "\x1b" "7" "\x1b[2;2H■" "\x1b" "8");
+    }
+}
@@ -0,0 +1,118 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../generate_static_grids.hpp"
+#include "../../io/async_grid_saver.hpp"
+#include "../../io/grid_corpus_loader.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[io][async][grid][serialization]"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    TEST_CASE("Asynchronous grid saving", TAGS)
+    {
+        Grid reference = generate10x10PartialGrid(true);
+        AsyncGridSaver saver = AsyncGridSaver();
+
+        SECTION("Grids are saved in the format their extension tells")
+        {
+            std::string extension = GENERATE(as<std::string>{}, ".xml", ".pxgb", ".non");
+            std::string path = "resources/tests/io/async_output" + extension;
+
+            saver.save(reference, path);
+            saver.waitIdle();
+            REQUIRE(saver.pendingSaves() == 0);
+
+            std::vector<AsyncGridSaver::SaveResult> results = saver.takeResults();
+            REQUIRE(results.size() == 1);
+            REQUIRE(results[0].success);
+            REQUIRE(results[0].path == path);
+            REQUIRE(saver.takeResults().empty());
+
+            Grid loaded = GridCorpusLoader::loadGridFile(path);
+            REQUIRE(loaded.getAllRowHints() == reference.getAllRowHints());
+            REQUIRE(loaded.getAllColHints() == reference.getAllColHints());
+            if (extension != ".non") REQUIRE(loaded == reference);
+
+            // No temporary file is left behind.
+            REQUIRE_FALSE(fs::exists(path + ".tmp"));
+        }
+
+        SECTION("Later modifications of the grid are not saved")
+        {
+            Grid g = reference;
+            saver.save(g, "resources/tests/io/async_output.pxgb");
+            g.setCell(0, 0, CELL_CROSSED);
+            saver.waitIdle();
+
+            REQUIRE(GridCorpusLoader::loadGridFile("resources/tests/io/async_output.pxgb") == reference);
+        }
+
+        SECTION("Saves are written in request order")
+        {
+            Grid g = reference;
+            for (int i = 0; i < 10; i++)
+            {
+                g.setCell(i, i, CELL_CROSSED);
+                saver.save(g, "resources/tests/io/async_output.pxgb");
+            }
+            saver.waitIdle();
+
+            REQUIRE(saver.takeResults().size() == 10);
+            REQUIRE(GridCorpusLoader::loadGridFile("resources/tests/io/async_output.pxgb") == g);
+        }
+
+        SECTION("Failures are reported")
+        {
+            saver.save(reference, "resources/tests/io/no_such_dir/output.xml");
+            saver.waitIdle();
+
+            std::vector<AsyncGridSaver::SaveResult> results = saver.takeResults();
+            REQUIRE(results.size() == 1);
+            REQUIRE_FALSE(results[0].success);
+            REQUIRE_FALSE(results[0].error.empty());
+            REQUIRE(AsyncGridSaver::describeResult(results[0]).find("could not be saved") != std::string::npos);
+        }
+
+        SECTION("Destruction waits for pending saves")
+        {
+            fs::remove("resources/tests/io/async_output.xml");
+            {
+                AsyncGridSaver scoped = AsyncGridSaver();
+                scoped.save(reference, "resources/tests/io/async_output.xml");
+            }
+            REQUIRE(fs::exists("resources/tests/io/async_output.xml"));
+        }
+    }
+
+    TEST_CASE("Lazily created grid savers", TAGS)
+    {
+        std::shared_ptr<AsyncGridSaver> saver;
+        std::ostringstream out;
+        std::ostringstream err;
+
+        // Nothing to report before any saver exists.
+        AsyncGridSaver::reportResults(saver, out, err);
+        REQUIRE(out.str().empty());
+
+        std::shared_ptr<AsyncGridSaver> created = AsyncGridSaver::getOrCreate(saver);
+        REQUIRE(created == saver);
+        REQUIRE(AsyncGridSaver::getOrCreate(saver) == created);
+
+        saver->save(generate10x10PartialGrid(true), "resources/tests/io/async_output.xml");
+        saver->save(generate10x10PartialGrid(true), "resources/tests/io/no_such_dir/output.xml");
+        saver->waitIdle();
+
+        AsyncGridSaver::reportResults(saver, out, err);
+        REQUIRE(out.str().find("successfully saved") != std::string::npos);
+        REQUIRE(err.str().find("could not be saved") != std::string::npos);
+    }
+}
@@ -0,0 +1,104 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <fstream>
+#include <string>
+
+#include "../generate_static_grids.hpp"
+#include "../../io/binary_grid_serializer.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../io/exceptions/invalid_binary_grid_error.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/exceptions/invalid_grid_hints_error.hpp"
+#include "../../tools/exceptions/file_not_found_error.hpp"
+
+#define TAGS "[io][binary][grid][serialization]"
+
+namespace Picross
+{
+    TEST_CASE("Binary round-trip against XML", TAGS)
+    {
+        std::string path = GENERATE(as<std::string>{},
+            "resources/tests/io/10_10_partial.xml",
+            "resources/tests/io/10_10_partial_empty.xml",
+            "resources/tests/io/20_20_solved.xml",
+            "resources/tests/picross_cli/5_10_completed.xml",
+            "resources/tests/picross_shell/5_10_completed_nohints.xml"
+        );
+
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        BinaryGridSerializer binary = BinaryGridSerializer();
+        Grid reference = xml.loadGridFromFile(path);
+
+        REQUIRE_NOTHROW(binary.saveGridToFile(reference, "resources/tests/io/output.pxgb"));
+        Grid g = binary.loadGridFromFile("resources/tests/io/output.pxgb");
+        REQUIRE(g == reference);
+
+        // Going back to XML yields the same grid again.
+        xml.saveGridToFile(g, "resources/tests/io/output.xml");
+        REQUIRE(xml.loadGridFromFile("resources/tests/io/output.xml") == reference);
+
+        // The binary file is much smaller than its XML counterpart.
+        std::ifstream xmlFile = std::ifstream(path, std::ios::binary | std::ios::ate);
+        REQUIRE(binary.encode(reference).size() * 10 < (std::size_t) xmlFile.tellg());
+    }
+
+    TEST_CASE("Binary encoding layout", TAGS)
+    {
+        BinaryGridSerializer binary = BinaryGridSerializer();
+        Grid g = generate10x10PartialGrid(true);
+        std::string data = binary.encode(g);
+
+        REQUIRE(data.substr(0, 4) == "PXGB");
+        REQUIRE((unsigned char) data[4] == BinaryGridSerializer::FORMAT_VERSION);
+        REQUIRE(binary.decode((const unsigned char*) data.data(), data.size()) == g);
+
+        Grid empty = Grid(0, 0);
+        std::string emptyData = binary.encode(empty);
+        REQUIRE(emptyData.size() == 7);
+        REQUIRE(binary.decode((const unsigned char*) emptyData.data(), emptyData.size()) == empty);
+    }
+
+    TEST_CASE("Binary decoding of invalid data", TAGS)
+    {
+        BinaryGridSerializer binary = BinaryGridSerializer();
+        std::string data = binary.encode(generate10x10PartialGrid(true));
+
+        SECTION("Every truncation is rejected")
+        {
+            for (std::size_t i = 0; i < data.size(); i++)
+            {
+                REQUIRE_THROWS_AS(binary.decode((const unsigned char*) data.data(), i), InvalidBinaryGridError);
+            }
+        }
+
+        SECTION("Bad magic or version")
+        {
+            std::string bad = data;
+            bad[0] = 'X';
+            REQUIRE_THROWS_AS(binary.decode((const unsigned char*) bad.data(), bad.size()), InvalidBinaryGridError);
+
+            bad = data;
+            bad[4] = 2;
+            REQUIRE_THROWS_AS(binary.decode((const unsigned char*) bad.data(), bad.size()), InvalidBinaryGridError);
+        }
+
+        SECTION("Invalid cell value")
+        {
+            std::string bad = data;
+            bad.back() = (char) 0xFF;
+            REQUIRE_THROWS_AS(binary.decode((const unsigned char*) bad.data(), bad.size()), InvalidBinaryGridError);
+        }
+
+        SECTION("Hints not fitting their line")
+        {
+            // Width 3, height 1, row hints {2, 2}: each value is in range, but the grid itself rejects them.
+            std::string bad = std::string("PXGB\x01\x03\x01\x02\x02\x02\x00\x00\x00\x00", 14);
+            REQUIRE_THROWS_AS(binary.decode((const unsigned char*) bad.data(), bad.size()), InvalidGridHintsError);
+        }
+
+        SECTION("Missing file")
+        {
+            REQUIRE_THROWS_AS(binary.loadGridFromFile("resources/tests/io/does_not_exist.pxgb"), FileNotFoundError);
+        }
+    }
+}
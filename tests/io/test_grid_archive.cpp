@@ -0,0 +1,136 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../generate_static_grids.hpp"
+#include "../../io/grid_archive_format.hpp"
+#include "../../io/grid_archive_reader.hpp"
+#include "../../io/grid_archive_writer.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../io/exceptions/invalid_grid_archive_error.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[io][archive]"
+
+namespace Picross
+{
+    namespace
+    {
+        std::vector<Grid> archiveTestGrids()
+        {
+            XMLGridSerialzer xml = XMLGridSerialzer();
+            return {
+                generate10x10PartialGrid(true),
+                xml.loadGridFromFile("resources/tests/io/20_20_solved.xml"),
+                Grid(3, 7),
+                xml.loadGridFromFile("resources/tests/picross_cli/5_10_completed.xml"),
+                generate10x10PartialGrid(false)
+            };
+        }
+    }
+
+    TEST_CASE("Grid archive round-trip", TAGS)
+    {
+        unsigned char format = GENERATE(as<unsigned char>{}, GRID_ARCHIVE_RECORD_BINARY, GRID_ARCHIVE_RECORD_XML);
+        std::vector<Grid> grids = archiveTestGrids();
+
+        {
+            GridArchiveWriter writer = GridArchiveWriter("resources/tests/io/output.pxga", format);
+            for (const Grid& g : grids)
+            {
+                writer.addGrid(g);
+            }
+            REQUIRE(writer.size() == grids.size());
+            writer.close();
+            REQUIRE_THROWS_AS(writer.addGrid(grids[0]), InvalidGridArchiveError);
+        }
+
+        GridArchiveReader reader = GridArchiveReader("resources/tests/io/output.pxga");
+        REQUIRE(reader.size() == grids.size());
+        REQUIRE(reader.getRecordFormat() == format);
+
+        SECTION("Random access")
+        {
+            REQUIRE(reader.gridAt(3) == grids[3]);
+            REQUIRE(reader.gridAt(0) == grids[0]);
+            REQUIRE(reader.gridAt(4) == grids[4]);
+            REQUIRE_THROWS_AS(reader.gridAt(5), InvalidGridArchiveError);
+        }
+
+        SECTION("Sequential iteration")
+        {
+            std::size_t i = 0;
+            for (const Grid& g : reader)
+            {
+                REQUIRE(g == grids[i++]);
+            }
+            REQUIRE(i == grids.size());
+        }
+    }
+
+    TEST_CASE("Grid archive closed by destructor", TAGS)
+    {
+        {
+            GridArchiveWriter writer = GridArchiveWriter("resources/tests/io/output.pxga");
+            writer.addGrid(generate10x10PartialGrid(true));
+        }
+
+        GridArchiveReader reader = GridArchiveReader("resources/tests/io/output.pxga");
+        REQUIRE(reader.size() == 1);
+        REQUIRE(reader.gridAt(0) == generate10x10PartialGrid(true));
+    }
+
+    TEST_CASE("Empty grid archive", TAGS)
+    {
+        GridArchiveWriter("resources/tests/io/output.pxga").close();
+
+        GridArchiveReader reader = GridArchiveReader("resources/tests/io/output.pxga");
+        REQUIRE(reader.size() == 0);
+        REQUIRE(reader.begin() == reader.end());
+    }
+
+    TEST_CASE("Corrupted grid archives", TAGS)
+    {
+        {
+            GridArchiveWriter writer = GridArchiveWriter("resources/tests/io/output.pxga");
+            writer.addGrid(generate10x10PartialGrid(true));
+            writer.addGrid(generate10x10PartialGrid(false));
+        }
+
+        std::ifstream in = std::ifstream("resources/tests/io/output.pxga", std::ios::binary);
+        std::string data = std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        in.close();
+
+        auto writeAndOpen = [](const std::string& contents)
+        {
+            std::ofstream out = std::ofstream("resources/tests/io/corrupted.pxga", std::ios::binary | std::ios::trunc);
+            out << contents;
+            out.close();
+            return GridArchiveReader("resources/tests/io/corrupted.pxga");
+        };
+
+        SECTION("Truncated file")
+        {
+            REQUIRE_THROWS_AS(writeAndOpen(data.substr(0, data.size() - 1)), InvalidGridArchiveError);
+            REQUIRE_THROWS_AS(writeAndOpen(data.substr(0, 10)), InvalidGridArchiveError);
+        }
+
+        SECTION("Wrong record count")
+        {
+            std::string bad = data;
+            bad[bad.size() - GRID_ARCHIVE_FOOTER_SIZE] = 3;
+            REQUIRE_THROWS_AS(writeAndOpen(bad), InvalidGridArchiveError);
+        }
+
+        SECTION("Record offset out of order")
+        {
+            std::string bad = data;
+            std::size_t indexOffset = bad.size() - GRID_ARCHIVE_FOOTER_SIZE - 16;
+            bad[indexOffset + 8] = 1;
+            GridArchiveReader reader = writeAndOpen(bad);
+            REQUIRE_THROWS_AS(reader.gridAt(1), InvalidGridArchiveError);
+        }
+    }
+}
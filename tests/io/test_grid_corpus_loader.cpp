@@ -0,0 +1,99 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../io/grid_corpus_loader.hpp"
+#include "../../io/xml_grid_stream_reader.hpp"
+#include "../../core/grid.hpp"
+#include "../../tools/exceptions/file_not_found_error.hpp"
+
+#define TAGS "[io][corpus]"
+
+namespace Picross
+{
+    TEST_CASE("Corpus file listing", TAGS)
+    {
+        std::vector<std::string> files = GridCorpusLoader::listGridFiles("resources/tests/corpus");
+        REQUIRE(files.size() == 5);
+        REQUIRE(std::is_sorted(files.begin(), files.end()));
+
+        std::vector<std::string> manifest = GridCorpusLoader::readManifest("resources/tests/corpus/manifest.txt");
+        REQUIRE(manifest.size() == 3);
+        REQUIRE(manifest[2] == "resources/tests/corpus/more/20_20_solved.xml");
+
+        REQUIRE_THROWS_AS(GridCorpusLoader::listGridFiles("resources/tests/no_such_dir"), FileNotFoundError);
+        REQUIRE_THROWS_AS(GridCorpusLoader::readManifest("resources/tests/no_such_manifest.txt"), FileNotFoundError);
+    }
+
+    TEST_CASE("Grid file format detection", TAGS)
+    {
+        std::vector<std::string> files = GridCorpusLoader::listGridFiles("resources/tests/formats");
+        std::string format = GENERATE(as<std::string>{}, "5_5_tatham.non", "5_5_webpbn.xml", "5_5_olsak.g");
+
+        Grid g = GridCorpusLoader::loadGridFile("resources/tests/formats/" + format);
+        REQUIRE(g.getAllRowHints() == std::vector<std::vector<int>>{{2, 1}, {3}, {1, 1}, {}, {5}});
+        REQUIRE(std::find(files.begin(), files.end(), "resources/tests/formats/" + format) != files.end());
+    }
+
+    TEST_CASE("Parallel corpus loading", TAGS)
+    {
+        std::size_t threads = GENERATE(as<std::size_t>{}, 1, 3, 8);
+        GridCorpusLoader loader = GridCorpusLoader(threads, 2);
+        XMLGridStreamReader xml = XMLGridStreamReader();
+
+        std::map<std::size_t, GridCorpusLoader::LoadedGrid> results;
+        loader.loadDirectory("resources/tests/corpus", [&](GridCorpusLoader::LoadedGrid&& loaded)
+        {
+            results.emplace(loaded.index, std::move(loaded));
+        });
+
+        // Every file is reported exactly once, and grids match a sequential load.
+        std::vector<std::string> files = GridCorpusLoader::listGridFiles("resources/tests/corpus");
+        REQUIRE(results.size() == files.size());
+        for (std::size_t i = 0; i < files.size(); i++)
+        {
+            const GridCorpusLoader::LoadedGrid& loaded = results.at(i);
+            REQUIRE(loaded.path == files[i]);
+
+            if (loaded.path.find("broken") != std::string::npos)
+            {
+                REQUIRE_FALSE(loaded.grid.has_value());
+                REQUIRE_FALSE(loaded.error.empty());
+            }
+            else
+            {
+                REQUIRE(loaded.grid.has_value());
+                REQUIRE(*loaded.grid == xml.loadGridFromFile(files[i]));
+            }
+        }
+    }
+
+    TEST_CASE("Parallel manifest loading", TAGS)
+    {
+        GridCorpusLoader loader = GridCorpusLoader(2);
+        int count = 0;
+        loader.loadManifest("resources/tests/corpus/manifest.txt", [&](GridCorpusLoader::LoadedGrid&& loaded)
+        {
+            REQUIRE(loaded.grid.has_value());
+            count++;
+        });
+        REQUIRE(count == 3);
+    }
+
+    TEST_CASE("Corpus loading stops when the consumer throws", TAGS)
+    {
+        GridCorpusLoader loader = GridCorpusLoader(4, 1);
+        std::vector<std::string> paths = std::vector<std::string>(200, "resources/tests/corpus/10_10_partial.xml");
+
+        int consumed = 0;
+        REQUIRE_THROWS_AS(loader.load(paths, [&](GridCorpusLoader::LoadedGrid&&)
+        {
+            if (++consumed == 3) throw std::runtime_error("Consumer gave up");
+        }), std::runtime_error);
+        REQUIRE(consumed == 3);
+    }
+}
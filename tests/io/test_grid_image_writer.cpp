@@ -0,0 +1,243 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../io/grid_image_writer.hpp"
+#include "../../io/grid_archive_writer.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../io/exceptions/image_export_error.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[io][image][grid]"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    namespace
+    {
+        // 3x2 grid: checked, cleared, crossed on the first row, all checked on the second one.
+        Grid makeImageTestGrid()
+        {
+            Grid g = Grid(3, 2);
+            g.setCell(0, 0, CELL_CHECKED);
+            g.setCell(0, 2, CELL_CROSSED);
+            g.setCellRange(1, 1, 0, 2, CELL_CHECKED);
+            return g;
+        }
+
+        std::string readBinaryFile(const std::string& path)
+        {
+            std::ifstream f = std::ifstream(path, std::ios::binary);
+            std::stringstream contents;
+            contents << f.rdbuf();
+            return contents.str();
+        }
+
+        std::uint32_t readUInt32BE(const std::string& data, std::size_t offset)
+        {
+            return ((std::uint32_t) (unsigned char) data[offset] << 24) | ((std::uint32_t) (unsigned char) data[offset + 1] << 16)
+                 | ((std::uint32_t) (unsigned char) data[offset + 2] << 8) | (std::uint32_t) (unsigned char) data[offset + 3];
+        }
+
+        std::uint32_t referenceCRC32(const std::string& data)
+        {
+            std::uint32_t c = 0xFFFFFFFFu;
+            for (unsigned char byte : data)
+            {
+                c ^= byte;
+                for (int k = 0; k < 8; k++)
+                {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+            }
+            return c ^ 0xFFFFFFFFu;
+        }
+
+        // Check the chunk structure of a PNG file and return its IHDR and concatenated IDAT contents.
+        void readPNGChunks(const std::string& png, std::string& header, std::string& imageData)
+        {
+            REQUIRE(png.substr(0, 8) == std::string("\x89PNG\r\n\x1a\n", 8));
+
+            std::size_t offset = 8;
+            std::string type;
+            while (type != "IEND")
+            {
+                REQUIRE(offset + 12 <= png.size());
+                std::uint32_t length = readUInt32BE(png, offset);
+                type = png.substr(offset + 4, 4);
+                std::string data = png.substr(offset + 8, length);
+                REQUIRE(readUInt32BE(png, offset + 8 + length) == referenceCRC32(type + data));
+
+                if (type == "IHDR") header = data;
+                if (type == "IDAT") imageData += data;
+                offset += 12 + length;
+            }
+            REQUIRE(offset == png.size());
+        }
+
+        // Unwrap a zlib stream made of stored deflate blocks only.
+        std::string unstore(const std::string& zlib)
+        {
+            REQUIRE(((unsigned char) zlib[0] * 256 + (unsigned char) zlib[1]) % 31 == 0);
+
+            std::string out;
+            std::size_t offset = 2;
+            bool last = false;
+            while (!last)
+            {
+                unsigned char blockHeader = zlib[offset];
+                last = blockHeader & 1;
+                REQUIRE((blockHeader >> 1) == 0);
+
+                std::uint16_t length = (unsigned char) zlib[offset + 1] | ((unsigned char) zlib[offset + 2] << 8);
+                std::uint16_t complement = (unsigned char) zlib[offset + 3] | ((unsigned char) zlib[offset + 4] << 8);
+                REQUIRE((std::uint16_t) ~length == complement);
+
+                out += zlib.substr(offset + 5, length);
+                offset += 5 + length;
+            }
+
+            std::uint32_t a = 1, b = 0;
+            for (unsigned char byte : out)
+            {
+                a = (a + byte) % 65521;
+                b = (b + a) % 65521;
+            }
+            REQUIRE(readUInt32BE(zlib, offset) == ((b << 16) | a));
+            REQUIRE(offset + 4 == zlib.size());
+            return out;
+        }
+    }
+
+    TEST_CASE("PBM export", TAGS)
+    {
+        GridImageWriter writer = GridImageWriter(2);
+        std::string pbm = writer.renderPBM(makeImageTestGrid());
+
+        // 6 pixels wide: one byte per row, most significant bit first. Crossed cells are white.
+        std::string expected = std::string("P4\n6 4\n") + std::string("\xC0\xC0\xFC\xFC", 4);
+        REQUIRE(pbm == expected);
+    }
+
+    TEST_CASE("PGM export", TAGS)
+    {
+        GridImageWriter writer = GridImageWriter();
+        std::string pgm = writer.renderPGM(makeImageTestGrid());
+
+        std::string expected = std::string("P5\n3 2\n255\n") + std::string("\x00\xFF\xC8\x00\x00\x00", 6);
+        REQUIRE(pgm == expected);
+    }
+
+    TEST_CASE("PNG export", TAGS)
+    {
+        SECTION("Small grid")
+        {
+            GridImageWriter writer = GridImageWriter(2);
+            std::string header, imageData;
+            readPNGChunks(writer.renderPNG(makeImageTestGrid()), header, imageData);
+
+            // 6x4 pixels, 8-bit greyscale.
+            REQUIRE(header == std::string("\x00\x00\x00\x06\x00\x00\x00\x04\x08\x00\x00\x00\x00", 13));
+
+            std::string firstRow = std::string("\x00\x00\x00\xFF\xFF\xC8\xC8", 7);
+            std::string secondRow = std::string(1, '\0') + std::string(6, '\0');
+            REQUIRE(unstore(imageData) == firstRow + firstRow + secondRow + secondRow);
+        }
+
+        SECTION("Image data spanning several deflate blocks")
+        {
+            XMLGridSerialzer xml = XMLGridSerialzer();
+            Grid g = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+
+            // 320x320 pixels: more than 65535 bytes of scanlines.
+            GridImageWriter writer = GridImageWriter(16);
+            std::string header, imageData;
+            readPNGChunks(writer.renderPNG(g), header, imageData);
+
+            std::string scanlines = unstore(imageData);
+            REQUIRE(scanlines.size() == 321 * 320);
+
+            // Same pixels as the PGM export, each scanline starting with filter type 0.
+            std::string pgm = writer.renderPGM(g);
+            std::string pixels = pgm.substr(pgm.size() - 320 * 320);
+            for (std::size_t y = 0; y < 320; y++)
+            {
+                REQUIRE(scanlines[y * 321] == '\0');
+                REQUIRE(scanlines.substr(y * 321 + 1, 320) == pixels.substr(y * 320, 320));
+            }
+        }
+    }
+
+    TEST_CASE("Image export errors", TAGS)
+    {
+        REQUIRE_THROWS_AS(GridImageWriter(0), ImageExportError);
+
+        GridImageWriter writer = GridImageWriter();
+        REQUIRE_THROWS_AS(writer.render(makeImageTestGrid(), ".bmp"), ImageExportError);
+        REQUIRE_THROWS_AS(writer.renderPNG(Grid(0, 0)), ImageExportError);
+        REQUIRE_THROWS_AS(writer.saveGridToFile(makeImageTestGrid(), "resources/tests/io/output.jpg"), ImageExportError);
+    }
+
+    TEST_CASE("Image file export", TAGS)
+    {
+        GridImageWriter writer = GridImageWriter(3);
+        writer.saveGridToFile(makeImageTestGrid(), "resources/tests/io/output.png");
+        REQUIRE(readBinaryFile("resources/tests/io/output.png") == writer.renderPNG(makeImageTestGrid()));
+    }
+
+    TEST_CASE("Archive image export", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        std::vector<Grid> grids;
+        for (int i = 0; i < 12; i++)
+        {
+            grids.push_back(i % 2 ? makeImageTestGrid() : xml.loadGridFromFile("resources/tests/io/20_20_solved.xml"));
+        }
+
+        {
+            GridArchiveWriter archive = GridArchiveWriter("resources/tests/io/output.pxga");
+            for (const Grid& g : grids)
+            {
+                archive.addGrid(g);
+            }
+            archive.close();
+        }
+
+        std::string outputDirectory = "resources/tests/io/output_images";
+        fs::remove_all(outputDirectory);
+
+        GridImageWriter writer = GridImageWriter(2);
+        GridImageWriter::BatchResult result = writer.exportArchive("resources/tests/io/output.pxga", outputDirectory, ".pgm", 4);
+        REQUIRE(result.written == grids.size());
+        REQUIRE(result.errors.empty());
+
+        // File names are padded so that they sort in archive order.
+        for (std::size_t i = 0; i < grids.size(); i++)
+        {
+            std::string name = (i < 10 ? "0" : "") + std::to_string(i) + ".pgm";
+            REQUIRE(readBinaryFile(outputDirectory + "/" + name) == writer.renderPGM(grids[i]));
+        }
+
+        REQUIRE_THROWS_AS(writer.exportArchive("resources/tests/io/output.pxga", outputDirectory, ".gif"), ImageExportError);
+        fs::remove_all(outputDirectory);
+    }
+
+    TEST_CASE("Image export benchmark", "[.][benchmark]")
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+        GridImageWriter writer = GridImageWriter(4);
+
+        BENCHMARK("PNG thumbnail of a 20x20 grid")
+        {
+            return writer.renderPNG(g).size();
+        };
+    }
+}
\ No newline at end of file
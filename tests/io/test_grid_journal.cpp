@@ -0,0 +1,138 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../generate_static_grids.hpp"
+#include "../../io/async_grid_saver.hpp"
+#include "../../io/grid_journal.hpp"
+#include "../../io/exceptions/invalid_grid_journal_error.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/grid_delta.hpp"
+
+#define TAGS "[io][journal][grid]"
+
+namespace fs = std::filesystem;
+
+namespace Picross
+{
+    namespace
+    {
+        // Write a few edits to a fresh journal and return the edited grid.
+        Grid writeEdits(GridJournal& journal, const Grid& base, int editCount)
+        {
+            journal.reset(base);
+            Grid edited = base;
+            for (int i = 0; i < editCount; i++)
+            {
+                Grid before = edited;
+                edited.setCell(i, (i * 3) % edited.getWidth(), CELL_CROSSED);
+                if (i % 2) edited.setRowHints(i, {});
+                journal.append(diff(before, edited));
+            }
+
+            return edited;
+        }
+    }
+
+    TEST_CASE("Grid journal replay", TAGS)
+    {
+        Grid base = generate10x10PartialGrid(true);
+        std::string basePath = "resources/tests/io/journal_base.xml";
+        GridJournal journal = GridJournal(basePath);
+        REQUIRE(journal.getJournalPath() == basePath + ".journal");
+
+        Grid edited = writeEdits(journal, base, 5);
+        REQUIRE(journal.recordCount() == 5);
+
+        SECTION("All edits are replayed")
+        {
+            Grid replayed = base;
+            REQUIRE(GridJournal::replay(journal.getJournalPath(), replayed) == 5);
+            REQUIRE(replayed == edited);
+        }
+
+        SECTION("A torn record is ignored")
+        {
+            std::uintmax_t size = fs::file_size(journal.getJournalPath());
+            fs::resize_file(journal.getJournalPath(), size - 2);
+
+            Grid replayed = base;
+            REQUIRE(GridJournal::replay(journal.getJournalPath(), replayed) == 4);
+        }
+
+        SECTION("A corrupted record stops the replay")
+        {
+            {
+                std::fstream f = std::fstream(journal.getJournalPath(), std::ios::in | std::ios::out | std::ios::binary);
+                f.seekp(-1, std::ios::end);
+                f.put('\x7F');
+            }
+
+            Grid replayed = base;
+            REQUIRE(GridJournal::replay(journal.getJournalPath(), replayed) == 4);
+        }
+
+        SECTION("Edits of other grids are rejected")
+        {
+            Grid other = Grid(3, 4);
+            REQUIRE_THROWS_AS(GridJournal::replay(journal.getJournalPath(), other), InvalidGridJournalError);
+        }
+
+        SECTION("Replaying edits over a compacted grid is harmless")
+        {
+            Grid replayed = edited;
+            REQUIRE(GridJournal::replay(journal.getJournalPath(), replayed) == 5);
+            REQUIRE(replayed == edited);
+        }
+
+        SECTION("Compaction")
+        {
+            journal.compact(edited);
+            REQUIRE(journal.recordCount() == 0);
+
+            XMLGridSerialzer xml = XMLGridSerialzer();
+            REQUIRE(xml.loadGridFromFile(basePath) == edited);
+
+            Grid replayed = edited;
+            REQUIRE(GridJournal::replay(journal.getJournalPath(), replayed) == 0);
+
+            journal.discard();
+            REQUIRE_FALSE(fs::exists(journal.getJournalPath()));
+        }
+    }
+
+    TEST_CASE("Grid journal compaction behind background saves", TAGS)
+    {
+        Grid base = generate10x10PartialGrid(true);
+        std::string basePath = "resources/tests/io/journal_base.xml";
+        std::shared_ptr<AsyncGridSaver> saver = std::make_shared<AsyncGridSaver>();
+        GridJournal journal = GridJournal(basePath, saver);
+        Grid edited = writeEdits(journal, base, 5);
+
+        // A save of the older grid still queued must not end up over the compacted file.
+        for (int i = 0; i < 10; i++)
+        {
+            saver->save(base, basePath);
+        }
+        journal.compact(edited);
+        REQUIRE(saver->pendingSaves() == 0);
+
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        REQUIRE(xml.loadGridFromFile(basePath) == edited);
+        journal.discard();
+    }
+
+    TEST_CASE("Journaled base files", TAGS)
+    {
+        REQUIRE(GridJournal::canJournal("resources/tests/io/10_10_partial.xml"));
+        REQUIRE(GridJournal::canJournal("resources/tests/io/not_written_yet.xml"));
+        REQUIRE(GridJournal::canJournal("resources/tests/io/grid.pxgb"));
+        REQUIRE_FALSE(GridJournal::canJournal("resources/tests/formats/5_5_webpbn.xml"));
+        REQUIRE_FALSE(GridJournal::canJournal("resources/tests/formats/5_5_tatham.non"));
+        REQUIRE_FALSE(GridJournal::canJournal("resources/tests/formats/5_5_olsak.g"));
+    }
+}
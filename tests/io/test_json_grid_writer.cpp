@@ -0,0 +1,130 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include "../../io/json_grid_writer.hpp"
+#include "../../io/ndjson_result_writer.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[io][json][grid]"
+
+namespace Picross
+{
+    namespace
+    {
+        // 3x2 grid: checked, cleared, crossed on the first row, all checked on the second one.
+        Grid makeJSONTestGrid()
+        {
+            Grid g = Grid(3, 2);
+            g.setCell(0, 0, CELL_CHECKED);
+            g.setCell(0, 2, CELL_CROSSED);
+            g.setCellRange(1, 1, 0, 2, CELL_CHECKED);
+            g.setHintsFromState();
+            return g;
+        }
+    }
+
+    TEST_CASE("Grid JSON output", TAGS)
+    {
+        JSONGridWriter writer = JSONGridWriter();
+
+        SECTION("Small grid")
+        {
+            // Cells 2,1,0,2 then 2,2 packed from the low bits: 0x86 0x0A.
+            std::string expected = "{\"width\":3,\"height\":2,\"rows\":[[1],[3]],\"columns\":[[2],[1],[1]],\"cells\":\"hgo=\"}";
+            REQUIRE(writer.writeGrid(makeJSONTestGrid()) == expected);
+
+            std::ostringstream os;
+            writer.writeGrid(os, makeJSONTestGrid());
+            REQUIRE(os.str() == expected);
+        }
+
+        SECTION("Empty grid")
+        {
+            REQUIRE(writer.writeGrid(Grid(0, 0)) == "{\"width\":0,\"height\":0,\"rows\":[],\"columns\":[],\"cells\":\"\"}");
+        }
+
+        SECTION("Base64 padding")
+        {
+            // 12 cells fill 3 bytes exactly, which need no padding.
+            Grid g = Grid(4, 3);
+            std::string json = writer.writeGrid(g);
+            REQUIRE(json.substr(json.size() - 7) == "\"VVVV\"}");
+        }
+    }
+
+    TEST_CASE("JSON string escaping", TAGS)
+    {
+        std::string out;
+        JSONGridWriter::appendString(out, "plain");
+        REQUIRE(out == "\"plain\"");
+
+        out.clear();
+        JSONGridWriter::appendString(out, std::string("a\"b\\c\nd\te\x01", 10));
+        REQUIRE(out == "\"a\\\"b\\\\c\\nd\\te\\u0001\"");
+    }
+
+    TEST_CASE("NDJSON result output", TAGS)
+    {
+        Grid g = makeJSONTestGrid();
+        std::ostringstream os;
+
+        {
+            NDJSONResultWriter writer = NDJSONResultWriter(os);
+            writer.write({"puzzles/1.xml", NDJSONResultWriter::Status::Solved, std::chrono::microseconds(1500), {{"passes", 4}, {"guesses", 0}}, &g, ""});
+            writer.write({"2", NDJSONResultWriter::Status::Contradiction, std::chrono::nanoseconds(999), {}, nullptr, ""});
+            REQUIRE(writer.written() == 2);
+
+            // Lines are held back until the writer is flushed.
+            REQUIRE(os.str().empty());
+        }
+
+        std::string expected = "{\"id\":\"puzzles/1.xml\",\"status\":\"solved\",\"timeUs\":1500,\"stats\":{\"passes\":4,\"guesses\":0},\"grid\":"
+                             + JSONGridWriter().writeGrid(g) + "}\n"
+                             + "{\"id\":\"2\",\"status\":\"contradiction\",\"timeUs\":0,\"stats\":{}}\n";
+        REQUIRE(os.str() == expected);
+    }
+
+    TEST_CASE("NDJSON buffered output", TAGS)
+    {
+        std::ostringstream os;
+        NDJSONResultWriter writer = NDJSONResultWriter(os);
+
+        std::string line;
+        NDJSONResultWriter::Result result = {"puzzle", NDJSONResultWriter::Status::Unsolved, std::chrono::milliseconds(2), {{"passes", 1}}, nullptr, ""};
+        writer.appendResult(line, result);
+
+        std::size_t count = NDJSONResultWriter::FLUSH_THRESHOLD / line.size() + 1;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            writer.write(result);
+        }
+
+        // The buffer went past its threshold and was written out, nothing is left behind on flush.
+        REQUIRE(os.str().size() == count * line.size());
+        writer.flush();
+        REQUIRE(os.str().size() == count * line.size());
+    }
+
+    TEST_CASE("NDJSON output benchmark", "[.][benchmark]")
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+
+        BENCHMARK("10000 result lines with 20x20 grids")
+        {
+            std::ostringstream os;
+            NDJSONResultWriter writer = NDJSONResultWriter(os);
+            for (int i = 0; i < 10000; i++)
+            {
+                writer.write({std::to_string(i), NDJSONResultWriter::Status::Solved, std::chrono::microseconds(i), {{"passes", i}}, &g, ""});
+            }
+            writer.flush();
+            return os.str().size();
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <string>
+#include <vector>
+
+#include "../generate_static_grids.hpp"
+#include "../../io/non_grid_serializer.hpp"
+#include "../../io/exceptions/invalid_nonogram_file_error.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/exceptions/invalid_grid_hints_error.hpp"
+
+#define TAGS "[io][non][grid][serialization]"
+
+namespace Picross
+{
+    namespace
+    {
+        Grid loadNonString(const std::string& text)
+        {
+            NonGridSerializer non = NonGridSerializer();
+            return non.loadGridFromBuffer(text.data(), text.size());
+        }
+    }
+
+    TEST_CASE(".non deserialization", TAGS)
+    {
+        NonGridSerializer non = NonGridSerializer();
+
+        SECTION("Regular puzzle")
+        {
+            Grid g = non.loadGridFromFile("resources/tests/formats/5_5_tatham.non");
+            REQUIRE(g.getWidth() == 5);
+            REQUIRE(g.getHeight() == 5);
+            REQUIRE(g.getAllRowHints() == std::vector<std::vector<int>>{{2, 1}, {3}, {1, 1}, {}, {5}});
+            REQUIRE(g.getAllColHints() == std::vector<std::vector<int>>{{1, 1, 1}, {2, 1}, {1, 1}, {2, 1}, {1, 1}});
+            REQUIRE(g == Grid(5, 5, g.getAllRowHints(), g.getAllColHints()));
+        }
+
+        SECTION("CRLF line endings, blank separators and explicit zeros")
+        {
+            Grid g = loadNonString("width 3\r\nheight 2\r\nrows\r\n1 1\r\n0\r\ncolumns\r\n1\r\n0\r\n1\r\n");
+            REQUIRE(g.getAllRowHints() == std::vector<std::vector<int>>{{1, 1}, {}});
+            REQUIRE(g.getAllColHints() == std::vector<std::vector<int>>{{1}, {}, {1}});
+        }
+
+        SECTION("Malformed files")
+        {
+            std::string text = GENERATE(as<std::string>{},
+                "width 2\nrows\n1\n1\ncolumns\n1\n1\n",             // rows before height
+                "width 2\nheight 2\nrows\n1\n1\n",                  // no columns
+                "width 2\nheight 2\nrows\n1\n1\ncolumns\n1\n",      // truncated section
+                "width 2\nheight 2\nrows\n1\na\ncolumns\n1\n1\n",   // invalid clue
+                "width two\nheight 2\nrows\n1\n1\ncolumns\n1\n1\n"  // invalid dimension
+            );
+            REQUIRE_THROWS_AS(loadNonString(text), InvalidNonogramFileError);
+        }
+
+        SECTION("Clues not fitting the grid")
+        {
+            REQUIRE_THROWS_AS(loadNonString("width 2\nheight 1\nrows\n3\ncolumns\n1\n1\n"), InvalidGridHintsError);
+        }
+    }
+
+    TEST_CASE(".non serialization", TAGS)
+    {
+        NonGridSerializer non = NonGridSerializer();
+        Grid reference = generate10x10PartialGrid(true);
+
+        std::string text = non.saveGridToString(reference);
+        REQUIRE(text.find("width 10\nheight 10\n") == 0);
+
+        non.saveGridToFile(reference, "resources/tests/formats/output.non");
+        Grid g = non.loadGridFromFile("resources/tests/formats/output.non");
+        REQUIRE(g.getAllRowHints() == reference.getAllRowHints());
+        REQUIRE(g.getAllColHints() == reference.getAllColHints());
+    }
+
+    TEST_CASE(".non import benchmark", "[.][benchmark]")
+    {
+        // A few thousand large clue-only puzzles in a single buffer.
+        Grid reference = Grid(100, 100);
+        for (int i = 0; i < 100; i++)
+        {
+            for (int j = 0; j < 100; j++)
+            {
+                if ((i * 7 + j * 3) % 5 < 2) reference.setCell(i, j, CELL_CHECKED);
+            }
+        }
+        reference.setHintsFromState();
+
+        NonGridSerializer non = NonGridSerializer();
+        std::string text = non.saveGridToString(reference);
+
+        BENCHMARK("Parse a 100x100 .non puzzle")
+        {
+            return non.loadGridFromBuffer(text.data(), text.size()).getWidth();
+        };
+    }
+}
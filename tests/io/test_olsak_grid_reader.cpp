@@ -0,0 +1,38 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <string>
+#include <vector>
+
+#include "../../io/olsak_grid_reader.hpp"
+#include "../../io/exceptions/invalid_nonogram_file_error.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[io][olsak][grid]"
+
+namespace Picross
+{
+    TEST_CASE("Olsak .g deserialization", TAGS)
+    {
+        OlsakGridReader olsak = OlsakGridReader();
+
+        SECTION("Regular puzzle")
+        {
+            Grid g = olsak.loadGridFromFile("resources/tests/formats/5_5_olsak.g");
+            REQUIRE(g.getWidth() == 5);
+            REQUIRE(g.getHeight() == 5);
+            REQUIRE(g.getAllRowHints() == std::vector<std::vector<int>>{{2, 1}, {3}, {1, 1}, {}, {5}});
+            REQUIRE(g.getAllColHints() == std::vector<std::vector<int>>{{1, 1, 1}, {2, 1}, {1, 1}, {2, 1}, {1, 1}});
+        }
+
+        SECTION("Coloured puzzles are rejected")
+        {
+            REQUIRE_THROWS_AS(olsak.loadGridFromFile("resources/tests/formats/5_5_coloured.g"), InvalidNonogramFileError);
+        }
+
+        SECTION("Missing column section")
+        {
+            std::string text = "# comment\n: rows\n1\n";
+            REQUIRE_THROWS_AS(olsak.loadGridFromBuffer(text.data(), text.size()), InvalidNonogramFileError);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <string>
+#include <vector>
+
+#include "../../io/row_rle.hpp"
+#include "../../core/cell_t.hpp"
+
+#define TAGS "[io][xml][rle]"
+
+namespace Picross
+{
+    TEST_CASE("Row run-length encoding", TAGS)
+    {
+        std::vector<cell_t> cells = { CELL_CLEARED, CELL_CLEARED, CELL_CLEARED, CELL_CHECKED, CELL_CROSSED, CELL_CROSSED };
+        REQUIRE(encodeRowRLE(cells.data(), (int) cells.size()) == "3.#2x");
+
+        std::vector<cell_t> full = std::vector<cell_t>(12, CELL_CHECKED);
+        REQUIRE(encodeRowRLE(full.data(), (int) full.size()) == "12#");
+        REQUIRE(encodeRowRLE(nullptr, 0) == "");
+    }
+
+    TEST_CASE("Row run-length decoding", TAGS)
+    {
+        std::vector<cell_t> cells = std::vector<cell_t>(6);
+
+        SECTION("Valid rows")
+        {
+            REQUIRE(decodeRowRLE("3.#2x", cells.data(), 6));
+            REQUIRE(cells == std::vector<cell_t>({ CELL_CLEARED, CELL_CLEARED, CELL_CLEARED, CELL_CHECKED, CELL_CROSSED, CELL_CROSSED }));
+
+            REQUIRE(decodeRowRLE(" 2# \n 4x ", cells.data(), 6));
+            REQUIRE(cells == std::vector<cell_t>({ CELL_CHECKED, CELL_CHECKED, CELL_CROSSED, CELL_CROSSED, CELL_CROSSED, CELL_CROSSED }));
+        }
+
+        SECTION("Invalid rows")
+        {
+            std::string text = GENERATE(as<std::string>{}, "", "5.", "7.", "3.#2x#", "3.3", "0#6.", "6?", "99999999999999#");
+            REQUIRE_FALSE(decodeRowRLE(text, cells.data(), 6));
+        }
+    }
+}
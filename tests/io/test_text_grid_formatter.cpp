@@ -1,9 +1,14 @@
 #include "../../lib/catch2/catch2.hpp"
 
+#include <sstream>
+#include <string>
+
 #include "../../io/text_grid_formatter.hpp"
 #include "../../io/xml_grid_serializer.hpp"
+#include "../../io/grid_streams.hpp"
 #include "../../core/grid.hpp"
 #include "../../tools/string_tools.hpp"
+#include "../debugging_tools.hpp"
 
 #define TAGS "[io][text][grid][formatting]"
 
@@ -56,4 +61,133 @@ namespace Picross
         TextGridFormatter txt = TextGridFormatter();
         REQUIRE(txt.renderGridWithHints(g) == expected);
     }
+
+    TEST_CASE("Grid text render into a stream", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+        TextGridFormatter txt = TextGridFormatter();
+
+        SECTION("With hints")
+        {
+            std::ostringstream os;
+            txt.renderGridWithHints(os, g);
+            REQUIRE(os.str() == StringTools::readFileIntoString("resources/tests/io/20_20_solved_formatted.txt"));
+        }
+        SECTION("Without hints")
+        {
+            std::ostringstream os;
+            txt.renderGrid(os, g, false, 2);
+            REQUIRE(os.str() == txt.renderGrid(g, false, 2));
+        }
+        SECTION("Stream operator")
+        {
+            std::ostringstream os;
+            os << g;
+            REQUIRE(os.str() == txt.renderGridWithHints(g));
+        }
+    }
+
+    TEST_CASE("Grid text render size is computed exactly", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/io/10_10_partial.xml");
+
+        // Characters of different byte lengths in every cell state.
+        TextGridFormatter txt = TextGridFormatter("■", ".", "×");
+
+        REQUIRE(txt.renderedSize(g, true) == txt.renderGridWithHints(g).size());
+        REQUIRE(txt.renderedSize(g, false, false, 3) == txt.renderGrid(g, false, 3).size());
+        REQUIRE(txt.renderedSize(g, false, true) == txt.renderGrid(g, true).size());
+    }
+
+    TEST_CASE("Grid text render with emptied crossed cells", TAGS)
+    {
+        Grid g = Grid(3, 1);
+        g.setCell(0, 0, CELL_CHECKED);
+        g.setCell(0, 1, CELL_CROSSED);
+
+        TextGridFormatter txt = TextGridFormatter();
+        REQUIRE(txt.renderGrid(g, true) == "╔═╦═╦═╗\n║■║ ║ ║\n╚═╩═╩═╝\n");
+    }
+
+    TEST_CASE("Grid text render with cached hints", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/io/10_10_partial.xml");
+        Grid solved = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+        std::string expected = StringTools::readFileIntoString("resources/tests/io/10_10_partial_formatted_with_hints.txt");
+        std::string expectedSolved = StringTools::readFileIntoString("resources/tests/io/20_20_solved_formatted.txt");
+
+        // The same formatter alternates between grids.
+        TextGridFormatter txt = TextGridFormatter();
+        REQUIRE(txt.renderGridWithHints(g) == expected);
+        REQUIRE(txt.renderGridWithHints(solved) == expectedSolved);
+        REQUIRE(txt.renderGridWithHints(g) == expected);
+
+        SECTION("Cell changes show up with unchanged hints")
+        {
+            Grid modified = g;
+            modified.setCell(0, 0, CELL_CROSSED);
+            REQUIRE(txt.renderGridWithHints(modified) == TextGridFormatter().renderGridWithHints(modified));
+            REQUIRE(txt.renderGridWithHints(modified) != expected);
+        }
+
+        SECTION("Hint changes show up")
+        {
+            Grid modified = g;
+            modified.setRowHints(0, {1, 1, 1, 1});
+            modified.setColHints(0, {10});
+            REQUIRE(txt.renderGridWithHints(modified) == TextGridFormatter().renderGridWithHints(modified));
+
+            modified.clearAllHints();
+            REQUIRE(txt.renderGridWithHints(modified) == txt.renderGrid(modified));
+        }
+    }
+
+    TEST_CASE("Grid text render allocations do not depend on the height of the grid", TAGS)
+    {
+        Grid shortGrid = Grid(200, 2);
+        Grid tallGrid = Grid(200, 200);
+        shortGrid.setCellRange(0, 1, 0, 99, CELL_CHECKED);
+        tallGrid.setCellRange(0, 199, 0, 99, CELL_CHECKED);
+
+        TextGridFormatter txt = TextGridFormatter();
+        auto allocations = [&txt] (const Grid& g)
+        {
+            std::size_t before = threadAllocationCount();
+            std::string render = txt.renderGrid(g);
+            return threadAllocationCount() - before;
+        };
+
+        REQUIRE(allocations(tallGrid) == allocations(shortGrid));
+    }
+
+    TEST_CASE("Grid text render benchmark", "[.][benchmark]")
+    {
+        Grid g = Grid(200, 200);
+        for (int i = 0; i < 200; i++)
+        {
+            for (int j = 0; j < 200; j++)
+            {
+                if ((i * 7 + j * 3) % 5 < 2) g.setCell(i, j, CELL_CHECKED);
+                else if ((i + j) % 7 == 0) g.setCell(i, j, CELL_CROSSED);
+            }
+        }
+        g.setHintsFromState();
+
+        TextGridFormatter txt = TextGridFormatter();
+
+        BENCHMARK("Render a 200x200 grid with hints")
+        {
+            return txt.renderGridWithHints(g).size();
+        };
+
+        BENCHMARK("Stream a 200x200 grid with hints")
+        {
+            std::ostringstream os;
+            txt.renderGridWithHints(os, g);
+            return os.str().size();
+        };
+    }
 }
\ No newline at end of file
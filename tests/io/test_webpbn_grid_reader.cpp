@@ -0,0 +1,71 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <string>
+#include <vector>
+
+#include "../../io/webpbn_grid_reader.hpp"
+#include "../../io/exceptions/invalid_nonogram_file_error.hpp"
+#include "../../io/exceptions/tinyxml2_error.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[io][webpbn][grid]"
+
+namespace Picross
+{
+    namespace
+    {
+        Grid loadWebpbnString(const std::string& text)
+        {
+            WebpbnGridReader webpbn = WebpbnGridReader();
+            return webpbn.loadGridFromBuffer(text.data(), text.size());
+        }
+    }
+
+    TEST_CASE("webpbn XML deserialization", TAGS)
+    {
+        SECTION("Regular puzzle")
+        {
+            WebpbnGridReader webpbn = WebpbnGridReader();
+            Grid g = webpbn.loadGridFromFile("resources/tests/formats/5_5_webpbn.xml");
+            REQUIRE(g.getWidth() == 5);
+            REQUIRE(g.getHeight() == 5);
+            REQUIRE(g.getAllRowHints() == std::vector<std::vector<int>>{{2, 1}, {3}, {1, 1}, {}, {5}});
+            REQUIRE(g.getAllColHints() == std::vector<std::vector<int>>{{1, 1, 1}, {2, 1}, {1, 1}, {2, 1}, {1, 1}});
+        }
+
+        SECTION("Bare puzzle element")
+        {
+            Grid g = loadWebpbnString("<puzzle><clues type=\"rows\"><line><count>1</count></line></clues>"
+                                      "<clues type=\"columns\"><line><count>1</count></line></clues></puzzle>");
+            REQUIRE(g.getAllRowHints() == std::vector<std::vector<int>>{{1}});
+            REQUIRE(g.getAllColHints() == std::vector<std::vector<int>>{{1}});
+        }
+
+        SECTION("Unsupported or incomplete puzzles")
+        {
+            std::string text = GENERATE(as<std::string>{},
+                "<puzzleset><title>Nothing</title></puzzleset>",
+                "<puzzle><clues type=\"rows\"><line><count>1</count></line></clues></puzzle>",
+                "<puzzle><clues type=\"diagonals\"></clues></puzzle>",
+                "<puzzle><clues type=\"rows\"><line><count>one</count></line></clues></puzzle>",
+                "<puzzle><color name=\"white\"/><color name=\"black\"/><color name=\"red\"/>"
+                "<clues type=\"rows\"><line/></clues><clues type=\"columns\"><line/></clues></puzzle>"
+            );
+            REQUIRE_THROWS_AS(loadWebpbnString(text), InvalidNonogramFileError);
+        }
+
+        SECTION("Malformed XML")
+        {
+            REQUIRE_THROWS_AS(loadWebpbnString("<puzzle><clues type=\"rows\">"), tinyxml2::TinyXML2Error);
+        }
+    }
+
+    TEST_CASE("webpbn document detection", TAGS)
+    {
+        std::string webpbn = "<?xml version=\"1.0\"?>\n<!DOCTYPE pbn SYSTEM \"pbn-0.3.dtd\">\n<puzzleset></puzzleset>";
+        std::string native = "<?xml version=\"1.0\"?>\n<grid></grid>";
+        REQUIRE(WebpbnGridReader::isWebpbnDocument(webpbn.data(), webpbn.size()));
+        REQUIRE_FALSE(WebpbnGridReader::isWebpbnDocument(native.data(), native.size()));
+        REQUIRE_FALSE(WebpbnGridReader::isWebpbnDocument("", 0));
+    }
+}
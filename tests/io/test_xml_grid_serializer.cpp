@@ -1,7 +1,15 @@
 #include "../../lib/catch2/catch2.hpp"
 
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
 #include "../generate_static_grids.hpp"
+#include "../../lib/tinyxml2/tinyxml2.hpp"
 #include "../../io/xml_grid_serializer.hpp"
+#include "../../io/exceptions/tinyxml2_error.hpp"
+#include "../../io/exceptions/xml_grid_write_error.hpp"
 #include "../../core/grid.hpp"
 
 #define TAGS "[io][xml][grid][serialization]"
@@ -36,4 +44,82 @@ namespace Picross
         Grid g = xml.loadGridFromFile("resources/tests/io/output.xml");
         REQUIRE(g == generate10x10PartialGrid(true));
     }
-}
+
+    TEST_CASE("XML serialization write failures", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        REQUIRE_THROWS_AS(xml.saveGridToFile(generate10x10PartialGrid(true), "resources/tests/io/missing_directory/output.xml"), tinyxml2::TinyXML2Error);
+
+        // Every write to this device fails for lack of space.
+        if (std::filesystem::exists("/dev/full"))
+        {
+            REQUIRE_THROWS_AS(xml.saveGridToFile(generate10x10PartialGrid(true), "/dev/full"), XMLGridWriteError);
+        }
+    }
+
+    TEST_CASE("XML serialization output matches tinyxml2 document printing", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+        xml.saveGridToFile(g, "resources/tests/io/output.xml");
+
+        std::ifstream f = std::ifstream("resources/tests/io/output.xml", std::ios::binary);
+        std::stringstream written;
+        written << f.rdbuf();
+
+        // Printing the document parsed from the output gives back the exact same text.
+        tinyxml2::XMLDocument doc;
+        REQUIRE(doc.LoadFile("resources/tests/io/output.xml") == tinyxml2::XML_SUCCESS);
+        tinyxml2::XMLPrinter printer;
+        doc.Print(&printer);
+        REQUIRE(written.str() == std::string(printer.CStr()));
+    }
+
+    TEST_CASE("XML run-length encoded rows", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+
+        SECTION("Dense rows are run-length encoded")
+        {
+            Grid g = Grid(20, 20);
+            for (int i = 0; i < 20; i++)
+            {
+                for (int j = 0; j < 20; j++)
+                {
+                    if ((i + j / 3) % 2) g.setCell(i, j, (j % 5) ? CELL_CHECKED : CELL_CROSSED);
+                }
+            }
+            g.setHintsFromState();
+            xml.saveGridToFile(g, "resources/tests/io/output.xml");
+
+            std::ifstream f = std::ifstream("resources/tests/io/output.xml", std::ios::binary);
+            std::stringstream written;
+            written << f.rdbuf();
+            REQUIRE(written.str().find("<row index=") != std::string::npos);
+            REQUIRE(written.str().find("<cell ") == std::string::npos);
+
+            REQUIRE(xml.loadGridFromFile("resources/tests/io/output.xml") == g);
+        }
+
+        SECTION("Encoded output is smaller than single cells")
+        {
+            xml.saveGridToFile(generate10x10PartialGrid(true), "resources/tests/io/output.xml");
+            REQUIRE(xml.loadGridFromFile("resources/tests/io/output.xml") == generate10x10PartialGrid(true));
+
+            // The reference file was written with single cells only.
+            std::ifstream original = std::ifstream("resources/tests/io/10_10_partial.xml", std::ios::binary | std::ios::ate);
+            std::ifstream output = std::ifstream("resources/tests/io/output.xml", std::ios::binary | std::ios::ate);
+            REQUIRE(output.tellg() < original.tellg());
+        }
+
+        SECTION("Rows and cells can be mixed, in document order")
+        {
+            Grid g = Grid(3, 2);
+            g.setCell(0, 0, CELL_CHECKED);
+            g.setCell(0, 2, CELL_CROSSED);
+            g.setCell(1, 1, CELL_CHECKED);
+            Grid loaded = xml.loadGridFromFile("resources/tests/io/3_2_mixed_rows.xml");
+            REQUIRE(loaded == g);
+        }
+    }
+}
\ No newline at end of file
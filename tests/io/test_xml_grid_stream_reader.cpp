@@ -0,0 +1,148 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <fstream>
+#include <string>
+
+#include "../generate_static_grids.hpp"
+#include "../../io/xml_grid_stream_reader.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../io/exceptions/invalid_xml_grid_error.hpp"
+#include "../../io/exceptions/tinyxml2_error.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/exceptions/invalid_grid_hints_error.hpp"
+
+#define TAGS "[io][xml][grid][serialization][stream]"
+
+namespace Picross
+{
+    namespace
+    {
+        // Load a file with both loaders and return the error messages they raised (empty if none).
+        std::pair<std::string, std::string> loadWithBoth(const std::string& path)
+        {
+            std::string domError, streamError;
+            try { XMLGridSerialzer().loadGridFromFile(path); }
+            catch(const std::exception& e) { domError = e.what(); }
+            try { XMLGridStreamReader().loadGridFromFile(path); }
+            catch(const std::exception& e) { streamError = e.what(); }
+            return { domError, streamError };
+        }
+
+        void writeFile(const std::string& path, const std::string& contents)
+        {
+            std::ofstream f = std::ofstream(path, std::ios::binary | std::ios::trunc);
+            f << contents;
+        }
+    }
+
+    TEST_CASE("Streaming XML deserialization", TAGS)
+    {
+        std::string path = GENERATE(as<std::string>{},
+            "resources/tests/io/10_10_partial.xml",
+            "resources/tests/io/10_10_partial_empty.xml",
+            "resources/tests/io/20_20_solved.xml",
+            "resources/tests/picross_cli/5_10_completed.xml",
+            "resources/tests/picross_cli/5_10_hints_only.xml",
+            "resources/tests/io/3_2_mixed_rows.xml"
+        );
+
+        XMLGridSerialzer dom = XMLGridSerialzer();
+        XMLGridStreamReader stream = XMLGridStreamReader();
+        REQUIRE(stream.loadGridFromFile(path) == dom.loadGridFromFile(path));
+    }
+
+    TEST_CASE("Streaming XML deserialization of a saved grid", TAGS)
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        xml.saveGridToFile(generate10x10PartialGrid(true), "resources/tests/io/output.xml");
+
+        XMLGridStreamReader stream = XMLGridStreamReader();
+        REQUIRE(stream.loadGridFromFile("resources/tests/io/output.xml") == generate10x10PartialGrid(true));
+    }
+
+    TEST_CASE("Streaming XML deserialization of unusual layouts", TAGS)
+    {
+        XMLGridStreamReader stream = XMLGridStreamReader();
+        std::string hints = "<hints><horizontal><entry><hintValue>2</hintValue></entry><entry/></horizontal>"
+                            "<vertical><entry><hintValue>1</hintValue></entry><entry><hintValue>1</hintValue></entry></vertical></hints>";
+        std::string content = "<content default=\"cleared\"><cell row=\"0\" col=\"0\" state=\"checked\"/><cell row=\"0\" col=\"1\" state=\"checked\"/></content>";
+
+        Grid expected = Grid(2, 2, {{2}, {}}, {{1}, {1}});
+        expected.setCell(0, 0, CELL_CHECKED);
+        expected.setCell(0, 1, CELL_CHECKED);
+
+        SECTION("Content before hints, comments and declaration")
+        {
+            std::string doc = "<?xml version=\"1.0\"?>\n<!-- comment -->\n<grid width=\"2\" height=\"2\">" + content + "<!-- <cell row=\"1\"/> -->" + hints + "</grid>";
+            REQUIRE(stream.loadGridFromBuffer(doc.data(), doc.size()) == expected);
+        }
+
+        SECTION("Unknown elements and repeated sections are ignored")
+        {
+            std::string doc = "<grid width=\"2\" height=\"2\"><extra><cell row=\"9\" col=\"9\" state=\"bogus\"/></extra>"
+                              + hints + content + "<content default=\"crossed\"/></grid>";
+            REQUIRE(stream.loadGridFromBuffer(doc.data(), doc.size()) == expected);
+        }
+    }
+
+    TEST_CASE("Streaming XML deserialization raises the same errors", TAGS)
+    {
+        std::string header = "<grid width=\"2\" height=\"1\">";
+        std::string hHints = "<horizontal><entry><hintValue>1</hintValue></entry></horizontal>";
+        std::string vHints = "<vertical><entry><hintValue>1</hintValue></entry><entry/></vertical>";
+        std::string content = "<content default=\"cleared\"><cell row=\"0\" col=\"0\" state=\"checked\"/></content>";
+
+        std::string doc = GENERATE_COPY(
+            // Sanity check: valid document.
+            header + "<hints>" + hHints + vHints + "</hints>" + content + "</grid>",
+            // Structural errors.
+            std::string("<notagrid/>"),
+            std::string("<grid height=\"1\"/>"),
+            std::string("<grid width=\"x\" height=\"1\"/>"),
+            header + content + "</grid>",
+            header + "<hints>" + vHints + "</hints>" + content + "</grid>",
+            header + "<hints>" + hHints + "</hints>" + content + "</grid>",
+            header + "<hints><horizontal/>" + vHints + "</hints>" + content + "</grid>",
+            header + "<hints>" + hHints + "<vertical><entry/></vertical></hints>" + content + "</grid>",
+            header + "<hints>" + hHints + vHints + "</hints></grid>",
+            // Value errors, reported in the same order as the DOM loader checks them.
+            header + "<hints><horizontal><entry><hintValue>a</hintValue></entry></horizontal></hints>" + content + "</grid>",
+            header + "<hints><horizontal><entry><hintValue/></entry></horizontal>" + vHints + "</hints>" + content + "</grid>",
+            header + "<hints><horizontal><entry><hintValue>3</hintValue></entry></horizontal>" + vHints + "</hints>" + content + "</grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content/></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"full\"/></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><cell row=\"1\" col=\"0\" state=\"checked\"/></content></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><cell col=\"0\" state=\"checked\"/></content></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><cell row=\"0\" col=\"0\"/></content></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><row index=\"1\">2.</row></content></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><row>2.</row></content></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><row index=\"0\">3.</row></content></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><row index=\"0\"/></content></grid>",
+            header + "<hints>" + hHints + vHints + "</hints><content default=\"cleared\"><row index=\"0\">#?</row><cell/></content></grid>",
+            header + content + "<content><row index=\"0\">#?</row></content><hints>" + hHints + vHints + "</hints></grid>",
+            // Hint errors win over content errors, even when the content comes first.
+            header + content + "<hints><horizontal><entry><hintValue>a</hintValue></entry></horizontal>" + vHints + "</hints></grid>"
+        );
+
+        std::string path = "resources/tests/io/stream_errors.xml";
+        writeFile(path, doc);
+        auto [domError, streamError] = loadWithBoth(path);
+        INFO(doc);
+        REQUIRE(streamError == domError);
+    }
+
+    TEST_CASE("Streaming XML deserialization of malformed documents", TAGS)
+    {
+        XMLGridStreamReader stream = XMLGridStreamReader();
+        std::string doc = GENERATE(as<std::string>{},
+            "",
+            "<grid width=\"2\" height=\"1\">",
+            "<grid width=\"2\" height=\"1\"></hints>",
+            "<grid width=2 height=\"1\"/>",
+            "<grid width=\"2\" height=\"1\"><!-- unterminated </grid>"
+        );
+
+        REQUIRE_THROWS_AS(stream.loadGridFromBuffer(doc.data(), doc.size()), tinyxml2::TinyXML2Error);
+        REQUIRE_THROWS_AS(stream.loadGridFromFile("resources/tests/io/does_not_exist.xml"), tinyxml2::TinyXML2Error);
+    }
+}
@@ -0,0 +1,152 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../picross_cli/cli_batch_solver.hpp"
+#include "../../io/grid_archive_writer.hpp"
+#include "../../core/grid.hpp"
+#include "../../tools/string_tools.hpp"
+
+#define TAGS "[cli][batch_solver]"
+
+namespace Picross
+{
+    namespace
+    {
+        CLIBatchSolver::Options parseBatchArguments(const std::vector<std::string>& args)
+        {
+            CLIBatchSolver::Options options;
+            std::ostringstream err;
+            REQUIRE(CLIBatchSolver::parseArguments(args, options, err));
+            REQUIRE(err.str().empty());
+            return options;
+        }
+
+        std::size_t countOccurrences(const std::string& s, const std::string& sub)
+        {
+            std::size_t count = 0;
+            for (std::size_t pos = s.find(sub); pos != std::string::npos; pos = s.find(sub, pos + 1))
+            {
+                count++;
+            }
+            return count;
+        }
+    }
+
+    TEST_CASE("Batch solve arguments", TAGS)
+    {
+        SECTION("Defaults")
+        {
+            CLIBatchSolver::Options options = parseBatchArguments({"a.xml", "b.xml"});
+            REQUIRE(options.solverName == CLIBatchSolver::DEFAULT_SOLVER);
+            REQUIRE(options.threadCount == 0);
+            REQUIRE(options.timeout.count() == 0);
+            REQUIRE(options.outputPath.empty());
+            REQUIRE_FALSE(options.writeGrids);
+            REQUIRE_FALSE(options.ordered);
+            REQUIRE(options.inputs == std::vector<std::string>({"a.xml", "b.xml"}));
+        }
+
+        SECTION("Every option")
+        {
+            CLIBatchSolver::Options options = parseBatchArguments({"--solver", "line", "--threads", "3", "--timeout", "250", "--output", "out.ndjson", "--grids", "--ordered", "grids"});
+            REQUIRE(options.solverName == "line");
+            REQUIRE(options.threadCount == 3);
+            REQUIRE(options.timeout == std::chrono::milliseconds(250));
+            REQUIRE(options.outputPath == "out.ndjson");
+            REQUIRE(options.writeGrids);
+            REQUIRE(options.ordered);
+            REQUIRE(options.inputs == std::vector<std::string>({"grids"}));
+
+            REQUIRE(parseBatchArguments({"--solver", "auto", "a.xml"}).solverName == CLIBatchSolver::AUTO_SOLVER);
+        }
+
+        SECTION("Invalid arguments")
+        {
+            CLIBatchSolver::Options options;
+            std::ostringstream err;
+            REQUIRE_FALSE(CLIBatchSolver::parseArguments({}, options, err));
+            REQUIRE_FALSE(CLIBatchSolver::parseArguments({"--solver", "simplex", "a.xml"}, options, err));
+            REQUIRE_FALSE(CLIBatchSolver::parseArguments({"--threads", "-1", "a.xml"}, options, err));
+            REQUIRE_FALSE(CLIBatchSolver::parseArguments({"--timeout"}, options, err));
+            REQUIRE_FALSE(CLIBatchSolver::parseArguments({"--fast", "a.xml"}, options, err));
+            REQUIRE(countOccurrences(err.str(), "\n") == 5);
+        }
+    }
+
+    TEST_CASE("Batch solve run", TAGS)
+    {
+        {
+            GridArchiveWriter archive = GridArchiveWriter("resources/tests/io/output.pxga");
+            archive.addGrid(Grid(2, 2, {{1}, {1}}, {{1}, {1}}));
+            archive.addGrid(Grid(3, 3, {{1, 1}, {}, {}}, {{1}, {1}, {}}));
+            archive.close();
+        }
+
+        CLIBatchSolver::Options options = parseBatchArguments({"--threads", "2", "--grids", "resources/tests/io/20_20_solved.xml", "resources/tests/io/output.pxga", "resources/tests/io/missing.xml"});
+
+        std::ostringstream out;
+        CLIBatchSolver::Summary summary = CLIBatchSolver(options).run(out);
+        REQUIRE(summary.total == 4);
+        REQUIRE(summary.solved == 2);
+        REQUIRE(summary.unsolved == 0);
+        REQUIRE(summary.contradictions == 1);
+        REQUIRE(summary.timeouts == 0);
+        REQUIRE(summary.errors == 1);
+
+        std::vector<std::string> lines = StringTools::tokenizeString(out.str(), '\n', true);
+        REQUIRE(lines.size() == 4);
+        REQUIRE(countOccurrences(out.str(), "\"status\":\"solved\"") == 2);
+        REQUIRE(countOccurrences(out.str(), "\"grid\":{") == 2);
+        REQUIRE(countOccurrences(out.str(), "{\"id\":\"resources/tests/io/output.pxga#1\",\"status\":\"contradiction\"") == 1);
+        REQUIRE(countOccurrences(out.str(), "{\"id\":\"resources/tests/io/missing.xml\",\"status\":\"error\"") == 1);
+
+        SECTION("Line solver")
+        {
+            options.solverName = "line";
+            options.writeGrids = false;
+            options.inputs = {"resources/tests/io/output.pxga"};
+
+            std::ostringstream lineOut;
+            summary = CLIBatchSolver(options).run(lineOut);
+            REQUIRE(summary.total == 2);
+            REQUIRE(summary.unsolved == 1);
+            REQUIRE(summary.contradictions == 1);
+            REQUIRE(countOccurrences(lineOut.str(), "\"grid\"") == 0);
+        }
+
+        SECTION("Solver picked for each grid")
+        {
+            // Line deductions do not solve every grid, grids go to the backtracking solver.
+            options.solverName = CLIBatchSolver::AUTO_SOLVER;
+            options.timeout = std::chrono::milliseconds(10000);
+            options.inputs = {"resources/tests/io/output.pxga"};
+
+            std::ostringstream autoOut;
+            summary = CLIBatchSolver(options).run(autoOut);
+            REQUIRE(summary.total == 2);
+            REQUIRE(summary.solved == 1);
+            REQUIRE(summary.contradictions == 1);
+            REQUIRE(countOccurrences(autoOut.str(), "\"guesses\":") == 2);
+        }
+
+        SECTION("Ordered results")
+        {
+            options.ordered = true;
+            options.inputs = {"resources/tests/io/output.pxga", "resources/tests/io/20_20_solved.xml", "resources/tests/io/output.pxga"};
+
+            std::ostringstream orderedOut;
+            CLIBatchSolver(options).run(orderedOut);
+            lines = StringTools::tokenizeString(orderedOut.str(), '\n', true);
+            REQUIRE(lines.size() == 5);
+            REQUIRE(lines[0].substr(0, 40) == "{\"id\":\"resources/tests/io/output.pxga#0\"");
+            REQUIRE(lines[1].substr(0, 40) == "{\"id\":\"resources/tests/io/output.pxga#1\"");
+            REQUIRE(lines[2].substr(0, 43) == "{\"id\":\"resources/tests/io/20_20_solved.xml\"");
+            REQUIRE(lines[3].substr(0, 40) == "{\"id\":\"resources/tests/io/output.pxga#0\"");
+            REQUIRE(lines[4].substr(0, 40) == "{\"id\":\"resources/tests/io/output.pxga#1\"");
+        }
+    }
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "../../lib/catch2/catch2.hpp"
 
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include "../../picross_cli/picross_cli_state.hpp"
@@ -7,6 +8,8 @@
 #include "../../core/grid.hpp"
 #include "../../core/cell_t.hpp"
 #include "../../io/xml_grid_serializer.hpp"
+#include "../../io/grid_journal.hpp"
+#include "../../core/grid_delta.hpp"
 #include "../../tools/string_tools.hpp"
 
 #define TAGS "[cli][cli_command]"
@@ -43,4 +46,38 @@ namespace Picross
 
         f.close();
     }
+
+    TEST_CASE("CLIModifyGridCommand journal recovery", TAGS)
+    {
+        std::string basePath = "resources/tests/picross_cli/journaled_grid.xml";
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/picross_cli/5_10_completed.xml");
+        xml.saveGridToFile(g, basePath);
+
+        // Simulate a session which was interrupted after an edit.
+        Grid edited = g;
+        edited.setCellRange(0, 4, 0, 0, CELL_CROSSED);
+        {
+            GridJournal journal = GridJournal(basePath);
+            journal.reset(g);
+            journal.append(diff(g, edited));
+        }
+
+        std::stringstream input = std::stringstream("commit\nexit\n");
+        std::stringstream ss;
+        CLIStreams s = CLIStreams(input, ss, ss);
+        PicrossCLIState state = PicrossCLIState();
+        state.grid() = g;
+        state.gridPath() = basePath;
+
+        CLIModifyGridCommand command = CLIModifyGridCommand();
+        command.run(state, s);
+
+        // Recovered edits were committed, written to the grid file, and the journal is gone.
+        REQUIRE(ss.str().find("Recovered 1 edits") != std::string::npos);
+        REQUIRE(state.grid() == edited);
+        REQUIRE(state.gridPath() == basePath);
+        REQUIRE(xml.loadGridFromFile(basePath) == edited);
+        REQUIRE_FALSE(std::filesystem::exists(GridJournal::journalPathFor(basePath)));
+    }
 }
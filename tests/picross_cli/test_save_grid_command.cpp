@@ -26,6 +26,7 @@ namespace Picross
 
         CLISaveGridCommand command = CLISaveGridCommand();
         command.run(state, s);
+        state.saver()->waitIdle();
 
         Grid gSaved = xml.loadGridFromFile("resources/tests/picross_cli/saved_grid.xml");
 
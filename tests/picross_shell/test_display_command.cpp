@@ -51,6 +51,32 @@ namespace Picross
             REQUIRE(ss.str() == expected);
         }
 
+        SECTION("Live display")
+        {
+            REQUIRE(command.processInput("display refresh", state, s) == SHELL_COMMAND_FAILURE);
+            REQUIRE(command.processInput("display live nohints azeazeaze", state, s) == SHELL_COMMAND_BAD_ARGUMENTS);
+            REQUIRE(command.processInput("display live azeazeaze", state, s) == SHELL_COMMAND_BAD_ARGUMENTS);
+            REQUIRE_FALSE(state.liveDisplay());
+
+            REQUIRE(command.processInput("display live nohints", state, s) == SHELL_COMMAND_SUCCESS);
+            REQUIRE(state.liveDisplay());
+            REQUIRE_FALSE(state.liveDisplay()->withHints());
+            REQUIRE(state.liveDisplay()->hasFrame());
+
+            // Nothing changed since the live display was drawn.
+            ss.str("");
+            state.refreshLiveDisplay(s);
+            REQUIRE(ss.str().empty());
+
+            state.workingGrid().setCell(0, 0, CELL_CROSSED);
+            state.refreshLiveDisplay(s);
+            REQUIRE(ss.str() == "\x1b" "7" "\x1b[2;2H×" "\x1b" "8");
+            state.workingGrid() = modifiedG;
+
+            REQUIRE(command.processInput("display off", state, s) == SHELL_COMMAND_SUCCESS);
+            REQUIRE_FALSE(state.liveDisplay());
+        }
+
         REQUIRE(state.mainGrid() == g);
         REQUIRE(state.workingGrid() == modifiedG);
     }
@@ -0,0 +1,72 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <sstream>
+#include "../../tools/cli/cli_streams.hpp"
+#include "../../tools/micro_shell/micro_shell_codes.hpp"
+#include "../../picross_shell/picross_shell_state.hpp"
+#include "../../picross_shell/shell_next_command.hpp"
+#include "../../core/grid.hpp"
+#include "../../core/cell_t.hpp"
+
+#define TAGS "[shell][shell_command]"
+
+namespace Picross
+{
+    TEST_CASE("ShellNextCommand end-to-end", TAGS)
+    {
+        std::stringstream ss;
+        CLIStreams s = CLIStreams(ss, ss, ss);
+        PicrossShellState state = PicrossShellState();
+
+        // The block of 2 covers the middle cell, the last column has no block.
+        Grid g = Grid(3, 1, {{2}}, {{1}, {1}, {}});
+        Grid modifiedG = g;
+
+        state.mainGrid() = g;
+        state.workingGrid() = modifiedG;
+
+        ShellNextCommand command = ShellNextCommand();
+
+        SECTION("Bad arguments")
+        {
+            REQUIRE(command.processInput("next aze", state, s) == SHELL_COMMAND_BAD_ARGUMENTS);
+            REQUIRE(command.processInput("next apply aze", state, s) == SHELL_COMMAND_BAD_ARGUMENTS);
+            REQUIRE(ss.str() == "next: unknown argument \"aze\".\nnext: too many arguments.\n");
+        }
+
+        SECTION("Explain without applying")
+        {
+            REQUIRE(command.processInput("next", state, s) == SHELL_COMMAND_SUCCESS);
+            REQUIRE(ss.str() == "Row 0 (2):\n - check column 1, every placement of block 1 (length 2) covers it.\n");
+        }
+
+        SECTION("Apply steps until solved")
+        {
+            REQUIRE(command.processInput("next apply", state, s) == SHELL_COMMAND_SUCCESS);
+            REQUIRE(command.processInput("next apply", state, s) == SHELL_COMMAND_SUCCESS);
+            REQUIRE(command.processInput("next apply", state, s) == SHELL_COMMAND_SUCCESS);
+            REQUIRE(command.processInput("next", state, s) == SHELL_COMMAND_SUCCESS);
+
+            std::string expected;
+            expected += "Row 0 (2):\n - check column 1, every placement of block 1 (length 2) covers it.\n";
+            expected += "Column 0 (1):\n - check row 0, every placement of block 1 (length 1) covers it.\n";
+            expected += "Column 2 (0):\n - cross row 0, no block can reach it.\n";
+            expected += "Every cell is known, the grid is solved.\n";
+            REQUIRE(ss.str() == expected);
+
+            modifiedG.setCellRange(0, 0, 0, 1, CELL_CHECKED);
+            modifiedG.crossCell(0, 2);
+        }
+
+        SECTION("Explain a contradiction")
+        {
+            state.workingGrid().crossCell(0, 1);
+            REQUIRE(command.processInput("next apply", state, s) == SHELL_COMMAND_SUCCESS);
+            REQUIRE(ss.str() == "Row 0 (2): the cells already set do not fit the hints.\n");
+            modifiedG.crossCell(0, 1);
+        }
+
+        REQUIRE(state.mainGrid() == g);
+        REQUIRE(state.workingGrid() == modifiedG);
+    }
+}
\ No newline at end of file
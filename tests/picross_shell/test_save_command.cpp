@@ -0,0 +1,51 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <sstream>
+#include <string>
+#include "../../tools/cli/cli_streams.hpp"
+#include "../../tools/micro_shell/micro_shell_codes.hpp"
+#include "../../picross_shell/picross_shell_state.hpp"
+#include "../../picross_shell/shell_save_command.hpp"
+#include "../../core/grid.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+
+#define TAGS "[shell][shell_command]"
+
+namespace Picross
+{
+    TEST_CASE("ShellSaveCommand end-to-end", TAGS)
+    {
+        std::stringstream ss;
+        CLIStreams s = CLIStreams(ss, ss, ss);
+        PicrossShellState state = PicrossShellState();
+
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid g = xml.loadGridFromFile("resources/tests/picross_shell/5_10_hints_only.xml");
+        Grid modifiedG = g;
+        modifiedG.setCellRange(2, 3, 2, 8, CELL_CHECKED);
+
+        state.mainGrid() = g;
+        state.workingGrid() = modifiedG;
+
+        ShellSaveCommand command = ShellSaveCommand();
+
+        SECTION("Bad arguments")
+        {
+            REQUIRE(command.processInput("save", state, s) == SHELL_COMMAND_BAD_ARGUMENTS);
+            REQUIRE(command.processInput("save a.xml b.xml", state, s) == SHELL_COMMAND_BAD_ARGUMENTS);
+        }
+
+        SECTION("Valid arguments")
+        {
+            REQUIRE(command.processInput("save resources/tests/picross_shell/saved_grid.xml", state, s) == SHELL_COMMAND_SUCCESS);
+            state.saver()->waitIdle();
+
+            // Only the main grid is saved, and the outcome is reported once.
+            REQUIRE(xml.loadGridFromFile("resources/tests/picross_shell/saved_grid.xml") == g);
+            state.reportSaveResults(s);
+            REQUIRE(ss.str() == "Grid successfully saved to resources/tests/picross_shell/saved_grid.xml.\n");
+            state.reportSaveResults(s);
+            REQUIRE(ss.str() == "Grid successfully saved to resources/tests/picross_shell/saved_grid.xml.\n");
+        }
+    }
+}
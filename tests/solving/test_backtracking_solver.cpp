@@ -0,0 +1,100 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <cstdint>
+#include <random>
+
+#include "../../solving/backtracking_solver.hpp"
+#include "../../solving/line_solver.hpp"
+#include "../../solving/exceptions/unsolvable_grid_error.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[solving][backtracking_solver]"
+
+namespace Picross
+{
+    TEST_CASE("Backtracking solver", TAGS)
+    {
+        BacktrackingSolver solver = BacktrackingSolver();
+
+        SECTION("Grid from file")
+        {
+            XMLGridSerialzer xml = XMLGridSerialzer();
+            Grid source = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+
+            Grid g = Grid(20, 20, source.getAllRowHints(), source.getAllColHints());
+            solver.solve(g);
+            REQUIRE(g.isSolved());
+            REQUIRE(g.getCellCount(CELL_CLEARED) == 0);
+        }
+
+        SECTION("Grid needing a guess")
+        {
+            // Both diagonals satisfy the hints: the first guess checks the top left cell.
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            solver.solve(g);
+            REQUIRE(g.isSolved());
+            REQUIRE(g.getCell(0, 0) == CELL_CHECKED);
+            REQUIRE(g.getCell(1, 1) == CELL_CHECKED);
+
+            Solver::Stats stats = solver.stats();
+            REQUIRE(stats.size() == 5);
+            REQUIRE(stats[1] == Solver::Stats::value_type("guesses", 1));
+            REQUIRE(stats[2] == Solver::Stats::value_type("backtracks", 0));
+            REQUIRE(stats[4] == Solver::Stats::value_type("depth", 1));
+        }
+
+        SECTION("Random grids")
+        {
+            // Random grids often have several solutions, any of them will do. Some guesses must be wrong along the way.
+            std::mt19937 generator = std::mt19937(42);
+            std::bernoulli_distribution checked = std::bernoulli_distribution(0.5);
+            std::int64_t backtracks = 0;
+
+            for (int n = 0; n < 200; n++)
+            {
+                Grid source = Grid(8, 8);
+                for (int i = 0; i < 8; i++)
+                {
+                    for (int j = 0; j < 8; j++)
+                    {
+                        if (checked(generator)) source.setCell(i, j, CELL_CHECKED);
+                    }
+                }
+                source.setHintsFromState();
+
+                Grid g = Grid(8, 8, source.getAllRowHints(), source.getAllColHints());
+                solver.solve(g);
+                REQUIRE(g.isSolved());
+                backtracks += solver.stats()[2].second;
+            }
+
+            REQUIRE(backtracks > 0);
+        }
+
+        SECTION("Counting solutions")
+        {
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            REQUIRE(solver.countSolutions(g, 10) == 2);
+            REQUIRE(solver.countSolutions(g, 1) == 1);
+            REQUIRE(solver.countSolutions(g, 0) == 0);
+
+            // Counting leaves the grid alone.
+            REQUIRE(g.getCellCount(CELL_CLEARED) == 4);
+
+            // A full grid has a single layout.
+            Grid unique = Grid(3, 3, {{3}, {3}, {3}}, {{3}, {3}, {3}});
+            REQUIRE(solver.countSolutions(unique, 10) == 1);
+
+            Grid unsatisfiable = Grid(3, 3, {{1, 1}, {}, {}}, {{1}, {1}, {}});
+            REQUIRE(solver.countSolutions(unsatisfiable, 10) == 0);
+        }
+
+        SECTION("Unsatisfiable hints")
+        {
+            // Sums match, but no layout satisfies every line.
+            Grid g = Grid(3, 3, {{1, 1}, {}, {}}, {{1}, {1}, {}});
+            REQUIRE_THROWS_AS(solver.solve(g), UnsolvableGridError);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../../solving/batch_solver.hpp"
+#include "../../solving/backtracking_solver.hpp"
+#include "../../solving/line_solver.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[solving][batch_solver]"
+
+namespace Picross
+{
+    namespace
+    {
+        // Grids with random cells, holding only the hints of those cells.
+        std::vector<Grid> makeRandomPuzzles(std::size_t count, int size)
+        {
+            std::mt19937 generator = std::mt19937(7);
+            std::bernoulli_distribution checked = std::bernoulli_distribution(0.55);
+
+            std::vector<Grid> puzzles;
+            for (std::size_t n = 0; n < count; n++)
+            {
+                Grid source = Grid(size, size);
+                for (int i = 0; i < size; i++)
+                {
+                    for (int j = 0; j < size; j++)
+                    {
+                        if (checked(generator)) source.setCell(i, j, CELL_CHECKED);
+                    }
+                }
+                source.setHintsFromState();
+                puzzles.push_back(Grid(size, size, source.getAllRowHints(), source.getAllColHints()));
+            }
+            return puzzles;
+        }
+    }
+
+    TEST_CASE("Solver clones", TAGS)
+    {
+        BacktrackingSolver solver = BacktrackingSolver();
+        solver.setTimeout(std::chrono::milliseconds(30));
+
+        std::shared_ptr<Solver> clone = solver.clone();
+        REQUIRE(clone.get() != &solver);
+        REQUIRE(clone->name() == solver.name());
+        REQUIRE(clone->getTimeout() == std::chrono::milliseconds(30));
+    }
+
+    TEST_CASE("Batch solving", TAGS)
+    {
+        std::vector<Grid> puzzles = makeRandomPuzzles(100, 8);
+        BacktrackingSolver solver = BacktrackingSolver();
+
+        SECTION("Results in grid order")
+        {
+            BatchSolver batch = BatchSolver(4, true);
+            std::vector<BatchSolver::Result> results = batch.solveBatch(solver, puzzles);
+
+            REQUIRE(results.size() == puzzles.size());
+            for (std::size_t i = 0; i < results.size(); i++)
+            {
+                REQUIRE(results[i].index == i);
+                REQUIRE(results[i].status == BatchSolver::Status::Solved);
+                REQUIRE(results[i].grid.getAllRowHints() == puzzles[i].getAllRowHints());
+                REQUIRE(results[i].grid.isSolved());
+                REQUIRE(results[i].stats.size() == 5);
+            }
+
+            // Workers solved with clones, the solver given was left untouched.
+            REQUIRE(solver.stats()[0].second == 0);
+        }
+
+        SECTION("Consumer called in order")
+        {
+            std::vector<std::size_t> indices;
+            BatchSolver(3, true, 2).solveBatch(solver, puzzles.begin(), puzzles.end(), [&indices](BatchSolver::Result&& result)
+            {
+                indices.push_back(result.index);
+            });
+
+            REQUIRE(indices.size() == puzzles.size());
+            for (std::size_t i = 0; i < indices.size(); i++)
+            {
+                REQUIRE(indices[i] == i);
+            }
+        }
+
+        SECTION("Consumer called in completion order")
+        {
+            std::vector<int> seen = std::vector<int>(puzzles.size(), 0);
+            BatchSolver(3).solveBatch(solver, puzzles.begin(), puzzles.end(), [&seen](BatchSolver::Result&& result)
+            {
+                seen[result.index]++;
+            });
+
+            REQUIRE(seen == std::vector<int>(puzzles.size(), 1));
+        }
+
+        SECTION("Failures")
+        {
+            LineSolver lineSolver = LineSolver();
+            std::vector<BatchSolver::Result> results;
+            BatchSolver(2, true).solveBatch(lineSolver, 3, [](std::size_t i)
+            {
+                if (i == 0) return Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+                if (i == 1) return Grid(3, 3, {{1, 1}, {}, {}}, {{1}, {1}, {}});
+                throw std::runtime_error("No such grid.");
+            },
+            [&results](BatchSolver::Result&& result)
+            {
+                results.push_back(std::move(result));
+            });
+
+            REQUIRE(results.size() == 3);
+            REQUIRE(results[0].status == BatchSolver::Status::Unsolved);
+            REQUIRE(results[1].status == BatchSolver::Status::Contradiction);
+            REQUIRE(results[2].status == BatchSolver::Status::Error);
+            REQUIRE(results[2].message == "No such grid.");
+            REQUIRE(results[2].solveTime.count() == 0);
+        }
+
+        SECTION("Solvers made by a factory")
+        {
+            std::atomic<int> made = 0;
+            auto factory = [&made] ()
+            {
+                made++;
+                return std::make_shared<BacktrackingSolver>();
+            };
+
+            std::vector<BatchSolver::Result> results;
+            BatchSolver(3, true).solveBatch(factory, puzzles.size(), [&puzzles](std::size_t i) { return puzzles[i]; }, [&results](BatchSolver::Result&& result)
+            {
+                results.push_back(std::move(result));
+            });
+
+            REQUIRE(made == 3);
+            REQUIRE(results.size() == puzzles.size());
+            for (const BatchSolver::Result& result : results)
+            {
+                REQUIRE(result.status == BatchSolver::Status::Solved);
+            }
+
+            auto failingFactory = [] () -> std::shared_ptr<Solver> { throw std::runtime_error("No solver."); };
+            REQUIRE_THROWS_AS(BatchSolver(2).solveBatch(failingFactory, puzzles.size(), [&puzzles](std::size_t i) { return puzzles[i]; }, [](BatchSolver::Result&&) {}), std::runtime_error);
+        }
+
+        SECTION("Cancelled batch")
+        {
+            solver.setCancelFlag(std::make_shared<std::atomic<bool>>(true));
+            std::vector<BatchSolver::Result> results = BatchSolver(2).solveBatch(solver, puzzles);
+            for (const BatchSolver::Result& result : results)
+            {
+                REQUIRE(result.status == BatchSolver::Status::Cancelled);
+            }
+        }
+
+        SECTION("Consumer giving up")
+        {
+            std::size_t consumed = 0;
+            auto consumer = [&consumed](BatchSolver::Result&&)
+            {
+                if (++consumed == 10) throw std::runtime_error("Enough.");
+            };
+
+            REQUIRE_THROWS_AS(BatchSolver(4, false, 2).solveBatch(solver, puzzles.begin(), puzzles.end(), consumer), std::runtime_error);
+            REQUIRE(consumed == 10);
+        }
+    }
+
+    TEST_CASE("Batch solving benchmark", "[.][benchmark]")
+    {
+        std::vector<Grid> puzzles = makeRandomPuzzles(400, 15);
+        BacktrackingSolver solver = BacktrackingSolver();
+
+        BENCHMARK("400 random 15x15 grids, 1 thread")
+        {
+            return BatchSolver(1).solveBatch(solver, puzzles).size();
+        };
+
+        BENCHMARK("400 random 15x15 grids, all threads")
+        {
+            return BatchSolver().solveBatch(solver, puzzles).size();
+        };
+    }
+}
\ No newline at end of file
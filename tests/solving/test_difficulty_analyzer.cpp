@@ -0,0 +1,117 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <vector>
+
+#include "../../solving/difficulty_analyzer.hpp"
+#include "../../solving/backtracking_solver.hpp"
+#include "../../solving/batch_solver.hpp"
+#include "../../solving/grid_generator.hpp"
+#include "../../solving/exceptions/unsolvable_grid_error.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[solving][difficulty_analyzer]"
+
+namespace Picross
+{
+    namespace
+    {
+        double averageScore(DifficultyAnalyzer& analyzer, const std::vector<Grid>& grids)
+        {
+            double total = 0;
+            for (const Grid& g : grids)
+            {
+                total += analyzer.analyze(g).score;
+            }
+            return total / grids.size();
+        }
+    }
+
+    TEST_CASE("Difficulty analysis", TAGS)
+    {
+        DifficultyAnalyzer analyzer = DifficultyAnalyzer();
+
+        SECTION("Full grid")
+        {
+            // Every row is full, one look at each line is enough.
+            Grid g = Grid(3, 3, {{3}, {3}, {3}}, {{3}, {3}, {3}});
+            DifficultyAnalyzer::Report report = analyzer.analyze(g);
+            REQUIRE(report.lineSolvable);
+            REQUIRE(report.rounds == 1);
+            REQUIRE(report.lines == 6);
+            REQUIRE(report.score == 0);
+            REQUIRE(report.category == DifficultyAnalyzer::Category::Easy);
+        }
+
+        SECTION("Grid needing a guess")
+        {
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            DifficultyAnalyzer::Report report = analyzer.analyze(g);
+            REQUIRE_FALSE(report.lineSolvable);
+            REQUIRE(report.guesses == 1);
+            REQUIRE(report.depth == 1);
+            REQUIRE(report.score == Approx(60));
+            REQUIRE(report.category == DifficultyAnalyzer::Category::Expert);
+        }
+
+        SECTION("Cells of the grid are ignored")
+        {
+            // The grid comes solved, the puzzle is still rated from its hints.
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            g.setCell(0, 0, CELL_CHECKED);
+            g.setCell(1, 1, CELL_CHECKED);
+            REQUIRE(analyzer.analyze(g).guesses == 1);
+        }
+
+        SECTION("Longer chains of deductions score higher")
+        {
+            // Sparse puzzles need more rounds of deductions than dense ones.
+            std::vector<Grid> sparse = GridGenerator({10, 10, 0.5, 100, 7}, 1).generate(10);
+            std::vector<Grid> dense = GridGenerator({10, 10, 0.8, 100, 7}, 1).generate(10);
+            REQUIRE(averageScore(analyzer, sparse) > averageScore(analyzer, dense));
+        }
+
+        SECTION("Unsatisfiable hints")
+        {
+            Grid g = Grid(3, 3, {{1, 1}, {}, {}}, {{1}, {1}, {}});
+            REQUIRE_THROWS_AS(analyzer.analyze(g), UnsolvableGridError);
+        }
+    }
+
+    TEST_CASE("Difficulty from batch stats", TAGS)
+    {
+        std::vector<Grid> puzzles = GridGenerator({8, 8, 0.55, 10, 99}, 1).generate(12);
+        puzzles.push_back(Grid(2, 2, {{1}, {1}}, {{1}, {1}}));
+
+        std::vector<Grid> blanks;
+        for (const Grid& g : puzzles)
+        {
+            blanks.push_back(Grid(g.getWidth(), g.getHeight(), g.getAllRowHints(), g.getAllColHints()));
+        }
+
+        BacktrackingSolver solver = BacktrackingSolver();
+        std::vector<BatchSolver::Result> results = BatchSolver(2).solveBatch(solver, blanks);
+
+        // The stats of a batch solve give the same ratings as solving again.
+        DifficultyAnalyzer analyzer = DifficultyAnalyzer();
+        for (const BatchSolver::Result& result : results)
+        {
+            DifficultyAnalyzer::Report fromBatch = DifficultyAnalyzer::assess(result.grid.getWidth(), result.grid.getHeight(), result.stats);
+            DifficultyAnalyzer::Report fromSolve = analyzer.analyze(puzzles[result.index]);
+            REQUIRE(fromBatch.score == fromSolve.score);
+            REQUIRE(fromBatch.category == fromSolve.category);
+            REQUIRE(fromBatch.rounds == fromSolve.rounds);
+        }
+    }
+
+    TEST_CASE("Difficulty categories", TAGS)
+    {
+        REQUIRE(DifficultyAnalyzer::categorize(0) == DifficultyAnalyzer::Category::Easy);
+        REQUIRE(DifficultyAnalyzer::categorize(10) == DifficultyAnalyzer::Category::Medium);
+        REQUIRE(DifficultyAnalyzer::categorize(25) == DifficultyAnalyzer::Category::Hard);
+        REQUIRE(DifficultyAnalyzer::categorize(49) == DifficultyAnalyzer::Category::Hard);
+        REQUIRE(DifficultyAnalyzer::categorize(50) == DifficultyAnalyzer::Category::Expert);
+
+        REQUIRE(DifficultyAnalyzer::categoryName(DifficultyAnalyzer::Category::Easy) == "easy");
+        REQUIRE(DifficultyAnalyzer::categoryName(DifficultyAnalyzer::Category::Expert) == "expert");
+    }
+}
\ No newline at end of file
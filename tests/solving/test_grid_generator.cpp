@@ -0,0 +1,90 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "../../solving/grid_generator.hpp"
+#include "../../solving/backtracking_solver.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[solving][grid_generator]"
+
+namespace Picross
+{
+    TEST_CASE("Grid generation", TAGS)
+    {
+        GridGenerator generator = GridGenerator({10, 8, 0.6, 100, 1234}, 3);
+
+        SECTION("Puzzles have a single solution")
+        {
+            std::vector<Grid> grids = generator.generate(30);
+            REQUIRE(grids.size() == 30);
+
+            BacktrackingSolver solver = BacktrackingSolver();
+            for (const Grid& g : grids)
+            {
+                REQUIRE(g.getWidth() == 10);
+                REQUIRE(g.getHeight() == 8);
+                REQUIRE(g.isSolved());
+
+                Grid puzzle = Grid(10, 8, g.getAllRowHints(), g.getAllColHints());
+                REQUIRE(solver.countSolutions(puzzle, 2) == 1);
+            }
+        }
+
+        SECTION("Puzzles only depend on the seed and their index")
+        {
+            std::vector<Grid> grids = generator.generate(10);
+            std::vector<Grid> sequential = GridGenerator({10, 8, 0.6, 100, 1234}, 1).generate(10);
+            for (std::size_t i = 0; i < grids.size(); i++)
+            {
+                REQUIRE(grids[i] == sequential[i]);
+                REQUIRE(grids[i] == generator.generateOne(i));
+            }
+
+            REQUIRE(GridGenerator({10, 8, 0.6, 100, 4321}).generateOne(0) != grids[0]);
+        }
+
+        SECTION("Stats")
+        {
+            std::size_t received = 0;
+            GridGenerator::Stats stats = generator.generate(20, [&received](std::size_t index, Grid&&)
+            {
+                REQUIRE(index < 20);
+                received++;
+            });
+
+            REQUIRE(received == 20);
+            REQUIRE(stats.generated == 20);
+            REQUIRE(stats.candidates == stats.generated + stats.rejected);
+            REQUIRE(stats.elapsed.count() > 0);
+            REQUIRE(stats.puzzlesPerSecond() > 0);
+        }
+
+        SECTION("Exhaustive checks")
+        {
+            // Without repairs, ambiguous candidates are counted through, and rejected if they have several solutions.
+            GridGenerator noRepairs = GridGenerator({6, 6, 0.5, 0, 99}, 2);
+            GridGenerator::Stats stats = noRepairs.generate(20, [](std::size_t, Grid&&) {});
+            REQUIRE(stats.generated == 20);
+            REQUIRE(stats.repairs == 0);
+            REQUIRE(stats.exhaustiveChecks >= stats.rejected);
+        }
+    }
+
+    TEST_CASE("Invalid generation options", TAGS)
+    {
+        REQUIRE_THROWS_AS(GridGenerator({0, 5}), std::invalid_argument);
+        REQUIRE_THROWS_AS(GridGenerator({5, 5, 1.5}), std::invalid_argument);
+        REQUIRE_THROWS_AS(GridGenerator({5, 5, 0.5, -1}), std::invalid_argument);
+    }
+
+    TEST_CASE("Grid generation benchmark", "[.][benchmark]")
+    {
+        BENCHMARK("100 unique 15x15 puzzles")
+        {
+            return GridGenerator({15, 15, 0.55, 100, 0}).generate(100).size();
+        };
+    }
+}
\ No newline at end of file
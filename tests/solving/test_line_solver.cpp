@@ -0,0 +1,89 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include "../../solving/line_solver.hpp"
+#include "../../solving/exceptions/unsolvable_grid_error.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[solving][line_solver]"
+
+namespace Picross
+{
+    TEST_CASE("Line solver", TAGS)
+    {
+        LineSolver solver = LineSolver();
+
+        SECTION("Grid solvable line by line")
+        {
+            // Letter E: every line is either full or pinned to a side.
+            Grid expected = Grid(4, 5);
+            expected.setCellRange(0, 4, 0, 0, CELL_CHECKED);
+            expected.setCellRange(0, 0, 0, 3, CELL_CHECKED);
+            expected.setCellRange(2, 2, 0, 2, CELL_CHECKED);
+            expected.setCellRange(4, 4, 0, 3, CELL_CHECKED);
+            expected.setHintsFromState();
+
+            Grid g = Grid(4, 5, expected.getAllRowHints(), expected.getAllColHints());
+            solver.solve(g);
+            REQUIRE(g.isSolved());
+            REQUIRE(g.getCellCount(CELL_CLEARED) == 0);
+
+            for (int i = 0; i < 5; i++)
+            {
+                for (int j = 0; j < 4; j++)
+                {
+                    REQUIRE((g.getCell(i, j) == CELL_CHECKED) == (expected.getCell(i, j) == CELL_CHECKED));
+                }
+            }
+
+            REQUIRE(solver.stats().size() == 2);
+            REQUIRE(solver.stats()[0].first == "lines");
+            REQUIRE(solver.stats()[0].second >= 9);
+            REQUIRE(solver.stats()[1].first == "rounds");
+            REQUIRE(solver.stats()[1].second >= 2);
+        }
+
+        SECTION("Grid needing a guess")
+        {
+            // Both diagonals satisfy the hints, no line tells anything.
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            solver.solve(g);
+            REQUIRE(g.getCellCount(CELL_CLEARED) == 4);
+        }
+
+        SECTION("Known cells are kept and used")
+        {
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            g.setCell(0, 0, CELL_CROSSED);
+            solver.solve(g);
+            REQUIRE(g.isSolved());
+            REQUIRE(g.getCell(0, 1) == CELL_CHECKED);
+            REQUIRE(g.getCell(1, 0) == CELL_CHECKED);
+        }
+
+        SECTION("Unsatisfiable hints")
+        {
+            Grid g = Grid(2, 2, {{2}, {}}, {{}, {}});
+            REQUIRE_THROWS_AS(solver.solve(g), UnsolvableGridError);
+
+            Grid marked = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            marked.setCell(0, 0, CELL_CHECKED);
+            marked.setCell(0, 1, CELL_CHECKED);
+            REQUIRE_THROWS_AS(solver.solve(marked), UnsolvableGridError);
+        }
+    }
+
+    TEST_CASE("Line solver benchmark", "[.][benchmark]")
+    {
+        XMLGridSerialzer xml = XMLGridSerialzer();
+        Grid source = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+        LineSolver solver = LineSolver();
+
+        BENCHMARK("Line solving a 20x20 grid")
+        {
+            Grid g = Grid(20, 20, source.getAllRowHints(), source.getAllColHints());
+            solver.solve(g);
+            return g.getCellCount(CELL_CHECKED);
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <atomic>
+#include <memory>
+
+#include "../../solving/solver_registry.hpp"
+#include "../../solving/line_solver.hpp"
+#include "../../solving/exceptions/solver_cancelled_error.hpp"
+#include "../../solving/exceptions/solver_registry_error.hpp"
+#include "../../solving/exceptions/unsupported_solver_operation_error.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[solving][solver_registry]"
+
+namespace Picross
+{
+    TEST_CASE("Built-in solver registry", TAGS)
+    {
+        const SolverRegistry& registry = SolverRegistry::builtin();
+        REQUIRE(registry.size() == 2);
+        REQUIRE(registry.entries()[0].key == "line");
+        REQUIRE(registry.entries()[1].key == "backtracking");
+
+        SECTION("Factories make solvers matching their entry")
+        {
+            for (const SolverRegistry::Entry& entry : registry.entries())
+            {
+                std::shared_ptr<Solver> solver = entry.factory();
+                REQUIRE(solver->name() == entry.name);
+                REQUIRE(registry.create(entry.key)->name() == entry.name);
+                REQUIRE(registry.find(entry.key) == &entry);
+            }
+
+            REQUIRE(registry.find("simplex") == nullptr);
+            REQUIRE_THROWS_AS(registry.create("simplex"), SolverRegistryError);
+        }
+
+        SECTION("Capabilities hold")
+        {
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            for (const SolverRegistry::Entry& entry : registry.entries())
+            {
+                std::shared_ptr<Solver> solver = entry.factory();
+
+                if (entry.capabilities.supportsCounting) REQUIRE(solver->countSolutions(g, 10) == 2);
+                else REQUIRE_THROWS_AS(solver->countSolutions(g, 10), UnsupportedSolverOperationError);
+
+                if (entry.capabilities.supportsCancellation)
+                {
+                    std::shared_ptr<std::atomic<bool>> cancel = std::make_shared<std::atomic<bool>>(true);
+                    solver->setCancelFlag(cancel);
+                    Grid copy = g;
+                    REQUIRE_THROWS_AS(solver->solve(copy), SolverCancelledError);
+
+                    // Clones share the flag.
+                    Grid other = g;
+                    REQUIRE_THROWS_AS(solver->clone()->solve(other), SolverCancelledError);
+
+                    *cancel = false;
+                    REQUIRE_NOTHROW(solver->solve(copy));
+                }
+
+                if (entry.capabilities.complete)
+                {
+                    Grid copy = g;
+                    solver->solve(copy);
+                    REQUIRE(copy.isSolved());
+                }
+            }
+        }
+
+        SECTION("Picking a solver")
+        {
+            REQUIRE(registry.pick(20, 20, {false, false, false})->key == "line");
+            REQUIRE(registry.pick(20, 20, {true, false, false})->key == "backtracking");
+            REQUIRE(registry.pick(20, 20, {false, true, true})->key == "backtracking");
+        }
+    }
+
+    TEST_CASE("Custom solver registry", TAGS)
+    {
+        SolverRegistry registry = SolverRegistry();
+        auto factory = [] () { return std::make_shared<LineSolver>(); };
+        registry.add({"small", "Line solver", factory, {true, false, false, false, 5}});
+        registry.add({"large", "Line solver", factory, {true, false, false, false, 0}});
+
+        REQUIRE_THROWS_AS(registry.add({"small", "Line solver", factory, {true, false, false, false, 0}}), SolverRegistryError);
+        REQUIRE(registry.size() == 2);
+
+        // Entries which cannot handle the grid size are skipped.
+        REQUIRE(registry.pick(5, 5, {true, false, false})->key == "small");
+        REQUIRE(registry.pick(5, 6, {true, false, false})->key == "large");
+        REQUIRE(registry.pick(5, 5, {false, false, true}) == nullptr);
+    }
+}
\ No newline at end of file
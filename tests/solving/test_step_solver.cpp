@@ -0,0 +1,117 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <cstdint>
+
+#include "../../solving/step_solver.hpp"
+#include "../../io/xml_grid_serializer.hpp"
+#include "../../core/grid.hpp"
+
+#define TAGS "[solving][step_solver]"
+
+namespace Picross
+{
+    TEST_CASE("Step solver", TAGS)
+    {
+        StepSolver solver = StepSolver();
+
+        SECTION("Overlapping block")
+        {
+            // Wherever the block of 4 goes, it covers the three middle cells.
+            Grid g = Grid(5, 1, {{4}}, {{1}, {1}, {1}, {1}, {}});
+            StepSolver::Step step = solver.next(g);
+            REQUIRE(step.status == StepSolver::Status::Deduced);
+            REQUIRE(step.isRow);
+            REQUIRE(step.index == 0);
+            REQUIRE(step.cells.size() == 3);
+            for (int k = 0; k < 3; k++)
+            {
+                REQUIRE(step.cells[k].position == k + 1);
+                REQUIRE(step.cells[k].value == CELL_CHECKED);
+                REQUIRE(step.cells[k].reason == StepSolver::Reason::Overlap);
+                REQUIRE(step.cells[k].block == 0);
+            }
+
+            // The grid is left untouched, the same step comes until it changes.
+            REQUIRE(g.getCellCount(CELL_CLEARED) == 5);
+            REQUIRE(solver.next(g).cells.size() == 3);
+
+            StepSolver::apply(step, g);
+            REQUIRE(g.getCellCount(CELL_CHECKED) == 3);
+        }
+
+        SECTION("Unreachable cell")
+        {
+            // The row allows nothing, the first column has no block.
+            Grid g = Grid(3, 1, {{1}}, {{}, {}, {1}});
+            StepSolver::Step step = solver.next(g);
+            REQUIRE(step.status == StepSolver::Status::Deduced);
+            REQUIRE_FALSE(step.isRow);
+            REQUIRE(step.index == 0);
+            REQUIRE(step.cells.size() == 1);
+            REQUIRE(step.cells[0].value == CELL_CROSSED);
+            REQUIRE(step.cells[0].reason == StepSolver::Reason::Unreachable);
+        }
+
+        SECTION("Grid needing a guess")
+        {
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            REQUIRE(solver.next(g).status == StepSolver::Status::Stuck);
+        }
+
+        SECTION("Contradiction")
+        {
+            Grid g = Grid(2, 2, {{1}, {1}}, {{1}, {1}});
+            g.setCellRange(0, 0, 0, 1, CELL_CHECKED);
+            StepSolver::Step step = solver.next(g);
+            REQUIRE(step.status == StepSolver::Status::Contradiction);
+            REQUIRE(step.isRow);
+            REQUIRE(step.index == 0);
+        }
+
+        SECTION("Solving step by step")
+        {
+            XMLGridSerialzer xml = XMLGridSerialzer();
+            Grid source = xml.loadGridFromFile("resources/tests/io/20_20_solved.xml");
+            Grid g = Grid(20, 20, source.getAllRowHints(), source.getAllColHints());
+
+            StepSolver::Step step = solver.next(g);
+            std::int64_t lines = solver.lineCount();
+
+            // Nothing changed: only the line of the step is solved again.
+            solver.next(g);
+            REQUIRE(solver.lineCount() == lines + 1);
+
+            while (step.status == StepSolver::Status::Deduced)
+            {
+                StepSolver::apply(step, g);
+                step = solver.next(g);
+            }
+            REQUIRE(step.status == StepSolver::Status::Solved);
+            REQUIRE(g.isSolved());
+            REQUIRE(solver.trailSize() == 0);
+
+            // Lines are only solved again when crossing cells change, not at every step.
+            REQUIRE(solver.lineCount() < 20 * 40);
+        }
+
+        SECTION("Changes made by hand")
+        {
+            Grid g = Grid(5, 1, {{4}}, {{1}, {1}, {1}, {1}, {}});
+            solver.next(g);
+
+            // Cells set by hand are taken into account, the block is now pinned to the left.
+            g.checkCell(0, 0);
+            StepSolver::Step step = solver.next(g);
+            REQUIRE(step.cells.size() == 4);
+            REQUIRE(step.cells[0].position == 1);
+            REQUIRE(step.cells[3].position == 4);
+            REQUIRE(step.cells[3].value == CELL_CROSSED);
+
+            // New hints start over.
+            g.setRowHints(0, {3});
+            g.setColHints(3, {});
+            g.clearCell(0, 0);
+            REQUIRE(solver.next(g).cells.size() == 1);
+        }
+    }
+}
\ No newline at end of file
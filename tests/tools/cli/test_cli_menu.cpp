@@ -29,3 +29,33 @@ TEST_CASE("CLIMenu end-to-end", TAGS)
 
     f.close();
 }
+
+TEST_CASE("CLIMenu prompt hook", TAGS)
+{
+    std::ifstream f = std::ifstream("resources/tests/tools/cli/menu_input.txt", std::ios::in);
+    REQUIRE(f);
+    std::stringstream ss;
+
+    CLIStreams s = CLIStreams(f, ss, ss);
+    TestCLIState state = TestCLIState();
+
+    // The hook runs once before every prompt.
+    int hookCalls = 0;
+    TestMenu menu = makeBasicTestMenu();
+    menu.setPromptHook([&hookCalls](TestCLIState&, CLIStreams&)
+    {
+        hookCalls++;
+    });
+    menu.show(state, s);
+
+    std::string output = ss.str();
+    int prompts = 0;
+    for (std::size_t pos = output.find("Please make a choice"); pos != std::string::npos; pos = output.find("Please make a choice", pos + 1))
+    {
+        prompts++;
+    }
+    REQUIRE(hookCalls > 0);
+    REQUIRE(hookCalls == prompts);
+
+    f.close();
+}
@@ -0,0 +1,72 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../../tools/bounded_queue.hpp"
+
+#define TAGS "[tools][bounded_queue]"
+
+TEST_CASE("BoundedQueue single-threaded behaviour", TAGS)
+{
+    BoundedQueue<int> queue = BoundedQueue<int>(2);
+    REQUIRE(queue.capacity() == 2);
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.push(2));
+    REQUIRE(queue.size() == 2);
+
+    int value;
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == 1);
+
+    // Closing rejects pushes, but remaining elements can still be popped.
+    queue.close();
+    REQUIRE(queue.isClosed());
+    REQUIRE_FALSE(queue.push(3));
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == 2);
+    REQUIRE_FALSE(queue.pop(value));
+}
+
+TEST_CASE("BoundedQueue producers and consumers", TAGS)
+{
+    BoundedQueue<int> queue = BoundedQueue<int>(4);
+    std::atomic<long> sum = 0;
+    std::atomic<int> maxSize = 0;
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 3; c++)
+    {
+        consumers.emplace_back([&]()
+        {
+            int value;
+            while (queue.pop(value))
+            {
+                sum += value;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 3; p++)
+    {
+        producers.emplace_back([&, p]()
+        {
+            for (int i = 1; i <= 1000; i++)
+            {
+                queue.push(p * 1000 + i);
+                int size = (int) queue.size();
+                if (size > maxSize) maxSize = size;
+            }
+        });
+    }
+
+    for (auto& producer : producers) producer.join();
+    queue.close();
+    for (auto& consumer : consumers) consumer.join();
+
+    // Sum of 1..3000.
+    REQUIRE(sum == 3000L * 3001L / 2);
+    REQUIRE(maxSize <= 4);
+}
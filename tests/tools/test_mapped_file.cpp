@@ -0,0 +1,30 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <string>
+
+#include "../../tools/mapped_file.hpp"
+#include "../../tools/string_tools.hpp"
+#include "../../tools/exceptions/file_not_found_error.hpp"
+#include "../../tools/exceptions/file_read_error.hpp"
+
+#define TAGS "[tools][mapped_file]"
+
+TEST_CASE("MappedFile", TAGS)
+{
+    SECTION("Whole contents are available")
+    {
+        std::string path = "resources/tests/io/10_10_partial.xml";
+        MappedFile file = MappedFile(path);
+        REQUIRE(std::string((const char*) file.data(), file.size()) == StringTools::readFileIntoString(path));
+    }
+
+    SECTION("Missing files are reported")
+    {
+        REQUIRE_THROWS_AS(MappedFile("resources/tests/tools/missing_file"), FileNotFoundError);
+    }
+
+    SECTION("Files which cannot be read are reported")
+    {
+        REQUIRE_THROWS_AS(MappedFile("resources/tests/tools"), FileReadError);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "../../tools/parallel_tools.hpp"
+
+#define TAGS "[tools][parallel_tools]"
+
+TEST_CASE("Produce and consume in parallel", TAGS)
+{
+    std::vector<int> consumed = std::vector<int>(100, 0);
+
+    SECTION("Every result is consumed once")
+    {
+        std::vector<std::size_t> produced = std::vector<std::size_t>(4, 0);
+        ParallelTools::produceAndConsume<std::size_t>(100, 4, 2, [&produced](std::size_t worker, std::size_t i)
+        {
+            produced[worker]++;
+            return i;
+        }, [&consumed](std::size_t&& i)
+        {
+            consumed[i]++;
+        });
+
+        REQUIRE(consumed == std::vector<int>(100, 1));
+        REQUIRE(produced[0] + produced[1] + produced[2] + produced[3] == 100);
+    }
+
+    SECTION("Producer errors stop the workers and are rethrown")
+    {
+        auto produce = [](std::size_t, std::size_t i) -> std::size_t
+        {
+            if (i == 10) throw std::runtime_error("Producer error");
+            return i;
+        };
+
+        REQUIRE_THROWS_AS((ParallelTools::produceAndConsume<std::size_t>(100, 4, 2, produce, [](std::size_t&&) {})), std::runtime_error);
+    }
+
+    SECTION("Consumer errors stop the consumption and are rethrown")
+    {
+        int calls = 0;
+        auto consume = [&calls](std::size_t&&)
+        {
+            calls++;
+            throw std::runtime_error("Consumer error");
+        };
+
+        REQUIRE_THROWS_AS((ParallelTools::produceAndConsume<std::size_t>(100, 4, 2, [](std::size_t, std::size_t i) { return i; }, consume)), std::runtime_error);
+        REQUIRE(calls == 1);
+    }
+}
\ No newline at end of file
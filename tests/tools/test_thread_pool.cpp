@@ -0,0 +1,43 @@
+#include "../../lib/catch2/catch2.hpp"
+
+#include <atomic>
+
+#include "../../tools/thread_pool.hpp"
+
+#define TAGS "[tools][thread_pool]"
+
+TEST_CASE("ThreadPool runs every task", TAGS)
+{
+    std::atomic<int> counter = 0;
+
+    SECTION("Wait for idle")
+    {
+        ThreadPool pool = ThreadPool(4);
+        REQUIRE(pool.threadCount() == 4);
+        for (int i = 0; i < 1000; i++)
+        {
+            pool.submit([&counter]() { counter++; });
+        }
+        pool.waitIdle();
+        REQUIRE(counter == 1000);
+    }
+
+    SECTION("Destruction completes pending tasks")
+    {
+        {
+            ThreadPool pool = ThreadPool(2);
+            for (int i = 0; i < 100; i++)
+            {
+                pool.submit([&counter]() { counter++; });
+            }
+        }
+        REQUIRE(counter == 100);
+    }
+
+    SECTION("Default thread count")
+    {
+        ThreadPool pool;
+        REQUIRE(pool.threadCount() == ThreadPool::defaultThreadCount());
+        REQUIRE(pool.threadCount() > 0);
+    }
+}
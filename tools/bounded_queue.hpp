@@ -0,0 +1,92 @@
+#ifndef TOOLS__BOUNDED_QUEUE_HPP
+#define TOOLS__BOUNDED_QUEUE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+// Blocking multi-producer, multi-consumer FIFO queue holding at most a fixed number of elements.
+// Producers wait while the queue is full, consumers wait while it is empty. Once closed, pushes are
+// rejected and pops drain the remaining elements before failing.
+template<typename T>
+class BoundedQueue
+{
+    private:    // Attributes
+        std::size_t _capacity;
+        std::deque<T> _items;
+        bool _closed;
+        mutable std::mutex _mutex;
+        std::condition_variable _notFull;
+        std::condition_variable _notEmpty;
+
+    public:     // Public methods
+        explicit BoundedQueue(std::size_t capacity) :
+            _capacity(capacity > 0 ? capacity : 1),
+            _items(),
+            _closed(false)
+        {
+
+        }
+
+        BoundedQueue(const BoundedQueue& other) = delete;
+        BoundedQueue& operator=(const BoundedQueue& other) = delete;
+
+        // Wait for room and push an element. Returns false (dropping the element) if the queue is closed.
+        bool push(T item)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _notFull.wait(lock, [this]() { return _closed || _items.size() < _capacity; });
+            if (_closed) return false;
+
+            _items.push_back(std::move(item));
+            lock.unlock();
+            _notEmpty.notify_one();
+            return true;
+        }
+
+        // Wait for an element and pop it. Returns false once the queue is closed and empty.
+        bool pop(T& item)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _notEmpty.wait(lock, [this]() { return _closed || !_items.empty(); });
+            if (_items.empty()) return false;
+
+            item = std::move(_items.front());
+            _items.pop_front();
+            lock.unlock();
+            _notFull.notify_one();
+            return true;
+        }
+
+        // Reject further pushes and wake up every waiting thread.
+        void close()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _closed = true;
+            }
+            _notFull.notify_all();
+            _notEmpty.notify_all();
+        }
+
+        bool isClosed() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _closed;
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _items.size();
+        }
+
+        std::size_t capacity() const
+        {
+            return _capacity;
+        }
+};
+
+#endif//TOOLS__BOUNDED_QUEUE_HPP
\ No newline at end of file
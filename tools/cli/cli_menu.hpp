@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
 
 #include "cli_streams.hpp"
 #include "cli_command.hpp"
@@ -14,6 +15,7 @@ template<typename CustomState>
 class CLIMenu
 {
     using CommandPtr = std::shared_ptr<CLICommand<CustomState>>;
+    using PromptHook = std::function<void(CustomState&, CLIStreams&)>;
     
     private:    // Attributes
         // Commands to be available in the menu.
@@ -24,11 +26,15 @@ class CLIMenu
         std::string _exitName;
         // Custom exit command (can be nullptr).
         CommandPtr _exitCommand;
+        // Action run every time before the menu is displayed (can be empty).
+        PromptHook _promptHook;
 
     public:     // Public methods
         CLIMenu(std::vector<CommandPtr> commands, std::string tooltip, std::string exitName, CommandPtr exitCommand = nullptr);
         
         std::string getTooltip();
+        // Set an action to be run every time before the menu is displayed, e.g. to report on background work.
+        void setPromptHook(PromptHook hook);
         // Print the menu and handle input.
         void show(CustomState& state, CLIStreams& streams = CLIInput::defaultStreams);
         
@@ -44,7 +50,8 @@ CLIMenu<CustomState>::CLIMenu(std::vector<CLIMenu<CustomState>::CommandPtr> comm
     _commands(commands),
     _tooltip(tooltip),
     _exitName(exitName),
-    _exitCommand(exitCommand)
+    _exitCommand(exitCommand),
+    _promptHook()
 {
 
 }
@@ -55,12 +62,23 @@ std::string CLIMenu<CustomState>::getTooltip()
     return _tooltip;
 }
 
+template<typename CustomState>
+void CLIMenu<CustomState>::setPromptHook(CLIMenu<CustomState>::PromptHook hook)
+{
+    _promptHook = hook;
+}
+
 template<typename CustomState>
 void CLIMenu<CustomState>::show(CustomState& state, CLIStreams& streams)
 {
     // While user did not ask to exit...
     while (true)
     {
+        if (_promptHook)
+        {
+            _promptHook(state, streams);
+        }
+
         // Print menu header and options.
         streams.out() << '\n';
         streams.out() << getTooltip() << ":" << std::endl;
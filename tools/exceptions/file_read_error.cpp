@@ -0,0 +1,4 @@
+#include "file_read_error.hpp"
+#include "../../tools/make_basic_exception.hpp"
+
+DEFINE_BASIC_EXCEPTION(FileReadError)
\ No newline at end of file
@@ -0,0 +1,8 @@
+#ifndef TOOLS__EXCEPTIONS__FILE_READ_ERROR
+#define TOOLS__EXCEPTIONS__FILE_READ_ERROR
+
+#include "../../tools/make_basic_exception.hpp"
+
+DECLARE_BASIC_EXCEPTION(FileReadError)
+
+#endif//TOOLS__EXCEPTIONS__FILE_READ_ERROR
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "mapped_file.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "exceptions/file_not_found_error.hpp"
+#include "exceptions/file_read_error.hpp"
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& path) :
+    _data(nullptr),
+    _size(0),
+    _mapped(false),
+    _buffer()
+{
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw FileNotFoundError(path + ": file not found.");
+    }
+
+    struct stat st;
+    bool isEmpty = false;
+    if (fstat(fd, &st) == 0)
+    {
+        // Directories can be opened, but report meaningless sizes and cannot be read.
+        if (S_ISDIR(st.st_mode))
+        {
+            close(fd);
+            throw FileReadError(path + ": is a directory.");
+        }
+
+        isEmpty = (st.st_size == 0);
+        if (!isEmpty)
+        {
+            void* addr = mmap(nullptr, (std::size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED)
+            {
+                _data = static_cast<const unsigned char*>(addr);
+                _size = (std::size_t) st.st_size;
+                _mapped = true;
+            }
+        }
+    }
+    // The mapping stays valid once the descriptor is closed.
+    close(fd);
+
+    // Empty files cannot be mapped; other failures fall back to a plain read.
+    if (!_mapped && !isEmpty)
+    {
+        readIntoBuffer(path);
+    }
+#else
+    readIntoBuffer(path);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    _data(other._data),
+    _size(other._size),
+    _mapped(other._mapped),
+    _buffer(std::move(other._buffer))
+{
+    if (!_mapped)
+    {
+        _data = _buffer.data();
+    }
+
+    other._data = nullptr;
+    other._size = 0;
+    other._mapped = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+
+        _size = other._size;
+        _mapped = other._mapped;
+        _buffer = std::move(other._buffer);
+        _data = _mapped ? other._data : _buffer.data();
+
+        other._data = nullptr;
+        other._size = 0;
+        other._mapped = false;
+    }
+
+    return *this;
+}
+
+const unsigned char* MappedFile::data() const
+{
+    return _data;
+}
+
+std::size_t MappedFile::size() const
+{
+    return _size;
+}
+
+void MappedFile::readIntoBuffer(const std::string& path)
+{
+    std::ifstream f = std::ifstream(path, std::ios::binary | std::ios::ate);
+    if (!f.is_open())
+    {
+        throw FileNotFoundError(path + ": file not found.");
+    }
+
+    // Some special files can be opened, but neither measured nor read.
+    std::streamoff length = f.tellg();
+    if (length < 0 || !f.seekg(0, std::ios::beg))
+    {
+        throw FileReadError(path + ": file size could not be determined.");
+    }
+
+    _buffer.resize((std::size_t) length);
+    if (!f.read(reinterpret_cast<char*>(_buffer.data()), length))
+    {
+        throw FileReadError(path + ": file could not be read.");
+    }
+
+    _data = _buffer.data();
+    _size = _buffer.size();
+}
+
+void MappedFile::release()
+{
+#ifndef _WIN32
+    if (_mapped)
+    {
+        munmap(const_cast<unsigned char*>(_data), _size);
+    }
+#endif
+    _data = nullptr;
+    _size = 0;
+    _mapped = false;
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef TOOLS__MAPPED_FILE_HPP
+#define TOOLS__MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Read-only view over the whole contents of a file. On POSIX systems the file is memory-mapped,
+// elsewhere it is read into a buffer in one go. Throws FileNotFoundError if the file cannot be opened,
+// FileReadError if it can be opened but not read.
+class MappedFile
+{
+    private:    // Attributes
+        const unsigned char* _data;
+        std::size_t _size;
+        bool _mapped;                       // Whether _data points into a mapping which must be released.
+        std::vector<unsigned char> _buffer; // Backing storage when the file could not be mapped.
+
+    public:     // Public methods
+        explicit MappedFile(const std::string& path);
+        ~MappedFile();
+
+        // Non-copyable, movable.
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        const unsigned char* data() const;
+        std::size_t size() const;
+
+    private:    // Private methods
+        // Fallback: read the whole file into the internal buffer.
+        void readIntoBuffer(const std::string& path);
+        // Release the mapping, if any.
+        void release();
+};
+
+#endif//TOOLS__MAPPED_FILE_HPP
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include "micro_shell_command.hpp"
 #include "micro_shell_codes.hpp"
 #include "../cli/cli_streams.hpp"
@@ -19,12 +20,15 @@ class MicroShell
     using PicrossShellCommand = MicroShellCommand<CustomState>;
     using CommandPtr = std::shared_ptr<PicrossShellCommand>;
     using ChainIter = typename std::deque<CommandPtr>::iterator;
+    using PromptHook = std::function<void(CustomState&, CLIStreams&)>;
 
     private:    // Attributes
         // Command chain.
         std::deque<CommandPtr> _chain;
         // Custom exit command (can be nullptr).
         CommandPtr _exitCommand;
+        // Action run every time before the user is prompted (can be empty).
+        PromptHook _promptHook;
 
         // Lambda generating another lambda, which is parameterized on a name to check against.
         // The returned lambda tells whether the name of an input shell command is the same as the parameterized name.
@@ -45,6 +49,8 @@ class MicroShell
         void removeCommand(int index);
         void removeCommand(const std::string& name);
         void setExitCommand(CommandPtr command);
+        // Set an action to be run every time before the user is prompted, e.g. to report on background work.
+        void setPromptHook(PromptHook hook);
 
     // Getter methods
         CommandPtr getCommand(int index);
@@ -72,7 +78,8 @@ class MicroShell
 template<typename CustomState>
 MicroShell<CustomState>::MicroShell() :
     _chain(),
-    _exitCommand(nullptr)
+    _exitCommand(nullptr),
+    _promptHook()
 {
 
 }
@@ -163,6 +170,12 @@ void MicroShell<CustomState>::setExitCommand(MicroShell<CustomState>::CommandPtr
     _exitCommand = command;
 }
 
+template<typename CustomState>
+void MicroShell<CustomState>::setPromptHook(MicroShell<CustomState>::PromptHook hook)
+{
+    _promptHook = hook;
+}
+
 template<typename CustomState>
 typename MicroShell<CustomState>::CommandPtr MicroShell<CustomState>::getCommand(int index)
 {
@@ -203,6 +216,11 @@ int MicroShell<CustomState>::run(CustomState& state, CLIStreams& streams)
     int shellCode;
     do
     {
+        if (_promptHook)
+        {
+            _promptHook(state, streams);
+        }
+
         std::string command = CLIInput::askForInput<std::string>("$ ", streams);
         shellCode = processInput(command, state, streams);
     } while (shellCode != SHELL_EXIT);      // Exit when the proper signal is returned.
@@ -0,0 +1,92 @@
+#ifndef TOOLS__PARALLEL_TOOLS_HPP
+#define TOOLS__PARALLEL_TOOLS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+#include "bounded_queue.hpp"
+#include "thread_pool.hpp"
+
+namespace ParallelTools
+{
+    // Produce the results of indices 0 to count - 1 on worker threads, and hand them over to `consume` on the
+    // calling thread in completion order, through a queue holding at most `queueCapacity` results.
+    // Results are made by `produce(worker, index)`, where `worker` is the index of the worker making them,
+    // below min(threadCount, count): a worker may keep its own state, no other worker uses it.
+    // A thread count of 0 uses one thread per hardware thread.
+    // The first exception thrown by `produce` stops every worker, the first one thrown by `consume` stops
+    // consumption. Either is rethrown once the workers are done, those from `produce` first.
+    template<typename Result, typename Produce, typename Consume>
+    void produceAndConsume(std::size_t count, std::size_t threadCount, std::size_t queueCapacity, const Produce& produce, const Consume& consume)
+    {
+        if (count == 0) return;
+
+        std::size_t threads = std::min(threadCount > 0 ? threadCount : ThreadPool::defaultThreadCount(), count);
+        BoundedQueue<Result> results = BoundedQueue<Result>(queueCapacity);
+        std::atomic<std::size_t> nextIndex = 0;
+        std::atomic<std::size_t> runningWorkers = threads;
+        std::exception_ptr producerError;
+        std::mutex producerErrorMutex;
+
+        // Workers grab the next index until none is left, or until the queue gets closed because
+        // the consumer gave up or another worker failed.
+        auto worker = [&](std::size_t t)
+        {
+            // Pool tasks must not throw, errors are handed over to the calling thread.
+            try
+            {
+                std::size_t i;
+                while ((i = nextIndex++) < count)
+                {
+                    if (!results.push(produce(t, i))) break;
+                }
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(producerErrorMutex);
+                if (!producerError) producerError = std::current_exception();
+                results.close();
+            }
+
+            // The last worker to finish tells the consumer no more results will come.
+            if (--runningWorkers == 0)
+            {
+                results.close();
+            }
+        };
+
+        std::exception_ptr consumerError;
+        {
+            ThreadPool pool = ThreadPool(threads);
+            for (std::size_t t = 0; t < threads; t++)
+            {
+                pool.submit([&worker, t] () { worker(t); });
+            }
+
+            Result result;
+            while (results.pop(result))
+            {
+                try
+                {
+                    consume(std::move(result));
+                }
+                catch(...)
+                {
+                    consumerError = std::current_exception();
+                    results.close();
+                    break;
+                }
+            }
+            // Pool destruction waits for the workers.
+        }
+
+        if (producerError) std::rethrow_exception(producerError);
+        if (consumerError) std::rethrow_exception(consumerError);
+    }
+}
+
+#endif//TOOLS__PARALLEL_TOOLS_HPP
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "thread_pool.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+ThreadPool::ThreadPool(std::size_t threadCount) :
+    _workers(),
+    _tasks(),
+    _runningTasks(0),
+    _stopping(false)
+{
+    if (threadCount == 0)
+    {
+        threadCount = defaultThreadCount();
+    }
+
+    _workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; i++)
+    {
+        _workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    waitIdle();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _taskAvailable.notify_all();
+
+    for (std::thread& worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _taskAvailable.notify_one();
+}
+
+void ThreadPool::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this]() { return _tasks.empty() && _runningTasks == 0; });
+}
+
+std::size_t ThreadPool::threadCount() const
+{
+    return _workers.size();
+}
+
+std::size_t ThreadPool::defaultThreadCount()
+{
+    // hardware_concurrency() may return 0 when the count cannot be determined.
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? count : 1;
+}
+
+void ThreadPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _taskAvailable.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty()) return;
+
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+            _runningTasks++;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _runningTasks--;
+            if (_tasks.empty() && _runningTasks == 0)
+            {
+                _idle.notify_all();
+            }
+        }
+    }
+}
\ No newline at end of file
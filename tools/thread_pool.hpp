@@ -0,0 +1,47 @@
+#ifndef TOOLS__THREAD_POOL_HPP
+#define TOOLS__THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads running submitted tasks in submission order.
+// Tasks must not throw: exceptions are to be handled inside the task itself.
+class ThreadPool
+{
+    private:    // Attributes
+        std::vector<std::thread> _workers;
+        std::deque<std::function<void()>> _tasks;
+        std::size_t _runningTasks;
+        bool _stopping;
+        std::mutex _mutex;
+        std::condition_variable _taskAvailable;
+        std::condition_variable _idle;
+
+    public:     // Public methods
+        // A thread count of 0 uses one thread per hardware thread.
+        explicit ThreadPool(std::size_t threadCount = 0);
+        // Waits for all submitted tasks to complete, then joins the workers.
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool& other) = delete;
+        ThreadPool& operator=(const ThreadPool& other) = delete;
+
+        void submit(std::function<void()> task);
+        // Block until every submitted task has completed.
+        void waitIdle();
+
+        std::size_t threadCount() const;
+
+        // Number of threads used for a requested count of 0.
+        static std::size_t defaultThreadCount();
+
+    private:    // Private methods
+        void workerLoop();
+};
+
+#endif//TOOLS__THREAD_POOL_HPP
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "varint_tools.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace VarintTools
+{
+    void appendVarint(std::string& out, std::uint64_t value)
+    {
+        // Emit 7 bits at a time, lowest first, flagging every byte but the last.
+        while (value >= 0x80)
+        {
+            out += static_cast<char>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        out += static_cast<char>(value);
+    }
+
+    int varintLength(std::uint64_t value)
+    {
+        int length = 1;
+        while (value >= 0x80)
+        {
+            value >>= 7;
+            length++;
+        }
+        return length;
+    }
+
+    bool readVarint(const unsigned char*& cursor, const unsigned char* end, std::uint64_t& value)
+    {
+        std::uint64_t result = 0;
+        const unsigned char* it = cursor;
+
+        for (int shift = 0; shift < 7 * VARINT_MAX_LENGTH; shift += 7)
+        {
+            if (it == end) return false;
+
+            unsigned char byte = *it++;
+            result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            // Last byte of the encoding.
+            if (!(byte & 0x80))
+            {
+                value = result;
+                cursor = it;
+                return true;
+            }
+        }
+
+        // More than VARINT_MAX_LENGTH bytes: the input is corrupted.
+        return false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#ifndef TOOLS__VARINT_TOOLS_HPP
+#define TOOLS__VARINT_TOOLS_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace VarintTools
+{
+    // Maximum number of bytes a 64-bit varint can take up.
+    inline static const int VARINT_MAX_LENGTH = 10;
+
+    // Appends the LEB128 encoding of a value to a byte string (7 bits per byte, high bit set when more bytes follow).
+    void appendVarint(std::string& out, std::uint64_t value);
+
+    // Returns how many bytes the encoding of a value takes up.
+    int varintLength(std::uint64_t value);
+
+    // Decodes a varint starting at `cursor`, without reading past `end`, and advances the cursor.
+    // Returns false if the input is truncated or overlong, in which case the cursor is left untouched.
+    bool readVarint(const unsigned char*& cursor, const unsigned char* end, std::uint64_t& value);
+}
+
+#endif//TOOLS__VARINT_TOOLS_HPP
\ No newline at end of file